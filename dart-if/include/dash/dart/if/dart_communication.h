@@ -188,6 +188,39 @@ dart_ret_t dart_allreduce(
   dart_operation_t op,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Reduce_scatter.
+ *
+ * Reduces the elements in \c sendbuf of all units element-wise and
+ * scatters the result: unit \c i receives \c nrecvelem[i] elements of
+ * the result in \c recvbuf, following the elements received by units
+ * \c 0 to \c i-1.
+ *
+ * \param sendbuf   The buffer containing the data to be reduced by each
+ *                  unit, holding the sum of \c nrecvelem elements.
+ * \param recvbuf   The buffer to hold the \c nrecvelem[myid] reduced
+ *                  elements received by this unit.
+ * \param nrecvelem Array containing the number of reduced elements
+ *                  received by each unit.
+ *                  The values must not execeed INT_MAX.
+ * \param dtype     The data type of values in \c sendbuf and \c recvbuf
+ *                  to use in \c op.
+ * \param op        The reduction operation to perform.
+ * \param team      The team to participate in the reduce-scatter.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_reduce_scatter(
+  const void     * sendbuf,
+  void           * recvbuf,
+  const size_t   * nrecvelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI alltoall.
  *
@@ -210,6 +243,44 @@ dart_ret_t dart_alltoall(
   dart_datatype_t  dtype,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * Unit \c i sends \c nsendelem[j] elements starting at offset
+ * \c senddispls[j] in \c sendbuf to unit \c j, which receives them at
+ * offset \c recvdispls[i] in \c recvbuf.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param nsendelem   Array containing the number of values to send to each
+ *                    unit.
+ * \param senddispls  Array containing the displacements of the values sent
+ *                    to each unit in \c sendbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param team        The team to participate in the alltoallv.
+ *
+ * The values in \c nsendelem, \c senddispls, \c nrecvelem and
+ * \c recvdispls must not execeed INT_MAX.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_datatype_t   dtype,
+  dart_team_t       team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI_Reduce.
  *
@@ -235,6 +306,34 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Exscan.
+ *
+ * On unit \c i, \c recvbuf holds the element-wise reduction of the
+ * \c sendbuf of units \c 0,...,i-1 using \c op, applied in the order of the
+ * unit IDs. The content of \c recvbuf is undefined on unit 0.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the element-wise operation \c op in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ *                The value of this parameter must not execeed INT_MAX.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform, which does not need to be commutative.
+ * \param team    The team to perform the scan on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -360,6 +459,71 @@ dart_ret_t dart_compare_and_swap(
   void           * result,
   dart_datatype_t  dtype) DART_NOTHROW;
 
+/**
+ * Perform \c nelem atomic fetch-and-op operations on the values pointed to
+ * by the global pointers in \c gptrs, which may reference arbitrary units
+ * and segments. Element \c i is updated by applying \c op with the
+ * value at position \c i in \c values and its previous value is stored
+ * at position \c i in \c results.
+ *
+ * The operations are grouped by target and completed with a single flush
+ * per target, so the function returns after all results are available.
+ * Multiple operations on the same element are applied in the order of
+ * their position in \c gptrs.
+ *
+ * \param gptrs   Array of \c nelem global pointers determining the targets.
+ * \param values  Array of \c nelem elements of type \c dtype to be
+ *                involved in operation \c op.
+ * \param results Array to hold the \c nelem values before the operations
+ *                or \c NULL if the previous values are not needed.
+ * \param nelem   The number of operations to perform.
+ * \param dtype   The data type to use in the operation \c op.
+ * \param op      The operation to perform.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_fetch_and_op_bulk(
+  const dart_gptr_t * gptrs,
+  const void        * values,
+  void              * results,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op) DART_NOTHROW;
+
+/**
+ * Perform \c nelem atomic compare-and-swap operations on the values pointed
+ * to by the global pointers in \c gptrs, see \ref dart_compare_and_swap.
+ * Element \c i is replaced with position \c i in \c values if it is equal
+ * to position \c i in \c compares and its previous value is stored at
+ * position \c i in \c results.
+ *
+ * The operations are grouped by target and completed with a single flush
+ * per target, so the function returns after all results are available.
+ *
+ * \param gptrs    Array of \c nelem global pointers determining the targets.
+ * \param values   Array of \c nelem values to swap in.
+ * \param compares Array of \c nelem values to compare the targets with.
+ * \param results  Array to hold the \c nelem values before the operations.
+ * \param nelem    The number of operations to perform.
+ * \param dtype    Data data type of all involved data elements. Note that
+ *                 only integral types are supported.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_compare_and_swap_bulk(
+  const dart_gptr_t * gptrs,
+  const void        * values,
+  const void        * compares,
+  void              * results,
+  size_t              nelem,
+  dart_datatype_t     dtype) DART_NOTHROW;
+
 
 /** \} */
 
@@ -716,6 +880,329 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Handle groups
+ * A handle group collects the requests of many non-blocking one-sided
+ * operations in a single request array that is completed at once, e.g.
+ * when prefetching a large number of blocks. Completing a group resets it
+ * so it can be reused for the next batch of operations without
+ * allocating memory.
+ */
+
+/** \{ */
+
+/**
+ * Handle group created by \c dart_handle_group_create to collect the
+ * requests of non-blocking operations.
+ */
+typedef struct dart_handle_group_struct * dart_handle_group_t;
+
+#define DART_HANDLE_GROUP_NULL (dart_handle_group_t)NULL
+
+/**
+ * Create an empty handle group.
+ *
+ * \param[out] group Pointer to the handle group to create.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_create(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Destroy a handle group. Pending operations in the group have to be
+ * completed before.
+ *
+ * \param group Pointer to the handle group to destroy.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_destroy(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Number of pending requests in a handle group.
+ *
+ * \param group      The handle group.
+ * \param[out] size  The number of pending requests.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_size(
+  dart_handle_group_t   group,
+  size_t              * size) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_get_handle that adds the operation to a handle
+ * group instead of creating a handle.
+ *
+ * \param dest      Local target memory to store the data.
+ * \param gptr      Global pointer being the source of the data transfer.
+ * \param nelem     The number of elements of \c dtype in buffer \c dest.
+ * \param src_type  The data type of the values at the source.
+ * \param dst_type  The data type of the values in buffer \c dest.
+ * \param group     The handle group to add the operation to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_group(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Variant of \ref dart_put_handle that adds the operation to a handle
+ * group instead of creating a handle.
+ *
+ * \param gptr      Global pointer being the target of the data transfer.
+ * \param src       Local source memory to transfer data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param src_type  The data type of the values in buffer \c src.
+ * \param dst_type  The data type of the values at the target.
+ * \param group     The handle group to add the operation to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_group(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t   group) DART_NOTHROW;
+
+/**
+ * Move the pending operation of a handle into a handle group.
+ * The handle is invalidated.
+ *
+ * \param group   The handle group to add the operation to.
+ * \param handle  Pointer to the handle of the operation.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_add(
+  dart_handle_group_t   group,
+  dart_handle_t       * handle) DART_NOTHROW;
+
+/**
+ * Wait for the local completion of all operations in a handle group.
+ *
+ * \param group The handle group to wait for.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_wait_local(
+  dart_handle_group_t group) DART_NOTHROW;
+
+/**
+ * Wait for the local and remote completion of all operations in a handle
+ * group. Every target is flushed once, regardless of the number of
+ * operations on it.
+ *
+ * \param group The handle group to wait for.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_wait(
+  dart_handle_group_t group) DART_NOTHROW;
+
+/**
+ * Test for the local completion of all operations in a handle group.
+ *
+ * \param group       The handle group to test for completion.
+ * \param[out] result \c True if all operations have completed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_test_local(
+  dart_handle_group_t   group,
+  int32_t             * result) DART_NOTHROW;
+
+/**
+ * Test for the completion of all operations in a handle group and ensure
+ * remote completion.
+ *
+ * \param group       The handle group to test for completion.
+ * \param[out] result \c True if all operations have completed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_test(
+  dart_handle_group_t   group,
+  int32_t             * result) DART_NOTHROW;
+
+/** \} */
+
+/**
+ * \name Non-blocking collective operations
+ * Collective operations that return a handle instead of waiting for the
+ * operation to complete. The handle can be passed to \c dart_wait,
+ * \c dart_test and the like. The buffers passed to these operations may
+ * not be accessed before the operation has completed.
+ * All units of the team have to issue non-blocking collective operations on
+ * a team in the same order.
+ */
+
+/** \{ */
+
+/**
+ * Non-blocking variant of \ref dart_barrier.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with
+ *                    \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t     team,
+  dart_handle_t * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \ref dart_bcast.
+ *
+ * \param buf    Buffer that is the source (on \c root) or the destination of
+ *               the broadcast.
+ * \param nelem  The number of values to broadcast/receive.
+ * \param dtype  The data type of values in \c buf.
+ * \param root   The unit that broadcasts data to all other members in \c team
+ * \param team   The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with
+ *                    \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \ref dart_allgather.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of values sent by each process and received from
+ *                each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with
+ *                    \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \ref dart_allreduce.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from
+ *                each unit. The value of this parameter must not exceed
+ *                INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use
+ *                in \c op.
+ * \param op      The reduction operation to perform. An operation created
+ *                through \ref dart_op_create may not be destroyed before the
+ *                operation has completed.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with
+ *                    \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \ref dart_alltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from
+ *                each unit. The value of this parameter must not exceed
+ *                INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with
+ *                    \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
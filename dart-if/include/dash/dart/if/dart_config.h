@@ -21,6 +21,9 @@ extern "C" {
 /**
  * Access the DART runtime configuration descriptor.
  *
+ * The descriptor is owned by the DART runtime and is only accessed by
+ * reference, new members are appended to \c dart_config_t.
+ *
  * \ingroup DartConfig
  */
 void dart_config(
@@ -357,6 +357,11 @@ dart_ret_t dart_allocator_destroy(dart_allocator_t *allocator);
  * \param dtype The type to use.
  * \param[out] gptr Global Pointer to hold the allocation
  *
+ * Allocations are served from a pre-allocated memory pool that supports
+ * shared-memory access by units on the same node. Once this pool is
+ * exhausted, the pool grows on demand by memory chunks that are accessed
+ * through MPI only and are returned as soon as they are no longer used.
+ *
  * \todo Does dart_memalloc really allocate in _global_ memory?
  *
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
@@ -383,6 +388,49 @@ dart_ret_t dart_memalloc(
  */
 dart_ret_t dart_memfree(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Usage statistics of the local memory pool from which \ref dart_memalloc
+ * and \ref dart_allocator_alloc serve allocations.
+ *
+ * \ingroup DartGlobMem
+ */
+typedef struct dart_mempool_stats {
+  /** Total size of the memory pool in bytes, including grown chunks */
+  size_t   pool_size;
+  /** Number of bytes currently allocated, including alignment padding */
+  size_t   bytes_allocated;
+  /** Number of bytes in free blocks cached by threads for reuse */
+  size_t   bytes_cached;
+  /** Size in bytes of the largest free contiguous block */
+  size_t   largest_free_block;
+  /** Number of allocations served */
+  uint64_t num_allocs;
+  /** Number of allocations released */
+  uint64_t num_frees;
+  /** Number of allocations served from thread caches */
+  uint64_t num_cache_hits;
+  /**
+   * External fragmentation of the pool between 0 (all free memory is
+   * contiguous) and 1, i.e., \c 1 - \c largest_free_block / free bytes.
+   * Cached blocks are not considered free.
+   */
+  double   fragmentation;
+} dart_mempool_stats_t;
+
+/**
+ * Query usage statistics of the local memory pool used by
+ * \ref dart_memalloc.
+ * This is *not* a collective function.
+ *
+ * \param[out] stats Statistics of the memory pool of the calling unit.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memalloc_stats(dart_mempool_stats_t * stats) DART_NOTHROW;
+
 /**
  * Collective function on the specified team to allocate \c nelem elements
  * of type \c dtype of memory in each unit's global address space with a
@@ -25,6 +25,10 @@ extern "C" {
  * Lock type to ensure mutual exclusion among units in a team.
  * The lock is thread-aware so only one thread of a unit can acquire
  * the lock at once.
+ *
+ * Units waiting for a lock are queued and spin on a flag in their own
+ * memory until the lock is handed over to them, so contention does not
+ * cause remote traffic on a single unit.
  * \ingroup DartSync
  */
 typedef struct dart_lock_struct *dart_lock_t;
@@ -50,9 +54,29 @@ dart_ret_t dart_team_lock_init(
   dart_team_t   teamid,
   dart_lock_t * lock)   DART_NOTHROW;
 
+/**
+ * Collective operation to initialize the reader/writer \c lock object.
+ *
+ * In addition to exclusive acquisition through \ref dart_lock_acquire and
+ * \ref dart_lock_try_acquire, a reader/writer lock can be held by
+ * multiple units at once through \ref dart_lock_acquire_shared.
+ * Exclusive acquisition takes precedence over pending shared acquisitions.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t   teamid,
+  dart_lock_t * lock)   DART_NOTHROW;
+
 /**
  * Collective operation to destroy a \c lock initialized using
- * \ref dart_team_lock_init.
+ * \ref dart_team_lock_init or \ref dart_team_rwlock_init.
  *
  * \param lock   The \c lock to free.
  * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
@@ -113,6 +137,52 @@ dart_ret_t dart_lock_try_acquire(
 dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
+/**
+ * Block until the reader/writer \c lock was acquired in shared mode, i.e.,
+ * no unit holds the lock exclusively.
+ *
+ * \param lock The lock to acquire, initialized using
+ *             \ref dart_team_rwlock_init.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_acquire_shared(
+  dart_lock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the reader/writer \c lock in shared mode and return
+ * immediately.
+ *
+ * \param lock The lock to acquire, initialized using
+ *             \ref dart_team_rwlock_init.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_try_acquire_shared(
+  dart_lock_t   lock,
+  int32_t     * result) DART_NOTHROW;
+
+/**
+ * Release the reader/writer \c lock acquired through
+ * \ref dart_lock_acquire_shared or \ref dart_lock_try_acquire_shared.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_release_shared(
+  dart_lock_t   lock)   DART_NOTHROW;
+
 /**
  * Whether the lock has been properly initialized.
  *
@@ -95,6 +95,20 @@ enum
   DART_OP_REPLACE,
   /** No operation */
   DART_OP_NO_OP,
+  /**
+   * Minimum value and its index, operates on pairs of a value of the
+   * basic type and an index of type \c int64_t
+   * (see \ref DART_OP_MINLOC_PAIR)
+   */
+  DART_OP_MINLOC,
+  /** Maximum value and its index, see \ref DART_OP_MINLOC */
+  DART_OP_MAXLOC,
+  /**
+   * Minimum and maximum value and their indices, operates on two
+   * consecutive pairs (see \ref DART_OP_MINMAX_MIN and
+   * \ref DART_OP_MINMAX_MAX)
+   */
+  DART_OP_MINMAXLOC,
   /** Number of operations defined, not an actual operation! */
   DART_OP_LAST
 };
@@ -113,6 +127,21 @@ typedef uintptr_t dart_operation_t ;
  */
 #define DART_OP_MINMAX_MAX 1
 
+/**
+ * Layout of the value-index pairs reduced by \ref DART_OP_MINLOC,
+ * \ref DART_OP_MAXLOC and \ref DART_OP_MINMAXLOC, with \c __type being
+ * the C type of the basic data type passed to the reduction.
+ *
+ * Pairs with a negative index do not hold a value and are ignored, e.g.
+ * on units that do not contribute to the result. Between equal values,
+ * the pair with the smaller index is selected, except for the maximum of
+ * \ref DART_OP_MINMAXLOC which selects the greater index.
+ *
+ * \ingroup DartTypes
+ */
+#define DART_OP_MINLOC_PAIR(__type) \
+  struct { __type value; int64_t index; }
+
 /**
  * Raw data types supported by the DART interface.
  *
@@ -676,11 +705,15 @@ typedef struct {
 dart_unit_locality_t;
 
 /**
+ * Runtime configuration descriptor, see \c dart_config.
+ *
  * \ingroup DartTypes
  */
 typedef struct
 {
-  int log_enabled;
+  int    log_enabled;
+  /** Maximum size in bytes of aggregated puts and gets, 0 if disabled. */
+  size_t coalesce_threshold;
 }
 dart_config_t;
 
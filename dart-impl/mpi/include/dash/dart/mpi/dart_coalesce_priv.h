@@ -0,0 +1,102 @@
+/**
+ * \file dart_coalesce_priv.h
+ *
+ * Aggregation of small non-blocking put and get operations.
+ *
+ * Contiguous transfers issued through \c dart_put and \c dart_get that do
+ * not exceed a configurable threshold are not passed to MPI immediately
+ * but queued per target unit and window. Queued operations are sorted by
+ * target displacement, adjacent ranges are merged, and each queue is issued
+ * as a single MPI_Put / MPI_Get with indexed data types on the next flush
+ * on the target (\c dart_flush, \c dart_flush_local and their \c _all
+ * variants) or when the queue runs full.
+ *
+ * Aggregation is disabled by default and is enabled by setting the
+ * environment variable \c DART_COALESCE_THRESHOLD to the maximum size in
+ * bytes of transfers to be aggregated. The threshold in effect is reported
+ * in \c dart_config_t::coalesce_threshold.
+ */
+#ifndef DART__MPI__DART_COALESCE_PRIV_H__
+#define DART__MPI__DART_COALESCE_PRIV_H__
+
+#include <mpi.h>
+#include <stdlib.h>
+
+#include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_types.h>
+
+#define DART_COALESCE_THRESHOLD_ENVSTR  "DART_COALESCE_THRESHOLD"
+
+/**
+ * Maximum size in bytes of a single transfer to be aggregated, 0 if
+ * aggregation is disabled.
+ */
+extern size_t dart__mpi__coalesce_threshold DART_INTERNAL;
+
+/**
+ * Read the aggregation threshold from the environment and initialize the
+ * operation queues.
+ */
+dart_ret_t
+dart__mpi__coalesce_init() DART_INTERNAL;
+
+/**
+ * Issue and complete all pending operations and release the queues.
+ */
+dart_ret_t
+dart__mpi__coalesce_fini() DART_INTERNAL;
+
+/**
+ * Whether a contiguous transfer of \c nbytes bytes should be queued
+ * instead of being issued immediately.
+ */
+DART_INLINE
+int dart__mpi__coalesce_applicable(size_t nbytes)
+{
+  return (nbytes > 0 && nbytes <= dart__mpi__coalesce_threshold);
+}
+
+/**
+ * Queue a put of \c nbytes bytes from \c src to displacement \c disp in
+ * window \c win at \c target. The data is copied to an internal staging
+ * buffer, \c src may be reused immediately.
+ */
+dart_ret_t
+dart__mpi__coalesce_put(
+  MPI_Win      win,
+  int          target,
+  MPI_Aint     disp,
+  const void * src,
+  size_t       nbytes) DART_INTERNAL;
+
+/**
+ * Queue a get of \c nbytes bytes from displacement \c disp in window
+ * \c win at \c target to \c dest. The content of \c dest is undefined until
+ * the operation has been flushed.
+ */
+dart_ret_t
+dart__mpi__coalesce_get(
+  MPI_Win      win,
+  int          target,
+  MPI_Aint     disp,
+  void       * dest,
+  size_t       nbytes) DART_INTERNAL;
+
+/**
+ * Issue all operations pending for \c target in window \c win and wait for
+ * their local completion.
+ */
+dart_ret_t
+dart__mpi__coalesce_flush(
+  MPI_Win      win,
+  int          target) DART_INTERNAL;
+
+/**
+ * Issue all operations pending for any target in window \c win and wait for
+ * their local completion.
+ */
+dart_ret_t
+dart__mpi__coalesce_flush_all(
+  MPI_Win      win) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_COALESCE_PRIV_H__ */
@@ -0,0 +1,100 @@
+/**
+ * \file dart_collective_hier_priv.h
+ *
+ * Two-level, topology-aware implementations of \c dart_allreduce,
+ * \c dart_bcast and \c dart_allgather.
+ *
+ * Units on the same node exchange their contributions through a shared
+ * memory window of the team and only one leader unit per node takes part
+ * in the MPI collective between nodes. The hierarchical path is used for
+ * messages of up to \c DART_COLL_HIER_THRESHOLD bytes per unit (default:
+ * 16 KiB) on teams with more than one unit on any node. Larger messages are
+ * left to the flat MPI collective on the team communicator. Setting the
+ * threshold to 0 disables the hierarchical path.
+ *
+ * The node-level communicators and the shared window of a team are created
+ * collectively on the first collective operation that qualifies for the
+ * hierarchical path.
+ */
+#ifndef DART__MPI__DART_COLLECTIVE_HIER_PRIV_H__
+#define DART__MPI__DART_COLLECTIVE_HIER_PRIV_H__
+
+#include <mpi.h>
+#include <stdlib.h>
+
+#include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#define DART_COLL_HIER_THRESHOLD_ENVSTR  "DART_COLL_HIER_THRESHOLD"
+
+/**
+ * Maximum size in bytes of the contribution of a single unit for which
+ * the hierarchical path is used, 0 if the hierarchical path is disabled.
+ */
+extern size_t dart__mpi__coll_hier_threshold DART_INTERNAL;
+
+/**
+ * Read the threshold of the hierarchical path from the environment.
+ */
+dart_ret_t
+dart__mpi__coll_hier_init() DART_INTERNAL;
+
+/**
+ * Release the node-level resources of the team, collective on the team.
+ */
+dart_ret_t
+dart__mpi__coll_hier_team_fini(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+/**
+ * Whether a collective in which each unit contributes \c nbytes bytes
+ * should use the hierarchical path. The result of the collective has to fit
+ * into the shared buffer of each node, i.e., \c nresults is the number
+ * of contributions it consists of (1 for reductions and broadcasts, the
+ * team size for allgather).
+ * The decision is the same on all units of the team. Collective on the
+ * team on the first call that passes the size check.
+ */
+int
+dart__mpi__coll_hier_applicable(
+  dart_team_data_t * team_data,
+  size_t             nbytes,
+  size_t             nresults) DART_INTERNAL;
+
+/**
+ * Hierarchical allreduce of \c nelem elements of type \c dtype using the
+ * commutative operation \c op.
+ */
+dart_ret_t
+dart__mpi__coll_hier_allreduce(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  int                nelem,
+  MPI_Datatype       dtype,
+  MPI_Op             op) DART_INTERNAL;
+
+/**
+ * Hierarchical broadcast of \c nbytes bytes from team unit \c root.
+ */
+dart_ret_t
+dart__mpi__coll_hier_bcast(
+  dart_team_data_t * team_data,
+  void             * data,
+  size_t             nbytes,
+  int                root) DART_INTERNAL;
+
+/**
+ * Hierarchical allgather of \c nbytes bytes per unit. The contribution
+ * of the calling unit is read from its slot in \c recvbuf if \c sendbuf
+ * is \c NULL.
+ */
+dart_ret_t
+dart__mpi__coll_hier_allgather(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_COLLECTIVE_HIER_PRIV_H__ */
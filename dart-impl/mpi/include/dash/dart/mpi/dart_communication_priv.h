@@ -29,6 +29,21 @@ dart_ret_t dart__mpi__op_init();
 DART_INTERNAL
 MPI_Op dart__mpi__op_minmax(dart_operation_t op, dart_datatype_t type);
 
+/**
+ * Returns the MPI operation implementing one of the value-index
+ * reductions \c DART_OP_MINLOC, \c DART_OP_MAXLOC or
+ * \c DART_OP_MINMAXLOC on pairs with a value of the basic type \c type.
+ */
+DART_INTERNAL
+MPI_Op dart__mpi__op_loc(dart_operation_t op, dart_datatype_t type);
+
+/**
+ * Returns the MPI datatype of the value-index pairs reduced by
+ * \ref dart__mpi__op_loc.
+ */
+DART_INTERNAL
+MPI_Datatype dart__mpi__op_loc_type(dart_datatype_t type);
+
 struct dart_operation_struct {
   MPI_Datatype      mpi_type;
   MPI_Datatype      mpi_type_op;
@@ -54,6 +69,9 @@ DART_INLINE MPI_Op dart__mpi__op(dart_operation_t dart_op, dart_datatype_t type)
     case DART_OP_REPLACE : return MPI_REPLACE;
     case DART_OP_NO_OP   : return MPI_NO_OP;
     case DART_OP_MINMAX  : return dart__mpi__op_minmax(DART_OP_MINMAX, type);
+    case DART_OP_MINLOC    : /* fall-through */
+    case DART_OP_MAXLOC    : /* fall-through */
+    case DART_OP_MINMAXLOC : return dart__mpi__op_loc(dart_op, type);
     default              :
       return ((struct dart_operation_struct*)dart_op)->mpi_op;
   }
@@ -65,6 +83,13 @@ const char* dart__mpi__op_name(dart_operation_t op);
 DART_INTERNAL
 dart_ret_t dart__mpi__op_fini();
 
+/**
+ * Release the memory of the pools of handles and handle groups used for
+ * non-blocking operations.
+ */
+DART_INTERNAL
+void dart__mpi__handle_pool_fini();
+
 /*****************************************************************/
 /* MPI datatypes                                                 */
 /*****************************************************************/
@@ -103,7 +128,8 @@ typedef struct dart_datatype_struct {
     } contiguous;
     /// used for DART_KIND_STRIDED
     /// NOTE: the underlying MPI strided type is created dynamically based on
-    ///       the number of blocks required.
+    ///       the number of blocks required and cached for later transfers,
+    ///       see \ref dart__mpi__strided_mpi.
     struct {
       /// the stride between blocks of size \c num_elem
       int              stride;
@@ -206,14 +232,19 @@ size_t dart__mpi__datatype_num_elem(dart_datatype_t dart_type) {
   return (dart__mpi__datatype_struct(dart_type)->num_elem);
 }
 
+/**
+ * Return the committed MPI vector type describing \c num_blocks blocks of
+ * the strided DART type \c dart_type.
+ *
+ * The MPI type is created on first use and cached until the DART type is
+ * destroyed through \c dart_type_destroy or DART is finalized.
+ * The returned type must not be freed by the caller.
+ */
 MPI_Datatype
-dart__mpi__create_strided_mpi(
+dart__mpi__strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
-void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
-
 DART_INLINE
 void
 dart__mpi__datatype_convert_mpi(
@@ -231,7 +262,7 @@ dart__mpi__datatype_convert_mpi(
       break;
     case DART_KIND_STRIDED:
       *mpi_num_elem = 1;
-      *mpi_type     = dart__mpi__create_strided_mpi(
+      *mpi_type     = dart__mpi__strided_mpi(
                                       dart_type, dart_num_elem / dts->num_elem);
       break;
     case DART_KIND_INDEXED:
@@ -295,6 +326,10 @@ DART_INLINE MPI_Datatype dart__mpi__op_type(
     case DART_OP_NO_OP   : /* fall-through */
     case DART_OP_MINMAX  :
       return dart__mpi__datatype_struct(type)->contiguous.mpi_type;
+    case DART_OP_MINLOC    : /* fall-through */
+    case DART_OP_MAXLOC    : /* fall-through */
+    case DART_OP_MINMAXLOC :
+      return dart__mpi__op_loc_type(type);
     default              :
       DART_ASSERT_MSG(((struct dart_operation_struct*)dart_op)->mpi_type
                         == dart__mpi__datatype_struct(type)->contiguous.mpi_type,
@@ -7,4 +7,10 @@
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 
+/**
+ * Detach and free all memory chunks that have been attached to the dynamic
+ * window \c win to extend the local allocation pool.
+ */
+void dart__mpi__local_alloc_release(MPI_Win win) DART_INTERNAL;
+
 #endif /* DART__MPI__DART_GLOBMEM_PRIV_H__ */
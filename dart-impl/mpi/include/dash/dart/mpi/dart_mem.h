@@ -13,6 +13,7 @@
 #include <inttypes.h>
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_globmem.h>
 
 // forward declaration
 struct dart_buddy;
@@ -51,6 +52,14 @@ ssize_t dart_buddy_alloc(struct dart_buddy *, size_t size) DART_INTERNAL;
  */
 int dart_buddy_free(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
 
+/**
+ * Query usage and fragmentation statistics of the allocator.
+ * Blocks held in thread caches are accounted as cached, not allocated.
+ */
+void dart_buddy_stats(
+  struct dart_buddy    *,
+  dart_mempool_stats_t * stats) DART_INTERNAL;
+
 /**
  * ???
  */
@@ -15,7 +15,32 @@
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/**
+ * Segment descriptors are stored in blocks of
+ * \c DART_SEGMENT_BLOCK_SIZE entries that are indexed directly by the
+ * absolute value of the segment ID. Blocks are allocated on demand and never
+ * moved, i.e., pointers to segment descriptors remain valid until the
+ * segment data is finalized.
+ */
+#define DART_SEGMENT_BLOCK_BITS 8
+#define DART_SEGMENT_BLOCK_SIZE (1 << DART_SEGMENT_BLOCK_BITS)
+/* covers the absolute values of all segment IDs including INT16_MIN */
+#define DART_SEGMENT_NUM_BLOCKS \
+  ((-(INT16_MIN) >> DART_SEGMENT_BLOCK_BITS) + 1)
+
+/**
+ * Segment ID marking unused entries in the segment table, never handed out
+ * by \c dart_segment_alloc.
+ */
+#define DART_SEGMENT_INVALID    INT16_MIN
+
+/**
+ * Segment ID of local allocations served from memory attached to the
+ * dynamic window of \c DART_TEAM_ALL once the pre-allocated local memory
+ * pool is exhausted. Offsets in this segment are the displacements of the
+ * allocations in the dynamic window at their owning unit.
+ */
+#define DART_SEGMENT_LOCAL_DYNAMIC  ((dart_segid_t)(INT16_MIN + 1))
 
 typedef struct
 {
@@ -30,14 +55,19 @@ typedef struct
   bool         is_dynamic;  /* whether this is a shared memory segment */
 } dart_segment_info_t;
 
-// forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct {
+  /* blocks of segment descriptors, indexed by absolute segment ID */
+  dart_segment_info_t * blocks[DART_SEGMENT_NUM_BLOCKS];
+  /* IDs of released segments to be re-used */
+  dart_segid_t        * freelist;
+  int                   freelist_size;
+  int                   freelist_capacity;
+} dart_segment_table_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
+  dart_segment_table_t  mem_segs;  /* allocated segments, ID >= 0 */
+  dart_segment_table_t  reg_segs;  /* registered segments, ID < 0 */
   dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -54,13 +84,14 @@ typedef struct {
 
 typedef enum {
   DART_SEGMENT_LOCAL_ALLOC,
+  DART_SEGMENT_LOCAL_DYNAMIC_ALLOC,
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
 } dart_segment_type;
 
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment table.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -85,11 +116,40 @@ dart_segment_register(
   dart_segment_info_t *seg) DART_INTERNAL;
 
 /**
- * Returns the segment info for the segment with ID \c segid.
+ * Logs the lookup of an invalid segment ID and returns \c NULL.
+ */
+dart_segment_info_t * dart_segment__invalid(
+  const dart_segmentdata_t *segdata,
+  dart_segid_t              segid) DART_INTERNAL;
+
+/**
+ * Returns the segment info for the segment with ID \c segid or \c NULL if
+ * no such segment exists.
  */
+static inline
 dart_segment_info_t * dart_segment_get_info(
   dart_segmentdata_t *segdata,
-  dart_segid_t        segid) DART_INTERNAL;
+  dart_segid_t        segid)
+{
+  const dart_segment_table_t *tab;
+  int idx;
+  if (segid >= 0) {
+    tab = &segdata->mem_segs;
+    idx = segid;
+  } else {
+    tab = &segdata->reg_segs;
+    idx = -segid;
+  }
+  dart_segment_info_t *block = tab->blocks[idx >> DART_SEGMENT_BLOCK_BITS];
+  if (dart__unlikely(block == NULL)) {
+    return dart_segment__invalid(segdata, segid);
+  }
+  dart_segment_info_t *seg = &block[idx & (DART_SEGMENT_BLOCK_SIZE - 1)];
+  if (dart__unlikely(seg->segid != segid)) {
+    return dart_segment__invalid(segdata, segid);
+  }
+  return seg;
+}
 
 /**
  * Returns the segment's displacement at unit \c team_unit_id.
@@ -178,7 +238,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment table.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
@@ -2,7 +2,12 @@
 #define DART_SYNCHRONIZATION_PRIV_H_INCLUDED
 
 #include <dash/dart/if/dart_synchronization.h>
+#include <dash/dart/mpi/dart_team_private.h>
 
-dart_ret_t dart__mpi__destroylocks(struct dart_lock_struct* allocated_locks);
+/**
+ * Invalidate all locks of the team and free its lock pool.
+ * Collective on the team, called before the team's communicator is freed.
+ */
+dart_ret_t dart__mpi__destroylocks(dart_team_data_t *team_data) DART_INTERNAL;
 
 #endif // DART_SYNCHRONIZATION_PRIV_H_INCLUDED
@@ -184,6 +184,12 @@ typedef struct dart_team_data {
    */
   int sharedmem_nodesize;
 
+  /**
+   * @brief Node-level resources of hierarchical collectives, created on
+   * first use (see dart_collective_hier_priv.h).
+   */
+  struct dart_coll_hier *coll_hier;
+
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
   dart_unit_t unitid;
@@ -194,6 +200,11 @@ typedef struct dart_team_data {
 
   struct dart_lock_struct *allocated_locks;
 
+  /**
+   * Windows holding the state of the locks allocated in this team.
+   */
+  struct dart_lock_pool   *lock_pool;
+
 } dart_team_data_t;
 
 /* @brief Initiate the free-team-list and allocated-team-list.
@@ -0,0 +1,443 @@
+/**
+ * \file dart_coalesce.c
+ *
+ * Aggregation of small non-blocking put and get operations, see
+ * dart_coalesce_priv.h.
+ */
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_config.h>
+#include <dash/dart/if/dart_initialization.h>
+
+#include <dash/dart/mpi/dart_coalesce_priv.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+
+#include <mpi.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define DART_COALESCE_HASH_SIZE    127
+
+/**
+ * Maximum number of operations queued per target before the queue is
+ * issued implicitly.
+ */
+#define DART_COALESCE_MAX_OPS     4096
+
+#define CHECK_MPI_RET(__call, __name)                      \
+  do {                                                     \
+    if (dart__unlikely(__call != MPI_SUCCESS)) {           \
+      DART_LOG_ERROR("%s ! %s failed!", __func__, __name); \
+      dart_abort(DART_EXIT_ABORT);                         \
+    }                                                      \
+  } while (0)
+
+typedef struct dart_coalesce_op {
+  /// displacement of the first byte at the target
+  MPI_Aint  disp;
+  /// offset in the staging buffer (put) or local address (get)
+  uintptr_t origin;
+  /// number of bytes transferred
+  size_t    nbytes;
+  /// position in the queue, keeps the sort stable
+  int       seq;
+} dart_coalesce_op_t;
+
+typedef struct dart_coalesce_oplist {
+  dart_coalesce_op_t * ops;
+  int                  num_ops;
+  int                  capacity;
+} dart_coalesce_oplist_t;
+
+typedef struct dart_coalesce_queue {
+  MPI_Win                      win;
+  int                          target;
+  dart_coalesce_oplist_t       puts;
+  dart_coalesce_oplist_t       gets;
+  /// staging buffer holding the data of queued puts
+  char                       * buf;
+  size_t                       buf_size;
+  size_t                       buf_capacity;
+  struct dart_coalesce_queue * next;
+} dart_coalesce_queue_t;
+
+size_t dart__mpi__coalesce_threshold = 0;
+
+static dart_coalesce_queue_t * hashtab[DART_COALESCE_HASH_SIZE];
+static dart_mutex_t hash_mtx = DART_MUTEX_INITIALIZER;
+
+static inline int hash_queue(MPI_Win win, int target)
+{
+  return ((((uintptr_t)win) >> 4) ^ (uintptr_t)target)
+            % DART_COALESCE_HASH_SIZE;
+}
+
+/**
+ * Find the queue of \c target in \c win, creating it if \c create is set.
+ * Must be called with \c hash_mtx held.
+ */
+static dart_coalesce_queue_t *
+get_queue(MPI_Win win, int target, int create)
+{
+  int slot = hash_queue(win, target);
+  dart_coalesce_queue_t *queue = hashtab[slot];
+  while (queue != NULL) {
+    if (queue->win == win && queue->target == target) {
+      return queue;
+    }
+    queue = queue->next;
+  }
+  if (create) {
+    queue = calloc(1, sizeof(dart_coalesce_queue_t));
+    queue->win    = win;
+    queue->target = target;
+    queue->next   = hashtab[slot];
+    hashtab[slot] = queue;
+  }
+  return queue;
+}
+
+static void
+destroy_queue(dart_coalesce_queue_t *queue)
+{
+  free(queue->puts.ops);
+  free(queue->gets.ops);
+  free(queue->buf);
+  free(queue);
+}
+
+static dart_coalesce_op_t *
+oplist_append(dart_coalesce_oplist_t *list)
+{
+  if (list->num_ops == list->capacity) {
+    list->capacity = (list->capacity == 0) ? 64 : 2 * list->capacity;
+    list->ops = realloc(list->ops,
+                        list->capacity * sizeof(dart_coalesce_op_t));
+  }
+  dart_coalesce_op_t *op = &list->ops[list->num_ops];
+  op->seq = list->num_ops++;
+  return op;
+}
+
+static int
+cmp_op(const void *lhs_, const void *rhs_)
+{
+  const dart_coalesce_op_t *lhs = lhs_;
+  const dart_coalesce_op_t *rhs = rhs_;
+  if (lhs->disp != rhs->disp) {
+    return (lhs->disp < rhs->disp) ? -1 : 1;
+  }
+  return lhs->seq - rhs->seq;
+}
+
+static inline char *
+op_origin(const dart_coalesce_queue_t *queue, const dart_coalesce_op_t *op,
+          int is_put)
+{
+  return is_put ? queue->buf + op->origin : (char *)op->origin;
+}
+
+static void
+issue_single(
+  dart_coalesce_queue_t * queue,
+  char                  * origin,
+  MPI_Aint                disp,
+  size_t                  nbytes,
+  int                     is_put)
+{
+  if (is_put) {
+    CHECK_MPI_RET(
+      MPI_Put(origin, nbytes, MPI_BYTE,
+              queue->target, disp, nbytes, MPI_BYTE, queue->win),
+      "MPI_Put");
+  } else {
+    CHECK_MPI_RET(
+      MPI_Get(origin, nbytes, MPI_BYTE,
+              queue->target, disp, nbytes, MPI_BYTE, queue->win),
+      "MPI_Get");
+  }
+}
+
+/**
+ * Issue the operations in \c list as a single MPI operation after merging
+ * adjacent ranges. Operations with overlapping target ranges are issued
+ * individually and in their original order instead.
+ */
+static void
+issue_oplist(
+  dart_coalesce_queue_t  * queue,
+  dart_coalesce_oplist_t * list,
+  int                      is_put)
+{
+  int num_ops = list->num_ops;
+  if (num_ops == 0) {
+    return;
+  }
+  if (num_ops == 1) {
+    dart_coalesce_op_t *op = &list->ops[0];
+    issue_single(queue, op_origin(queue, op, is_put),
+                 op->disp, op->nbytes, is_put);
+    list->num_ops = 0;
+    return;
+  }
+
+  dart_coalesce_op_t *ops = list->ops;
+  qsort(ops, num_ops, sizeof(dart_coalesce_op_t), &cmp_op);
+
+  int          * blocklens    = malloc(num_ops * sizeof(int));
+  MPI_Aint     * origin_disps = malloc(num_ops * sizeof(MPI_Aint));
+  MPI_Aint     * target_disps = malloc(num_ops * sizeof(MPI_Aint));
+  int            num_blocks   = 0;
+  MPI_Aint       target_end   = 0;
+  char         * origin_end   = NULL;
+  int            overlapping  = 0;
+
+  for (int i = 0; i < num_ops; ++i) {
+    char *origin = op_origin(queue, &ops[i], is_put);
+    if (num_blocks > 0 && ops[i].disp < target_end) {
+      overlapping = 1;
+      break;
+    }
+    if (num_blocks > 0 && ops[i].disp == target_end &&
+        origin == origin_end &&
+        blocklens[num_blocks - 1] <= INT_MAX - (int)ops[i].nbytes) {
+      // extend the previous block
+      blocklens[num_blocks - 1] += ops[i].nbytes;
+    } else {
+      MPI_Get_address(origin, &origin_disps[num_blocks]);
+      target_disps[num_blocks] = ops[i].disp;
+      blocklens[num_blocks]    = ops[i].nbytes;
+      ++num_blocks;
+    }
+    target_end = ops[i].disp + ops[i].nbytes;
+    origin_end = origin + ops[i].nbytes;
+  }
+
+  if (overlapping) {
+    // restore the original order and let MPI handle the conflict
+    DART_LOG_TRACE("dart_coalesce: overlapping ranges, issuing %d ops "
+                   "individually", num_ops);
+    for (int i = 0; i < num_ops; ++i) {
+      dart_coalesce_op_t *op = &ops[i];
+      while (op->seq != i) {
+        dart_coalesce_op_t tmp = ops[op->seq];
+        ops[op->seq] = *op;
+        *op = tmp;
+      }
+      issue_single(queue, op_origin(queue, op, is_put),
+                   op->disp, op->nbytes, is_put);
+    }
+  } else if (num_blocks == 1) {
+    issue_single(queue, op_origin(queue, &ops[0], is_put),
+                 target_disps[0], blocklens[0], is_put);
+  } else {
+    MPI_Datatype origin_type, target_type;
+    MPI_Aint     target_base = target_disps[0];
+    for (int i = 0; i < num_blocks; ++i) {
+      target_disps[i] -= target_base;
+    }
+    MPI_Type_create_hindexed(
+      num_blocks, blocklens, origin_disps, MPI_BYTE, &origin_type);
+    MPI_Type_create_hindexed(
+      num_blocks, blocklens, target_disps, MPI_BYTE, &target_type);
+    MPI_Type_commit(&origin_type);
+    MPI_Type_commit(&target_type);
+    DART_LOG_TRACE("dart_coalesce: %s of %d ops in %d blocks to unit %d",
+                   is_put ? "MPI_Put" : "MPI_Get",
+                   num_ops, num_blocks, queue->target);
+    if (is_put) {
+      CHECK_MPI_RET(
+        MPI_Put(MPI_BOTTOM, 1, origin_type,
+                queue->target, target_base, 1, target_type, queue->win),
+        "MPI_Put");
+    } else {
+      CHECK_MPI_RET(
+        MPI_Get(MPI_BOTTOM, 1, origin_type,
+                queue->target, target_base, 1, target_type, queue->win),
+        "MPI_Get");
+    }
+    // types are freed lazily by MPI once the operation completes
+    MPI_Type_free(&origin_type);
+    MPI_Type_free(&target_type);
+  }
+
+  free(blocklens);
+  free(origin_disps);
+  free(target_disps);
+  list->num_ops = 0;
+}
+
+/**
+ * Issue all operations in \c queue without waiting for completion.
+ * Returns whether any operation has been issued.
+ */
+static int
+issue_queue(dart_coalesce_queue_t *queue)
+{
+  if (queue->puts.num_ops == 0 && queue->gets.num_ops == 0) {
+    return 0;
+  }
+  issue_oplist(queue, &queue->puts, 1);
+  issue_oplist(queue, &queue->gets, 0);
+  return 1;
+}
+
+/**
+ * Issue all operations in \c queue and wait for their local completion
+ * so that the staging buffer can be reused.
+ */
+static void
+flush_queue(dart_coalesce_queue_t *queue)
+{
+  if (issue_queue(queue)) {
+    CHECK_MPI_RET(
+      MPI_Win_flush_local(queue->target, queue->win), "MPI_Win_flush_local");
+    queue->buf_size = 0;
+  }
+}
+
+dart_ret_t
+dart__mpi__coalesce_init()
+{
+  memset(hashtab, 0, sizeof(hashtab));
+  dart__mpi__coalesce_threshold = 0;
+  const char *envstr = getenv(DART_COALESCE_THRESHOLD_ENVSTR);
+  if (envstr != NULL) {
+    long threshold = atol(envstr);
+    if (threshold > 0) {
+      dart__mpi__coalesce_threshold = threshold;
+      DART_LOG_DEBUG("dart_coalesce: aggregating transfers up to %zu bytes",
+                     dart__mpi__coalesce_threshold);
+    }
+  }
+  dart_config_t *config;
+  dart_config(&config);
+  config->coalesce_threshold = dart__mpi__coalesce_threshold;
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coalesce_fini()
+{
+  dart__base__mutex_lock(&hash_mtx);
+  for (int slot = 0; slot < DART_COALESCE_HASH_SIZE; ++slot) {
+    dart_coalesce_queue_t *queue = hashtab[slot];
+    while (queue != NULL) {
+      dart_coalesce_queue_t *next = queue->next;
+      if (queue->puts.num_ops > 0 || queue->gets.num_ops > 0) {
+        DART_LOG_WARN("dart_coalesce: discarding %d puts and %d gets "
+                      "pending for unit %d",
+                      queue->puts.num_ops, queue->gets.num_ops,
+                      queue->target);
+      }
+      destroy_queue(queue);
+      queue = next;
+    }
+    hashtab[slot] = NULL;
+  }
+  dart__mpi__coalesce_threshold = 0;
+  dart__base__mutex_unlock(&hash_mtx);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coalesce_put(
+  MPI_Win      win,
+  int          target,
+  MPI_Aint     disp,
+  const void * src,
+  size_t       nbytes)
+{
+  dart__base__mutex_lock(&hash_mtx);
+  dart_coalesce_queue_t *queue = get_queue(win, target, 1);
+  if (queue->buf_size + nbytes > queue->buf_capacity) {
+    size_t capacity = (queue->buf_capacity == 0) ? 4096
+                                                 : 2 * queue->buf_capacity;
+    while (capacity < queue->buf_size + nbytes) {
+      capacity *= 2;
+    }
+    queue->buf          = realloc(queue->buf, capacity);
+    queue->buf_capacity = capacity;
+  }
+  dart_coalesce_op_t *op = oplist_append(&queue->puts);
+  op->disp   = disp;
+  op->origin = queue->buf_size;
+  op->nbytes = nbytes;
+  memcpy(queue->buf + queue->buf_size, src, nbytes);
+  queue->buf_size += nbytes;
+
+  if (queue->puts.num_ops >= DART_COALESCE_MAX_OPS) {
+    flush_queue(queue);
+  }
+  dart__base__mutex_unlock(&hash_mtx);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coalesce_get(
+  MPI_Win      win,
+  int          target,
+  MPI_Aint     disp,
+  void       * dest,
+  size_t       nbytes)
+{
+  dart__base__mutex_lock(&hash_mtx);
+  dart_coalesce_queue_t *queue = get_queue(win, target, 1);
+  dart_coalesce_op_t *op = oplist_append(&queue->gets);
+  op->disp   = disp;
+  op->origin = (uintptr_t)dest;
+  op->nbytes = nbytes;
+
+  if (queue->gets.num_ops >= DART_COALESCE_MAX_OPS) {
+    flush_queue(queue);
+  }
+  dart__base__mutex_unlock(&hash_mtx);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coalesce_flush(
+  MPI_Win      win,
+  int          target)
+{
+  dart__base__mutex_lock(&hash_mtx);
+  dart_coalesce_queue_t *queue = get_queue(win, target, 0);
+  if (queue != NULL) {
+    flush_queue(queue);
+  }
+  dart__base__mutex_unlock(&hash_mtx);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coalesce_flush_all(
+  MPI_Win      win)
+{
+  int issued = 0;
+  dart__base__mutex_lock(&hash_mtx);
+  for (int slot = 0; slot < DART_COALESCE_HASH_SIZE; ++slot) {
+    for (dart_coalesce_queue_t *queue = hashtab[slot];
+         queue != NULL; queue = queue->next) {
+      if (queue->win == win) {
+        issued |= issue_queue(queue);
+      }
+    }
+  }
+  if (issued) {
+    CHECK_MPI_RET(MPI_Win_flush_local_all(win), "MPI_Win_flush_local_all");
+    for (int slot = 0; slot < DART_COALESCE_HASH_SIZE; ++slot) {
+      for (dart_coalesce_queue_t *queue = hashtab[slot];
+           queue != NULL; queue = queue->next) {
+        if (queue->win == win) {
+          queue->buf_size = 0;
+        }
+      }
+    }
+  }
+  dart__base__mutex_unlock(&hash_mtx);
+  return DART_OK;
+}
@@ -0,0 +1,387 @@
+/**
+ * \file dart_collective_hier.c
+ *
+ * Two-level collective operations using node-local shared memory, see
+ * dart_collective_hier_priv.h.
+ */
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_initialization.h>
+
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <mpi.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Default maximum contribution per unit for the hierarchical path */
+#define DART_COLL_HIER_DEFAULT_THRESHOLD (16 * 1024)
+
+#define CHECK_MPI_RET(__call, __name)                      \
+  do {                                                     \
+    if (dart__unlikely(__call != MPI_SUCCESS)) {           \
+      DART_LOG_ERROR("%s ! %s failed!", __func__, __name); \
+      dart_abort(DART_EXIT_ABORT);                         \
+    }                                                      \
+  } while (0)
+
+typedef struct dart_coll_hier {
+  /// whether any node hosts more than one unit of the team
+  bool      enabled;
+  /// units of the team on this node
+  MPI_Comm  node_comm;
+  /// leader units of all nodes, MPI_COMM_NULL on other units
+  MPI_Comm  leader_comm;
+  int       local_rank;
+  int       local_size;
+  int       node_id;
+  int       num_nodes;
+  /// node of each unit in the team
+  int     * unit_node;
+  /// rank of each unit in the team within its node
+  int     * unit_local;
+  /// number of units on each node
+  int     * node_sizes;
+  /// position of the first unit of each node in node-major order
+  int     * node_offsets;
+  /// scratch space for counts and displacements in MPI_Allgatherv
+  int     * counts;
+  int     * displs;
+  /// shared window holding two alternating buffers of bufsize bytes
+  MPI_Win   win;
+  char    * buf;
+  size_t    bufsize;
+  unsigned  epoch;
+} dart_coll_hier_t;
+
+size_t dart__mpi__coll_hier_threshold = DART_COLL_HIER_DEFAULT_THRESHOLD;
+
+dart_ret_t
+dart__mpi__coll_hier_init()
+{
+  dart__mpi__coll_hier_threshold = DART_COLL_HIER_DEFAULT_THRESHOLD;
+  const char *envstr = getenv(DART_COLL_HIER_THRESHOLD_ENVSTR);
+  if (envstr != NULL) {
+    long threshold = atol(envstr);
+    dart__mpi__coll_hier_threshold = (threshold > 0) ? threshold : 0;
+  }
+  DART_LOG_DEBUG("dart_coll_hier: hierarchical collectives up to %zu bytes",
+                 dart__mpi__coll_hier_threshold);
+  return DART_OK;
+}
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+static dart_coll_hier_t *
+hier_setup(dart_team_data_t * team_data)
+{
+  dart_coll_hier_t *hier = calloc(1, sizeof(dart_coll_hier_t));
+  hier->node_comm   = team_data->sharedmem_comm;
+  hier->leader_comm = MPI_COMM_NULL;
+  hier->win         = MPI_WIN_NULL;
+  MPI_Comm_rank(hier->node_comm, &hier->local_rank);
+  MPI_Comm_size(hier->node_comm, &hier->local_size);
+
+  int max_local_size;
+  CHECK_MPI_RET(
+    MPI_Allreduce(&hier->local_size, &max_local_size, 1, MPI_INT, MPI_MAX,
+                  team_data->comm),
+    "MPI_Allreduce");
+  hier->enabled = (max_local_size > 1);
+  if (!hier->enabled) {
+    DART_LOG_DEBUG("dart_coll_hier: team %d has one unit per node",
+                   team_data->teamid);
+    return hier;
+  }
+
+  bool is_leader = (hier->local_rank == 0);
+  CHECK_MPI_RET(
+    MPI_Comm_split(team_data->comm, is_leader ? 0 : MPI_UNDEFINED,
+                   team_data->unitid, &hier->leader_comm),
+    "MPI_Comm_split");
+  int node_info[2] = { 0, 0 };
+  if (is_leader) {
+    MPI_Comm_rank(hier->leader_comm, &node_info[0]);
+    MPI_Comm_size(hier->leader_comm, &node_info[1]);
+  }
+  CHECK_MPI_RET(
+    MPI_Bcast(node_info, 2, MPI_INT, 0, hier->node_comm),
+    "MPI_Bcast");
+  hier->node_id   = node_info[0];
+  hier->num_nodes = node_info[1];
+
+  // location of all units of the team
+  int  size      = team_data->size;
+  int  mine[2]   = { hier->node_id, hier->local_rank };
+  int *locations = malloc(2 * size * sizeof(int));
+  CHECK_MPI_RET(
+    MPI_Allgather(mine, 2, MPI_INT, locations, 2, MPI_INT, team_data->comm),
+    "MPI_Allgather");
+  hier->unit_node    = malloc(size * sizeof(int));
+  hier->unit_local   = malloc(size * sizeof(int));
+  hier->node_sizes   = calloc(hier->num_nodes, sizeof(int));
+  hier->node_offsets = malloc(hier->num_nodes * sizeof(int));
+  hier->counts       = malloc(hier->num_nodes * sizeof(int));
+  hier->displs       = malloc(hier->num_nodes * sizeof(int));
+  for (int u = 0; u < size; ++u) {
+    hier->unit_node[u]  = locations[2 * u];
+    hier->unit_local[u] = locations[2 * u + 1];
+    hier->node_sizes[hier->unit_node[u]]++;
+  }
+  free(locations);
+  int offset = 0;
+  for (int n = 0; n < hier->num_nodes; ++n) {
+    hier->node_offsets[n] = offset;
+    offset += hier->node_sizes[n];
+  }
+
+  // the same buffer size on all nodes keeps the choice of path consistent
+  hier->bufsize = dart__mpi__coll_hier_threshold * max_local_size;
+  char *baseptr;
+  CHECK_MPI_RET(
+    MPI_Win_allocate_shared(
+      is_leader ? 2 * hier->bufsize : 0, 1, MPI_INFO_NULL,
+      hier->node_comm, &baseptr, &hier->win),
+    "MPI_Win_allocate_shared");
+  MPI_Aint winseg_size;
+  int      disp_unit;
+  MPI_Win_shared_query(hier->win, 0, &winseg_size, &disp_unit, &hier->buf);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, hier->win);
+
+  DART_LOG_DEBUG("dart_coll_hier: team %d spans %d nodes, %d units on node %d",
+                 team_data->teamid, hier->num_nodes, hier->local_size,
+                 hier->node_id);
+  return hier;
+}
+
+/**
+ * Returns the buffer to be used by the next collective operation.
+ * Alternating between two buffers allows a single synchronization of the
+ * node after staging the data: a unit can only enter the next-but-one
+ * operation once all units of the node have left the current one.
+ */
+static inline char *
+hier_next_buffer(dart_coll_hier_t * hier)
+{
+  return hier->buf + (hier->epoch++ & 1) * hier->bufsize;
+}
+
+static inline void
+hier_node_sync(dart_coll_hier_t * hier)
+{
+  MPI_Win_sync(hier->win);
+  CHECK_MPI_RET(MPI_Barrier(hier->node_comm), "MPI_Barrier");
+  MPI_Win_sync(hier->win);
+}
+
+int
+dart__mpi__coll_hier_applicable(
+  dart_team_data_t * team_data,
+  size_t             nbytes,
+  size_t             nresults)
+{
+  if (nbytes == 0 || nbytes > dart__mpi__coll_hier_threshold) {
+    return 0;
+  }
+  if (dart__unlikely(team_data->coll_hier == NULL)) {
+    team_data->coll_hier = hier_setup(team_data);
+  }
+  dart_coll_hier_t *hier = team_data->coll_hier;
+  return hier->enabled && (nbytes * nresults <= hier->bufsize);
+}
+
+dart_ret_t
+dart__mpi__coll_hier_team_fini(
+  dart_team_data_t * team_data)
+{
+  dart_coll_hier_t *hier = team_data->coll_hier;
+  if (hier == NULL) {
+    return DART_OK;
+  }
+  if (hier->win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(hier->win);
+    MPI_Win_free(&hier->win);
+  }
+  if (hier->leader_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&hier->leader_comm);
+  }
+  free(hier->unit_node);
+  free(hier->unit_local);
+  free(hier->node_sizes);
+  free(hier->node_offsets);
+  free(hier->counts);
+  free(hier->displs);
+  free(hier);
+  team_data->coll_hier = NULL;
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_allreduce(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  int                nelem,
+  MPI_Datatype       dtype,
+  MPI_Op             op)
+{
+  dart_coll_hier_t *hier = team_data->coll_hier;
+  int type_size;
+  MPI_Type_size(dtype, &type_size);
+  size_t nbytes = (size_t)nelem * type_size;
+  char  *buf    = hier_next_buffer(hier);
+  // the leader reduces all contributions into the last slot
+  char  *result = buf + (hier->local_size - 1) * nbytes;
+
+  memcpy(buf + hier->local_rank * nbytes, sendbuf, nbytes);
+  hier_node_sync(hier);
+
+  if (hier->leader_comm != MPI_COMM_NULL) {
+    for (int i = hier->local_size - 2; i >= 0; --i) {
+      CHECK_MPI_RET(
+        MPI_Reduce_local(buf + i * nbytes, result, nelem, dtype, op),
+        "MPI_Reduce_local");
+    }
+    if (hier->num_nodes > 1) {
+      CHECK_MPI_RET(
+        MPI_Allreduce(MPI_IN_PLACE, result, nelem, dtype, op,
+                      hier->leader_comm),
+        "MPI_Allreduce");
+    }
+  }
+  hier_node_sync(hier);
+
+  memcpy(recvbuf, result, nbytes);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_bcast(
+  dart_team_data_t * team_data,
+  void             * data,
+  size_t             nbytes,
+  int                root)
+{
+  dart_coll_hier_t *hier      = team_data->coll_hier;
+  char             *buf       = hier_next_buffer(hier);
+  int               root_node = hier->unit_node[root];
+
+  if (team_data->unitid == root) {
+    memcpy(buf, data, nbytes);
+  }
+  if (root_node == hier->node_id) {
+    hier_node_sync(hier);
+  }
+  if (hier->leader_comm != MPI_COMM_NULL && hier->num_nodes > 1) {
+    CHECK_MPI_RET(
+      MPI_Bcast(buf, nbytes, MPI_BYTE, root_node, hier->leader_comm),
+      "MPI_Bcast");
+  }
+  hier_node_sync(hier);
+
+  if (team_data->unitid != root) {
+    memcpy(data, buf, nbytes);
+  }
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_allgather(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes)
+{
+  dart_coll_hier_t *hier = team_data->coll_hier;
+  char             *buf  = hier_next_buffer(hier);
+  char             *recv = recvbuf;
+
+  // contributions are arranged in node-major order in the shared buffer
+  if (sendbuf == NULL) {
+    sendbuf = recv + team_data->unitid * nbytes;
+  }
+  memcpy(buf + (hier->node_offsets[hier->node_id] + hier->local_rank) * nbytes,
+         sendbuf, nbytes);
+  hier_node_sync(hier);
+
+  if (hier->leader_comm != MPI_COMM_NULL && hier->num_nodes > 1) {
+    for (int n = 0; n < hier->num_nodes; ++n) {
+      hier->counts[n] = hier->node_sizes[n]   * nbytes;
+      hier->displs[n] = hier->node_offsets[n] * nbytes;
+    }
+    CHECK_MPI_RET(
+      MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                     buf, hier->counts, hier->displs, MPI_BYTE,
+                     hier->leader_comm),
+      "MPI_Allgatherv");
+  }
+  hier_node_sync(hier);
+
+  for (int u = 0; u < team_data->size; ++u) {
+    memcpy(recv + u * nbytes,
+           buf + (hier->node_offsets[hier->unit_node[u]]
+                    + hier->unit_local[u]) * nbytes,
+           nbytes);
+  }
+  return DART_OK;
+}
+
+#else /* DART_MPI_DISABLE_SHARED_WINDOWS */
+
+int
+dart__mpi__coll_hier_applicable(
+  dart_team_data_t * team_data,
+  size_t             nbytes,
+  size_t             nresults)
+{
+  (void)team_data;
+  (void)nbytes;
+  (void)nresults;
+  return 0;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_team_fini(
+  dart_team_data_t * team_data)
+{
+  (void)team_data;
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_allreduce(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  int                nelem,
+  MPI_Datatype       dtype,
+  MPI_Op             op)
+{
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_bcast(
+  dart_team_data_t * team_data,
+  void             * data,
+  size_t             nbytes,
+  int                root)
+{
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t
+dart__mpi__coll_hier_allgather(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes)
+{
+  return DART_ERR_INVAL;
+}
+
+#endif /* DART_MPI_DISABLE_SHARED_WINDOWS */
@@ -19,13 +19,17 @@
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_coalesce_priv.h>
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
+#include <dash/dart/base/mutex.h>
 
 #include <stdio.h>
 #include <mpi.h>
 #include <string.h>
+#include <stdlib.h>
 #include <limits.h>
 #include <math.h>
 #include <alloca.h>
@@ -97,8 +101,107 @@ struct dart_handle_struct
   dart_unit_t dest;
   uint8_t     num_reqs;
   bool        needs_flush;
+  struct dart_handle_struct * next; // free-list link while in the pool
 };
 
+/**
+ * Handles are taken from a pool that grows in chunks of
+ * \c DART_HANDLE_POOL_CHUNK handles and is only released in \c dart_exit,
+ * so issuing a non-blocking operation does not require a heap allocation.
+ */
+#define DART_HANDLE_POOL_CHUNK 256
+
+struct dart_handle_chunk
+{
+  struct dart_handle_chunk  * next;
+  struct dart_handle_struct   handles[DART_HANDLE_POOL_CHUNK];
+};
+
+static dart_mutex_t               handle_pool_mtx    = DART_MUTEX_INITIALIZER;
+static struct dart_handle_struct *handle_pool_free   = NULL;
+static struct dart_handle_chunk  *handle_pool_chunks = NULL;
+
+static dart_handle_t dart__mpi__handle_alloc()
+{
+  dart__base__mutex_lock(&handle_pool_mtx);
+  if (handle_pool_free == NULL) {
+    struct dart_handle_chunk *chunk = malloc(sizeof(struct dart_handle_chunk));
+    chunk->next        = handle_pool_chunks;
+    handle_pool_chunks = chunk;
+    for (int i = DART_HANDLE_POOL_CHUNK - 1; i >= 0; --i) {
+      chunk->handles[i].next = handle_pool_free;
+      handle_pool_free       = &chunk->handles[i];
+    }
+  }
+  dart_handle_t handle = handle_pool_free;
+  handle_pool_free     = handle->next;
+  dart__base__mutex_unlock(&handle_pool_mtx);
+
+  handle->reqs[0]      = MPI_REQUEST_NULL;
+  handle->reqs[1]      = MPI_REQUEST_NULL;
+  handle->win          = MPI_WIN_NULL;
+  handle->dest         = DART_UNDEFINED_UNIT_ID;
+  handle->num_reqs     = 0;
+  handle->needs_flush  = false;
+  handle->next         = NULL;
+  return handle;
+}
+
+static void dart__mpi__handle_release(dart_handle_t handle)
+{
+  dart__base__mutex_lock(&handle_pool_mtx);
+  handle->next     = handle_pool_free;
+  handle_pool_free = handle;
+  dart__base__mutex_unlock(&handle_pool_mtx);
+}
+
+/** Target of a group of operations that requires a flush for completion. */
+typedef struct {
+  MPI_Win     win;
+  dart_unit_t dest;
+} dart_flush_target_t;
+
+/**
+ * DART handle group collecting the requests of many non-blocking
+ * operations. The buffers are kept across completions so that a group
+ * reused in an iteration does not allocate once it reached its size.
+ */
+struct dart_handle_group_struct
+{
+  MPI_Request         * reqs;
+  size_t                num_reqs;
+  size_t                reqs_capacity;
+  dart_flush_target_t * targets;
+  size_t                num_targets;
+  size_t                targets_capacity;
+  struct dart_handle_group_struct * next; // free-list link while cached
+};
+
+/**
+ * Destroyed handle groups are cached together with their buffers so that
+ * groups created per iteration do not allocate in the steady state.
+ */
+static struct dart_handle_group_struct *handle_group_free = NULL;
+
+void dart__mpi__handle_pool_fini()
+{
+  dart__base__mutex_lock(&handle_pool_mtx);
+  while (handle_pool_chunks != NULL) {
+    struct dart_handle_chunk *chunk = handle_pool_chunks;
+    handle_pool_chunks = chunk->next;
+    free(chunk);
+  }
+  handle_pool_free = NULL;
+  while (handle_group_free != NULL) {
+    struct dart_handle_group_struct *group = handle_group_free;
+    handle_group_free = group->next;
+    free(group->reqs);
+    free(group->targets);
+    free(group);
+  }
+  dart__base__mutex_unlock(&handle_pool_mtx);
+}
+
 /**
  * Help to check for return of MPI call.
  * Since DART currently does not define an MPI error handler the abort will not
@@ -157,6 +260,18 @@ static dart_ret_t put_shared_mem(
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Issue operations to \c unit in \c win that are held back for
+ * aggregation to retain their order relative to a subsequent operation.
+ */
+static inline
+void flush_coalesced(MPI_Win win, dart_team_unit_t unit)
+{
+  if (dart__unlikely(dart__mpi__coalesce_threshold > 0)) {
+    dart__mpi__coalesce_flush(win, unit.id);
+  }
+}
+
 /**
  * Internal implementations of put/get with and without handles for
  * basic data types and complex data types.
@@ -246,6 +361,17 @@ dart__mpi__get_basic(
   offset          += dart_segment_disp(seginfo, team_unit_id);
   char * dest_ptr  = (char*) dest;
 
+  // small non-blocking gets without handle are subject to aggregation
+  if (reqs == NULL) {
+    size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+    if (dart__mpi__coalesce_applicable(nbytes)) {
+      DART_LOG_TRACE("dart_get:  queued (dest %p, size %zu)", dest, nbytes);
+      return dart__mpi__coalesce_get(
+               win, team_unit_id.id, offset, dest, nbytes);
+    }
+  }
+  flush_coalesced(win, team_unit_id);
+
   if (nchunks > 0) {
     DART_LOG_TRACE("dart_get:  MPI_Get (dest %p, size %zu)",
         dest_ptr, nchunks * MAX_CONTIG_ELEMENTS);
@@ -300,6 +426,8 @@ dart__mpi__get_complex(
   char * dest_ptr = (char*) dest;
   offset         += dart_segment_disp(seginfo, team_unit_id);
 
+  flush_coalesced(win, team_unit_id);
+
   MPI_Datatype src_mpi_type, dst_mpi_type;
   int src_num_elem, dst_num_elem;
   dart__mpi__datatype_convert_mpi(
@@ -324,13 +452,6 @@ dart__mpi__get_complex(
         win,
         reqs, num_reqs),
       "MPI_Rget");
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
-  }
   return DART_OK;
 }
 
@@ -378,6 +499,17 @@ dart__mpi__put_basic(
   offset                += dart_segment_disp(seginfo, team_unit_id);
   const char * src_ptr   = (const char*) src;
 
+  // small non-blocking puts without handle are subject to aggregation
+  if (reqs == NULL && flush_required_ptr == NULL) {
+    size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+    if (dart__mpi__coalesce_applicable(nbytes)) {
+      DART_LOG_TRACE("dart_put:  queued (src %p, size %zu)", src, nbytes);
+      return dart__mpi__coalesce_put(
+               win, team_unit_id.id, offset, src, nbytes);
+    }
+  }
+  flush_coalesced(win, team_unit_id);
+
   // chunk up the put
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -442,6 +574,8 @@ dart__mpi__put_complex(
   const char * src_ptr   = (const char*) src;
   offset                += dart_segment_disp(seginfo, team_unit_id);
 
+  flush_coalesced(win, team_unit_id);
+
   MPI_Datatype src_mpi_type, dst_mpi_type;
   int src_num_elem, dst_num_elem;
   dart__mpi__datatype_convert_mpi(
@@ -470,13 +604,6 @@ dart__mpi__put_complex(
         reqs, num_reqs),
       "MPI_Put");
 
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
-  }
   return DART_OK;
 }
 
@@ -889,22 +1016,213 @@ dart_ret_t dart_compare_and_swap(
   return DART_OK;
 }
 
+/**
+ * Target of an element of a bulk atomic operation, used to group the
+ * elements by team, segment and unit.
+ */
+typedef struct {
+  int16_t     teamid;
+  int16_t     segid;
+  dart_unit_t unitid;
+  size_t      idx;
+} dart_atomic_target_t;
+
+static int dart__mpi__atomic_target_cmp(const void *lhs_, const void *rhs_)
+{
+  const dart_atomic_target_t *lhs = lhs_;
+  const dart_atomic_target_t *rhs = rhs_;
+  if (lhs->teamid != rhs->teamid) return (lhs->teamid < rhs->teamid) ? -1 : 1;
+  if (lhs->segid  != rhs->segid)  return (lhs->segid  < rhs->segid)  ? -1 : 1;
+  if (lhs->unitid != rhs->unitid) return (lhs->unitid < rhs->unitid) ? -1 : 1;
+  // keep the order of elements with the same target
+  return (lhs->idx < rhs->idx) ? -1 : (lhs->idx > rhs->idx);
+}
+
+/**
+ * Issue \c nelem atomic operations grouped by target and complete them
+ * with a single flush per target. Performs compare-and-swap if
+ * \c compares is not \c NULL, accumulate if \c results is \c NULL and
+ * fetch-and-op otherwise.
+ */
+static dart_ret_t dart__mpi__atomic_bulk(
+  const dart_gptr_t * gptrs,
+  const void        * values,
+  const void        * compares,
+  void              * results,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op)
+{
+  if (nelem == 0) {
+    return DART_OK;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  MPI_Op       mpi_op    = (compares == NULL) ? dart__mpi__op(op, dtype)
+                                              : MPI_OP_NULL;
+  size_t       elsize    = dart__mpi__datatype_sizeof(dtype);
+
+  dart_atomic_target_t *targets = malloc(nelem * sizeof(*targets));
+  for (size_t i = 0; i < nelem; ++i) {
+    targets[i].teamid = gptrs[i].teamid;
+    targets[i].segid  = gptrs[i].segid;
+    targets[i].unitid = gptrs[i].unitid;
+    targets[i].idx    = i;
+  }
+  qsort(targets, nelem, sizeof(*targets), &dart__mpi__atomic_target_cmp);
+
+  // windows and units to flush, at most one per group of targets
+  MPI_Win     *flush_wins  = malloc(nelem * sizeof(MPI_Win));
+  dart_unit_t *flush_units = malloc(nelem * sizeof(dart_unit_t));
+  size_t       num_flush   = 0;
+
+  dart_ret_t           ret       = DART_OK;
+  dart_team_data_t    *team_data = NULL;
+  dart_segment_info_t *seginfo   = NULL;
+  MPI_Aint             disp    = 0;
+  for (size_t i = 0; i < nelem; ++i) {
+    const dart_atomic_target_t *target = &targets[i];
+    bool new_segment = (i == 0 ||
+                        target->teamid != targets[i-1].teamid ||
+                        target->segid  != targets[i-1].segid);
+    if (new_segment || target->unitid != targets[i-1].unitid) {
+      dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(target->unitid);
+      if (new_segment) {
+        team_data = dart_adapt_teamlist_get(target->teamid);
+        if (dart__unlikely(team_data == NULL)) {
+          DART_LOG_ERROR("%s ! failed: Unknown team %i!",
+                         __func__, target->teamid);
+          ret = DART_ERR_INVAL;
+          break;
+        }
+        seginfo = dart_segment_get_info(&(team_data->segdata), target->segid);
+        if (dart__unlikely(seginfo == NULL)) {
+          DART_LOG_ERROR("%s ! Unknown segment %i on team %i",
+                         __func__, target->segid, target->teamid);
+          ret = DART_ERR_INVAL;
+          break;
+        }
+      }
+      if (dart__unlikely(team_unit_id.id < 0 ||
+                         team_unit_id.id >= team_data->size)) {
+        DART_LOG_ERROR("%s ! failed: unitid out of range 0 <= %d < %d",
+                       __func__, team_unit_id.id, team_data->size);
+        ret = DART_ERR_INVAL;
+        break;
+      }
+      disp = dart_segment_disp(seginfo, team_unit_id);
+      flush_wins[num_flush]  = seginfo->win;
+      flush_units[num_flush] = target->unitid;
+      ++num_flush;
+    }
+
+    size_t      idx    = target->idx;
+    MPI_Aint    offset = disp + gptrs[idx].addr_or_offs.offset;
+    const char *value  = (const char *)values + idx * elsize;
+    if (compares != NULL) {
+      CHECK_MPI_RET(
+        MPI_Compare_and_swap(
+          value,
+          (const char *)compares + idx * elsize,
+          (char *)results + idx * elsize,
+          mpi_dtype, target->unitid, offset, seginfo->win),
+        "MPI_Compare_and_swap");
+    } else if (results != NULL) {
+      CHECK_MPI_RET(
+        MPI_Fetch_and_op(
+          value, (char *)results + idx * elsize,
+          mpi_dtype, target->unitid, offset, mpi_op, seginfo->win),
+        "MPI_Fetch_and_op");
+    } else {
+      CHECK_MPI_RET(
+        MPI_Accumulate(
+          value, 1, mpi_dtype, target->unitid, offset,
+          1, mpi_dtype, mpi_op, seginfo->win),
+        "MPI_Accumulate");
+    }
+  }
+
+  // complete the operations issued so far, even in case of an error
+  for (size_t i = 0; i < num_flush; ++i) {
+    CHECK_MPI_RET(
+      MPI_Win_flush(flush_units[i], flush_wins[i]), "MPI_Win_flush");
+  }
+
+  DART_LOG_DEBUG("%s > finished %zu operations on %zu targets",
+                 __func__, nelem, num_flush);
+
+  free(flush_units);
+  free(flush_wins);
+  free(targets);
+  return ret;
+}
+
+dart_ret_t dart_fetch_and_op_bulk(
+    const dart_gptr_t * gptrs,
+    const void        * values,
+    void              * results,
+    size_t              nelem,
+    dart_datatype_t     dtype,
+    dart_operation_t    op)
+{
+  if (dart__unlikely(op > DART_OP_LAST)) {
+    DART_LOG_ERROR("Custom reduction operators not allowed in "
+                   "dart_fetch_and_op_bulk!");
+    return DART_ERR_INVAL;
+  }
+  CHECK_IS_BASICTYPE(dtype);
+  return dart__mpi__atomic_bulk(
+           gptrs, values, NULL, results, nelem, dtype, op);
+}
+
+dart_ret_t dart_compare_and_swap_bulk(
+    const dart_gptr_t * gptrs,
+    const void        * values,
+    const void        * compares,
+    void              * results,
+    size_t              nelem,
+    dart_datatype_t     dtype)
+{
+  if (dtype > DART_TYPE_LONGLONG) {
+    DART_LOG_ERROR("dart_compare_and_swap_bulk ! failed: "
+        "only valid on integral types");
+    return DART_ERR_INVAL;
+  }
+  if (dart__unlikely(compares == NULL || results == NULL)) {
+    DART_LOG_ERROR("dart_compare_and_swap_bulk ! failed: "
+        "compare and result buffers required");
+    return DART_ERR_INVAL;
+  }
+  return dart__mpi__atomic_bulk(
+           gptrs, values, compares, results, nelem, dtype, DART_OP_UNDEFINED);
+}
+
 /* -- Non-blocking dart one-sided operations -- */
 
-dart_ret_t dart_get_handle(
-    void          * dest,
-    dart_gptr_t     gptr,
-    size_t          nelem,
-    dart_datatype_t src_type,
-    dart_datatype_t dst_type,
-    dart_handle_t * handleptr)
+/**
+ * Issue a non-blocking get of \c nelem elements from \c gptr into the
+ * request array \c reqs, which has to provide space for two requests.
+ * The window and target unit required to complete the operation are
+ * returned in \c win and \c unit.
+ */
+static inline
+dart_ret_t dart__mpi__get_nb(
+    void            * dest,
+    dart_gptr_t       gptr,
+    size_t            nelem,
+    dart_datatype_t   src_type,
+    dart_datatype_t   dst_type,
+    MPI_Request     * reqs,
+    uint8_t         * num_reqs,
+    MPI_Win         * win,
+    dart_unit_t     * unit)
 {
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t         offset = gptr.addr_or_offs.offset;
   int16_t          seg_id = gptr.segid;
   dart_team_t      teamid = gptr.teamid;
 
-  *handleptr = DART_HANDLE_NULL;
+  *num_reqs = 0;
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (dart__unlikely(team_data == NULL)) {
@@ -922,61 +1240,53 @@ dart_ret_t dart_get_handle(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win win  = seginfo->win;
-
-  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
-  handle->dest         = team_unit_id.id;
-  handle->win          = win;
-  handle->needs_flush  = false;
-
+  *win  = seginfo->win;
+  *unit = team_unit_id.id;
 
   DART_LOG_DEBUG("dart_get_handle() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
       team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
-  DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(handle));
-
-  dart_ret_t ret = DART_OK;
 
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
     // fast-path for basic types
     CHECK_EQUAL_BASETYPE(src_type, dst_type);
-    ret = dart__mpi__get_basic(team_data, team_unit_id, seginfo, dest,
-        offset, nelem, src_type,
-        handle->reqs, &handle->num_reqs);
+    return dart__mpi__get_basic(team_data, team_unit_id, seginfo, dest,
+        offset, nelem, src_type, reqs, num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
-        offset, nelem, src_type, dst_type,
-        handle->reqs, &handle->num_reqs);
+    return dart__mpi__get_complex(team_unit_id, seginfo, dest,
+        offset, nelem, src_type, dst_type, reqs, num_reqs);
   }
-
-  if (handle->num_reqs == 0) {
-    free(handle);
-    handle = DART_HANDLE_NULL;
-  }
-
-  *handleptr = handle;
-
-  DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d",
-                 (void*)(handle), team_unit_id.id);
-  return ret;
 }
 
-dart_ret_t dart_put_handle(
-  dart_gptr_t       gptr,
-  const void      * src,
-  size_t            nelem,
-  dart_datatype_t   src_type,
-  dart_datatype_t   dst_type,
-  dart_handle_t   * handleptr)
+/**
+ * Issue a non-blocking put of \c nelem elements from \c src to \c gptr into
+ * the request array \c reqs, which has to provide space for two requests.
+ * The window and target unit required to complete the operation are
+ * returned in \c win and \c unit, \c needs_flush is set if remote
+ * completion requires a flush.
+ */
+static inline
+dart_ret_t dart__mpi__put_nb(
+    dart_gptr_t       gptr,
+    const void      * src,
+    size_t            nelem,
+    dart_datatype_t   src_type,
+    dart_datatype_t   dst_type,
+    MPI_Request     * reqs,
+    uint8_t         * num_reqs,
+    MPI_Win         * win,
+    dart_unit_t     * unit,
+    bool            * needs_flush)
 {
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t     offset   = gptr.addr_or_offs.offset;
   int16_t      seg_id   = gptr.segid;
   dart_team_t  teamid   = gptr.teamid;
 
-  *handleptr = DART_HANDLE_NULL;
+  *num_reqs    = 0;
+  *needs_flush = true;
 
   CHECK_EQUAL_BASETYPE(src_type, dst_type);
 
@@ -996,125 +1306,424 @@ dart_ret_t dart_put_handle(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win win  = seginfo->win;
-
-  // chunk up the put
-  dart_handle_t handle   = calloc(1, sizeof(struct dart_handle_struct));
-  handle->dest           = team_unit_id.id;
-  handle->win            = win;
-  handle->needs_flush    = true;
-
-  dart_ret_t ret = DART_OK;
+  *win  = seginfo->win;
+  *unit = team_unit_id.id;
 
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
     // fast path for basic data types
-    CHECK_EQUAL_BASETYPE(src_type, dst_type);
-    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
-                               offset, nelem, src_type,
-                               handle->reqs,
-                               &handle->num_reqs,
-                               &handle->needs_flush);
+    return dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
+                                offset, nelem, src_type,
+                                reqs, num_reqs, needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
-                                 offset, nelem, src_type, dst_type,
-                                 handle->reqs,
-                                 &handle->num_reqs,
-                                 &handle->needs_flush);
+    return dart__mpi__put_complex(team_unit_id, seginfo, src,
+                                  offset, nelem, src_type, dst_type,
+                                  reqs, num_reqs, needs_flush);
   }
+}
 
-  if (handle->num_reqs == 0) {
-    free(handle);
-    handle = DART_HANDLE_NULL;
-  }
+dart_ret_t dart_get_handle(
+    void          * dest,
+    dart_gptr_t     gptr,
+    size_t          nelem,
+    dart_datatype_t src_type,
+    dart_datatype_t dst_type,
+    dart_handle_t * handleptr)
+{
+  MPI_Request reqs[2];
+  uint8_t     num_reqs = 0;
+  MPI_Win     win      = MPI_WIN_NULL;
+  dart_unit_t dest_id  = DART_UNDEFINED_UNIT_ID;
 
-  *handleptr = handle;
+  *handleptr = DART_HANDLE_NULL;
 
-  DART_LOG_TRACE("dart_put_handle > handle(%p) dest:%d",
-                 (void*)(handle), team_unit_id.id);
+  dart_ret_t ret = dart__mpi__get_nb(dest, gptr, nelem, src_type, dst_type,
+                                     reqs, &num_reqs, &win, &dest_id);
+
+  // only operations that are still in flight require a handle
+  if (num_reqs > 0) {
+    dart_handle_t handle = dart__mpi__handle_alloc();
+    memcpy(handle->reqs, reqs, num_reqs * sizeof(MPI_Request));
+    handle->num_reqs     = num_reqs;
+    handle->dest         = dest_id;
+    handle->win          = win;
+    handle->needs_flush  = false;
+    *handleptr = handle;
+  }
 
+  DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d",
+                 (void*)(*handleptr), dest_id);
   return ret;
 }
 
-/* -- Blocking dart one-sided operations -- */
-
-/**
- * \todo Check if MPI_Get_accumulate (MPI_NO_OP) yields better performance
- */
-dart_ret_t dart_put_blocking(
+dart_ret_t dart_put_handle(
   dart_gptr_t       gptr,
   const void      * src,
   size_t            nelem,
   dart_datatype_t   src_type,
-  dart_datatype_t   dst_type)
+  dart_datatype_t   dst_type,
+  dart_handle_t   * handleptr)
 {
-  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  uint64_t          offset       = gptr.addr_or_offs.offset;
-  int16_t           seg_id       = gptr.segid;
-  dart_team_t       teamid       = gptr.teamid;
-
-  CHECK_EQUAL_BASETYPE(src_type, dst_type);
+  MPI_Request reqs[2];
+  uint8_t     num_reqs    = 0;
+  MPI_Win     win         = MPI_WIN_NULL;
+  dart_unit_t dest_id     = DART_UNDEFINED_UNIT_ID;
+  bool        needs_flush = true;
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-  if (dart__unlikely(team_data == NULL)) {
-    DART_LOG_ERROR("dart_put_blocking ! failed: Unknown team %i!", gptr.teamid);
-    return DART_ERR_INVAL;
-  }
+  *handleptr = DART_HANDLE_NULL;
 
-  CHECK_UNITID_RANGE(team_unit_id, team_data);
+  dart_ret_t ret = dart__mpi__put_nb(gptr, src, nelem, src_type, dst_type,
+                                     reqs, &num_reqs, &win, &dest_id,
+                                     &needs_flush);
 
-  dart_segment_info_t *seginfo = dart_segment_get_info(
-                                    &(team_data->segdata), seg_id);
-  if (dart__unlikely(seginfo == NULL)) {
-    DART_LOG_ERROR("dart_put_blocking ! "
-                   "Unknown segment %i on team %i", seg_id, teamid);
-    return DART_ERR_INVAL;
+  // only operations that are still in flight require a handle
+  if (num_reqs > 0) {
+    dart_handle_t handle = dart__mpi__handle_alloc();
+    memcpy(handle->reqs, reqs, num_reqs * sizeof(MPI_Request));
+    handle->num_reqs     = num_reqs;
+    handle->dest         = dest_id;
+    handle->win          = win;
+    handle->needs_flush  = needs_flush;
+    *handleptr = handle;
   }
 
-  DART_LOG_DEBUG("dart_put_blocking() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
-                 team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
+  DART_LOG_TRACE("dart_put_handle > handle(%p) dest:%d",
+                 (void*)(*handleptr), dest_id);
 
-  MPI_Win win  = seginfo->win;
+  return ret;
+}
 
-  dart_ret_t ret = DART_OK;
-  bool needs_flush = false;
+/* -- Handle groups -- */
 
-  if (dart__mpi__datatype_iscontiguous(src_type) &&
-      dart__mpi__datatype_iscontiguous(dst_type)) {
-    // fast path for basic data types
-    CHECK_EQUAL_BASETYPE(src_type, dst_type);
-    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
-                               offset, nelem, src_type,
-                               NULL, NULL, &needs_flush);
-  } else {
-    // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
-                                 offset, nelem, src_type, dst_type,
-                                 NULL, NULL, &needs_flush);
+dart_ret_t dart_handle_group_create(
+  dart_handle_group_t * groupptr)
+{
+  if (groupptr == NULL) {
+    DART_LOG_ERROR("dart_handle_group_create ! group pointer is NULL");
+    return DART_ERR_INVAL;
+  }
+  dart__base__mutex_lock(&handle_pool_mtx);
+  dart_handle_group_t group = handle_group_free;
+  if (group != NULL) {
+    handle_group_free = group->next;
+  }
+  dart__base__mutex_unlock(&handle_pool_mtx);
+  if (group == NULL) {
+    group = calloc(1, sizeof(struct dart_handle_group_struct));
   }
+  group->num_reqs    = 0;
+  group->num_targets = 0;
+  group->next        = NULL;
+  *groupptr = group;
+  DART_LOG_DEBUG("dart_handle_group_create > group:%p", (void*)*groupptr);
+  return DART_OK;
+}
 
-  if (ret == DART_OK && needs_flush) {
-    DART_LOG_DEBUG("dart_put_blocking: MPI_Win_flush");
-    CHECK_MPI_RET(MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
+dart_ret_t dart_handle_group_destroy(
+  dart_handle_group_t * groupptr)
+{
+  if (groupptr == NULL || *groupptr == DART_HANDLE_GROUP_NULL) {
+    return DART_OK;
+  }
+  dart_handle_group_t group = *groupptr;
+  if (group->num_reqs > 0) {
+    DART_LOG_DEBUG("dart_handle_group_destroy: "
+                   "discarding %zu pending requests", group->num_reqs);
   }
+  dart__base__mutex_lock(&handle_pool_mtx);
+  group->next       = handle_group_free;
+  handle_group_free = group;
+  dart__base__mutex_unlock(&handle_pool_mtx);
+  *groupptr = DART_HANDLE_GROUP_NULL;
+  return DART_OK;
+}
 
-  DART_LOG_DEBUG("dart_put_blocking > finished");
-  return ret;
+dart_ret_t dart_handle_group_size(
+  dart_handle_group_t   group,
+  size_t              * size)
+{
+  *size = (group != DART_HANDLE_GROUP_NULL) ? group->num_reqs : 0;
+  return DART_OK;
 }
 
 /**
- * \todo Check if MPI_Accumulate (REPLACE) yields better performance
+ * Ensure the request array of a group provides space for \c n more
+ * requests.
  */
-dart_ret_t dart_get_blocking(
-  void            * dest,
-  dart_gptr_t       gptr,
-  size_t            nelem,
-  dart_datatype_t   src_type,
-  dart_datatype_t   dst_type)
+static inline
+void dart__mpi__group_reserve(
+  dart_handle_group_t group,
+  size_t              n)
 {
-  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  uint64_t          offset       = gptr.addr_or_offs.offset;
+  if (group->num_reqs + n > group->reqs_capacity) {
+    size_t capacity = (group->reqs_capacity > 0)
+                      ? 2 * group->reqs_capacity : 64;
+    while (capacity < group->num_reqs + n) {
+      capacity *= 2;
+    }
+    group->reqs = realloc(group->reqs, capacity * sizeof(MPI_Request));
+    group->reqs_capacity = capacity;
+  }
+}
+
+/**
+ * Register a target that has to be flushed for remote completion of the
+ * operations in a group. Consecutive operations on the same target are
+ * recorded once, remaining duplicates are removed on completion.
+ */
+static inline
+void dart__mpi__group_add_target(
+  dart_handle_group_t group,
+  MPI_Win             win,
+  dart_unit_t         dest)
+{
+  if (group->num_targets > 0) {
+    dart_flush_target_t *last = &group->targets[group->num_targets - 1];
+    if (last->win == win && last->dest == dest) {
+      return;
+    }
+  }
+  if (group->num_targets == group->targets_capacity) {
+    group->targets_capacity = (group->targets_capacity > 0)
+                              ? 2 * group->targets_capacity : 16;
+    group->targets = realloc(
+                       group->targets,
+                       group->targets_capacity * sizeof(dart_flush_target_t));
+  }
+  group->targets[group->num_targets].win  = win;
+  group->targets[group->num_targets].dest = dest;
+  group->num_targets++;
+}
+
+dart_ret_t dart_get_group(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t   group)
+{
+  if (dart__unlikely(group == DART_HANDLE_GROUP_NULL)) {
+    DART_LOG_ERROR("dart_get_group ! invalid handle group");
+    return DART_ERR_INVAL;
+  }
+  uint8_t     num_reqs = 0;
+  MPI_Win     win;
+  dart_unit_t dest_id;
+  dart__mpi__group_reserve(group, 2);
+  dart_ret_t ret = dart__mpi__get_nb(dest, gptr, nelem, src_type, dst_type,
+                                     group->reqs + group->num_reqs,
+                                     &num_reqs, &win, &dest_id);
+  group->num_reqs += num_reqs;
+  return ret;
+}
+
+dart_ret_t dart_put_group(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t   group)
+{
+  if (dart__unlikely(group == DART_HANDLE_GROUP_NULL)) {
+    DART_LOG_ERROR("dart_put_group ! invalid handle group");
+    return DART_ERR_INVAL;
+  }
+  uint8_t     num_reqs    = 0;
+  MPI_Win     win;
+  dart_unit_t dest_id;
+  bool        needs_flush = true;
+  dart__mpi__group_reserve(group, 2);
+  dart_ret_t ret = dart__mpi__put_nb(gptr, src, nelem, src_type, dst_type,
+                                     group->reqs + group->num_reqs,
+                                     &num_reqs, &win, &dest_id,
+                                     &needs_flush);
+  group->num_reqs += num_reqs;
+  if (num_reqs > 0 && needs_flush) {
+    dart__mpi__group_add_target(group, win, dest_id);
+  }
+  return ret;
+}
+
+dart_ret_t dart_handle_group_add(
+  dart_handle_group_t   group,
+  dart_handle_t       * handleptr)
+{
+  if (dart__unlikely(group == DART_HANDLE_GROUP_NULL)) {
+    DART_LOG_ERROR("dart_handle_group_add ! invalid handle group");
+    return DART_ERR_INVAL;
+  }
+  if (handleptr == NULL || *handleptr == DART_HANDLE_NULL) {
+    return DART_OK;
+  }
+  dart_handle_t handle = *handleptr;
+  dart__mpi__group_reserve(group, handle->num_reqs);
+  for (uint8_t i = 0; i < handle->num_reqs; ++i) {
+    group->reqs[group->num_reqs++] = handle->reqs[i];
+  }
+  if (handle->num_reqs > 0 && handle->needs_flush) {
+    dart__mpi__group_add_target(group, handle->win, handle->dest);
+  }
+  dart__mpi__handle_release(handle);
+  *handleptr = DART_HANDLE_NULL;
+  return DART_OK;
+}
+
+static int dart__mpi__flush_target_cmp(const void *lhs, const void *rhs)
+{
+  const dart_flush_target_t *l = lhs;
+  const dart_flush_target_t *r = rhs;
+  if (l->win != r->win) {
+    return ((uintptr_t)l->win < (uintptr_t)r->win) ? -1 : 1;
+  }
+  return (l->dest > r->dest) - (l->dest < r->dest);
+}
+
+/**
+ * Flush every target of a group exactly once and reset the group.
+ */
+static dart_ret_t dart__mpi__group_flush(
+  dart_handle_group_t group)
+{
+  if (group->num_targets > 1) {
+    qsort(group->targets, group->num_targets, sizeof(dart_flush_target_t),
+          &dart__mpi__flush_target_cmp);
+  }
+  for (size_t i = 0; i < group->num_targets; ++i) {
+    if (i > 0 &&
+        group->targets[i].win  == group->targets[i-1].win &&
+        group->targets[i].dest == group->targets[i-1].dest) {
+      continue;
+    }
+    DART_LOG_TRACE("dart_handle_group: MPI_Win_flush(dest: %d)",
+                   group->targets[i].dest);
+    if (MPI_Win_flush(group->targets[i].dest, group->targets[i].win)
+        != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_handle_group: MPI_Win_flush failed");
+      return DART_ERR_OTHER;
+    }
+  }
+  group->num_reqs    = 0;
+  group->num_targets = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_group_wait_local(
+  dart_handle_group_t group)
+{
+  if (group == DART_HANDLE_GROUP_NULL || group->num_reqs == 0) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart_handle_group_wait_local() group:%p requests:%zu",
+                 (void*)group, group->num_reqs);
+  if (MPI_Waitall(group->num_reqs, group->reqs, MPI_STATUSES_IGNORE)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_handle_group_wait_local: MPI_Waitall failed");
+    return DART_ERR_OTHER;
+  }
+  // remote completion is not required, the group is reset
+  group->num_reqs    = 0;
+  group->num_targets = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_group_wait(
+  dart_handle_group_t group)
+{
+  if (group == DART_HANDLE_GROUP_NULL || group->num_reqs == 0) {
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart_handle_group_wait() group:%p requests:%zu "
+                 "targets:%zu",
+                 (void*)group, group->num_reqs, group->num_targets);
+  if (MPI_Waitall(group->num_reqs, group->reqs, MPI_STATUSES_IGNORE)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_handle_group_wait: MPI_Waitall failed");
+    return DART_ERR_OTHER;
+  }
+  return dart__mpi__group_flush(group);
+}
+
+/* -- Blocking dart one-sided operations -- */
+
+/**
+ * \todo Check if MPI_Get_accumulate (MPI_NO_OP) yields better performance
+ */
+dart_ret_t dart_put_blocking(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
+{
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t          offset       = gptr.addr_or_offs.offset;
+  int16_t           seg_id       = gptr.segid;
+  dart_team_t       teamid       = gptr.teamid;
+
+  CHECK_EQUAL_BASETYPE(src_type, dst_type);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_put_blocking ! failed: Unknown team %i!", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_put_blocking ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_put_blocking() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
+                 team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
+
+  MPI_Win win  = seginfo->win;
+
+  dart_ret_t ret = DART_OK;
+  bool needs_flush = false;
+
+  if (dart__mpi__datatype_iscontiguous(src_type) &&
+      dart__mpi__datatype_iscontiguous(dst_type)) {
+    // fast path for basic data types
+    CHECK_EQUAL_BASETYPE(src_type, dst_type);
+    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
+                               offset, nelem, src_type,
+                               NULL, NULL, &needs_flush);
+  } else {
+    // slow path for complex data types
+    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+                                 offset, nelem, src_type, dst_type,
+                                 NULL, NULL, &needs_flush);
+  }
+
+  if (ret == DART_OK && needs_flush) {
+    DART_LOG_DEBUG("dart_put_blocking: MPI_Win_flush");
+    CHECK_MPI_RET(MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
+  }
+
+  DART_LOG_DEBUG("dart_put_blocking > finished");
+  return ret;
+}
+
+/**
+ * \todo Check if MPI_Accumulate (REPLACE) yields better performance
+ */
+dart_ret_t dart_get_blocking(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
+{
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t          offset       = gptr.addr_or_offs.offset;
   int16_t           seg_id       = gptr.segid;
   dart_team_t       teamid       = gptr.teamid;
 
@@ -1202,6 +1811,8 @@ dart_ret_t dart_flush(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  flush_coalesced(win, team_unit_id);
+
   DART_LOG_TRACE("dart_flush: MPI_Win_flush");
   CHECK_MPI_RET(
     MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
@@ -1247,6 +1858,10 @@ dart_ret_t dart_flush_all(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  if (dart__unlikely(dart__mpi__coalesce_threshold > 0)) {
+    dart__mpi__coalesce_flush_all(win);
+  }
+
   DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
   CHECK_MPI_RET(
     MPI_Win_flush_all(win), "MPI_Win_flush");
@@ -1294,6 +1909,8 @@ dart_ret_t dart_flush_local(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  flush_coalesced(win, team_unit_id);
+
   DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
   CHECK_MPI_RET(
     MPI_Win_flush_local(team_unit_id.id, win),
@@ -1336,6 +1953,10 @@ dart_ret_t dart_flush_local_all(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  if (dart__unlikely(dart__mpi__coalesce_threshold > 0)) {
+    dart__mpi__coalesce_flush_all(win);
+  }
+
   CHECK_MPI_RET(
     MPI_Win_flush_local_all(win),
     "MPI_Win_flush_local_all");
@@ -1372,7 +1993,7 @@ dart_ret_t dart_wait_local(
     } else {
       DART_LOG_TRACE("dart_wait_local:     handle->num_reqs == 0");
     }
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait_local > finished");
@@ -1406,7 +2027,7 @@ dart_ret_t dart_wait(
       DART_LOG_TRACE("dart_wait:     handle->num_reqs == 0");
     }
     /* Free handle resource */
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait > finished");
@@ -1473,7 +2094,7 @@ dart_ret_t dart_waitall_local(
         DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_release(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
@@ -1592,7 +2213,7 @@ dart_ret_t dart_waitall(
         DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
                        i, (void*)(handles[i]));
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_release(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
@@ -1658,7 +2279,7 @@ dart_ret_t dart_test_local(
 
   if (flag) {
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1695,7 +2316,7 @@ dart_ret_t dart_test(
       );
     }
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_release(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1742,7 +2363,7 @@ dart_ret_t dart_testall_local(
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_release(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1803,7 +2424,7 @@ dart_ret_t dart_testall(
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_release(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1820,12 +2441,55 @@ dart_ret_t dart_handle_free(
   dart_handle_t * handleptr)
 {
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
-    free(*handleptr);
+    dart__mpi__handle_release(*handleptr);
     *handleptr = DART_HANDLE_NULL;
   }
   return DART_OK;
 }
 
+dart_ret_t dart_handle_group_test_local(
+  dart_handle_group_t   group,
+  int32_t             * is_finished)
+{
+  *is_finished = 1;
+  if (group == DART_HANDLE_GROUP_NULL || group->num_reqs == 0) {
+    return DART_OK;
+  }
+  int flag;
+  if (dart__mpi__testall(group->num_reqs, group->reqs, &flag)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_handle_group_test_local: MPI_Testall failed");
+    return DART_ERR_OTHER;
+  }
+  if (flag) {
+    group->num_reqs    = 0;
+    group->num_targets = 0;
+  }
+  *is_finished = flag;
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_group_test(
+  dart_handle_group_t   group,
+  int32_t             * is_finished)
+{
+  *is_finished = 1;
+  if (group == DART_HANDLE_GROUP_NULL || group->num_reqs == 0) {
+    return DART_OK;
+  }
+  int flag;
+  if (dart__mpi__testall(group->num_reqs, group->reqs, &flag)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_handle_group_test: MPI_Testall failed");
+    return DART_ERR_OTHER;
+  }
+  *is_finished = flag;
+  if (flag) {
+    return dart__mpi__group_flush(group);
+  }
+  return DART_OK;
+}
+
 /* -- Dart collective operations -- */
 
 static int _dart_barrier_count = 0;
@@ -1874,6 +2538,14 @@ dart_ret_t dart_bcast(
 
   CHECK_UNITID_RANGE(root, team_data);
 
+  if (dart__mpi__datatype_iscontiguous(dtype) &&
+      dart__mpi__coll_hier_applicable(
+        team_data, nelem * dart__mpi__datatype_sizeof(dtype), 1)) {
+    return dart__mpi__coll_hier_bcast(
+             team_data, buf, nelem * dart__mpi__datatype_sizeof(dtype),
+             root.id);
+  }
+
   MPI_Comm comm = team_data->comm;
 
   // chunk up the bcast if necessary
@@ -2045,6 +2717,13 @@ dart_ret_t dart_allgather(
     return DART_ERR_INVAL;
   }
 
+  size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+  if (dart__mpi__coll_hier_applicable(team_data, nbytes, team_data->size)) {
+    return dart__mpi__coll_hier_allgather(
+             team_data, (sendbuf == recvbuf) ? NULL : sendbuf, recvbuf,
+             nbytes);
+  }
+
   if (sendbuf == recvbuf || NULL == sendbuf) {
     sendbuf = MPI_IN_PLACE;
   }
@@ -2195,6 +2874,22 @@ dart_ret_t dart_allreduce(
     DART_LOG_ERROR("dart_allreduce ! unknown teamid %d", team);
     return DART_ERR_INVAL;
   }
+
+  // the hierarchical path changes the order of reduction
+  int commute = 0;
+  if (op != DART_OP_REPLACE && op != DART_OP_NO_OP) {
+    MPI_Op_commutative(mpi_op, &commute);
+  }
+  if (commute) {
+    int type_size;
+    MPI_Type_size(mpi_dtype, &type_size);
+    if (dart__mpi__coll_hier_applicable(
+          team_data, nelem * type_size, 1)) {
+      return dart__mpi__coll_hier_allreduce(
+               team_data, sendbuf, recvbuf, nelem, mpi_dtype, mpi_op);
+    }
+  }
+
   MPI_Comm comm = team_data->comm;
   CHECK_MPI_RET(
     MPI_Allreduce(
@@ -2208,6 +2903,64 @@ dart_ret_t dart_allreduce(
   return DART_OK;
 }
 
+dart_ret_t dart_reduce_scatter(
+  const void       * sendbuf,
+  void             * recvbuf,
+  const size_t     * nrecvelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  DART_LOG_TRACE("dart_reduce_scatter() team:%d", team);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_reduce_scatter ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  /*
+   * MPI uses offset type int, do not reduce more than INT_MAX elements:
+   */
+  size_t nelem = 0;
+  int *irecvcounts = malloc(sizeof(int) * comm_size);
+  for (int i = 0; i < comm_size; i++) {
+    nelem += nrecvelem[i];
+    if (dart__unlikely(nrecvelem[i] > MAX_CONTIG_ELEMENTS ||
+                       nelem > MAX_CONTIG_ELEMENTS)) {
+      DART_LOG_ERROR(
+        "dart_reduce_scatter ! failed: nrecvelem[%i] (%zu) > INT_MAX", i,
+        nrecvelem[i]);
+      free(irecvcounts);
+      return DART_ERR_INVAL;
+    }
+    irecvcounts[i] = nrecvelem[i];
+  }
+
+  int ret = MPI_Reduce_scatter(
+              sendbuf,      // send buffer
+              recvbuf,      // receive buffer
+              irecvcounts,  // number of elements received by each unit
+              mpi_dtype,    // datatype
+              mpi_op,       // reduce operation
+              comm);
+  free(irecvcounts);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_reduce_scatter ! team:%d failed", team);
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_TRACE("dart_reduce_scatter > team:%d", team);
+  return DART_OK;
+}
+
 dart_ret_t dart_alltoall(
     const void *    sendbuf,
     void *          recvbuf,
@@ -2256,6 +3009,73 @@ dart_ret_t dart_alltoall(
   return DART_OK;
 }
 
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  /*
+   * MPI uses offset type int, convert counts and displacements:
+   */
+  int *isendcounts = malloc(sizeof(int) * comm_size * 4);
+  int *isenddispls = isendcounts + comm_size;
+  int *irecvcounts = isenddispls + comm_size;
+  int *irecvdispls = irecvcounts + comm_size;
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendelem[i] > MAX_CONTIG_ELEMENTS ||
+        senddispls[i] > MAX_CONTIG_ELEMENTS ||
+        nrecvelem[i] > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i] > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_ERROR(
+        "dart_alltoallv ! failed: counts or displacements of unit %i "
+        "exceed INT_MAX", i);
+      free(isendcounts);
+      return DART_ERR_INVAL;
+    }
+    isendcounts[i] = nsendelem[i];
+    isenddispls[i] = senddispls[i];
+    irecvcounts[i] = nrecvelem[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  if (MPI_Alltoallv(
+           sendbuf,
+           isendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           irecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    free(isendcounts);
+    return DART_ERR_OTHER;
+  }
+  free(isendcounts);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_reduce(
   const void        * sendbuf,
   void              * recvbuf,
@@ -2299,6 +3119,319 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Exscan");
+  return DART_OK;
+}
+
+/* -- Non-blocking collective operations -- */
+
+/**
+ * Allocate a handle for a non-blocking collective operation, which does not
+ * require a flush for completion.
+ */
+static inline
+dart_handle_t dart__mpi__coll_handle()
+{
+  return dart__mpi__handle_alloc();
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t     teamid,
+  dart_handle_t * handleptr)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: Unknown team: %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle();
+  CHECK_MPI_RET(
+    MPI_Ibarrier(team_data->comm, &handle->reqs[0]), "MPI_Ibarrier");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > handle:%p", (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  dart_handle_t handle = dart__mpi__coll_handle();
+  if (nchunks > 0) {
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, nchunks,
+                 dart__mpi__datatype_maxtype(dtype),
+                 root.id, comm, &handle->reqs[handle->num_reqs++]),
+      "MPI_Ibcast");
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  // always issue at least one request to have the handle complete properly
+  if (remainder > 0 || handle->num_reqs == 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                 &handle->reqs[handle->num_reqs++]),
+      "MPI_Ibcast");
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > root:%d team:%d nelem:%zu handle:%p",
+                 root.id, teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_iallgather() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallgather ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  // chunk up the allgather if necessary
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+  const char * send_ptr  = (const char*) sendbuf;
+        char * recv_ptr  = (char*) recvbuf;
+
+  MPI_Comm comm = team_data->comm;
+
+  dart_handle_t handle = dart__mpi__coll_handle();
+  if (nchunks > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_maxtype(dtype);
+    CHECK_MPI_RET(
+      MPI_Iallgather(
+          send_ptr,
+          nchunks,
+          mpi_dtype,
+          recv_ptr,
+          nchunks,
+          mpi_dtype,
+          comm,
+          &handle->reqs[handle->num_reqs++]),
+      "MPI_Iallgather");
+    if (sendbuf != MPI_IN_PLACE) {
+      send_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+    }
+    recv_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  // always issue at least one request to have the handle complete properly
+  if (remainder > 0 || handle->num_reqs == 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Iallgather(
+          send_ptr,
+          remainder,
+          mpi_dtype,
+          recv_ptr,
+          remainder,
+          mpi_dtype,
+          comm,
+          &handle->reqs[handle->num_reqs++]),
+      "MPI_Iallgather");
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_iallgather > team:%d nelem:%"PRIu64" handle:%p",
+                 teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%"PRIu64"",
+                 team, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  dart_handle_t handle = dart__mpi__coll_handle();
+  CHECK_MPI_RET(
+    MPI_Iallreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           team_data->comm,
+           &handle->reqs[0]),
+    "MPI_Iallreduce");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > team:%d nelem:%"PRIu64" handle:%p",
+                 team, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ialltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_ialltoall() team:%d nelem:%" PRIu64 "", teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  dart_handle_t handle = dart__mpi__coll_handle();
+  CHECK_MPI_RET(
+      MPI_Ialltoall(
+          sendbuf,
+          nelem,
+          mpi_dtype,
+          recvbuf,
+          nelem,
+          mpi_dtype,
+          team_data->comm,
+          &handle->reqs[0]),
+      "MPI_Ialltoall");
+  handle->num_reqs = 1;
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ialltoall > team:%d nelem:%" PRIu64 " handle:%p",
+                 teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
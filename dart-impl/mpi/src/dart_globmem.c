@@ -9,6 +9,7 @@
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/atomic.h>
+#include <dash/dart/base/mutex.h>
 #include <dash/dart/base/assert.h>
 
 #include <dash/dart/if/dart_types.h>
@@ -21,6 +22,7 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_coalesce_priv.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -34,6 +36,30 @@
  */
 MPI_Win dart_win_local_alloc;
 
+/* Minimum size of memory chunks added to the local allocation pool */
+#define DART_LOCAL_ALLOC_CHUNK_SIZE (1024UL*1024*16)
+
+/**
+ * Memory chunk attached to the dynamic window of \c DART_TEAM_ALL to serve
+ * local allocations once the pre-allocated pool is exhausted.
+ * Chunks are released as soon as their last allocation is free'd.
+ */
+typedef struct dart_local_alloc_chunk {
+  struct dart_buddy             * pool;
+  char                          * base;
+  MPI_Aint                        disp;
+  size_t                          size;
+  size_t                          num_allocs;
+  struct dart_local_alloc_chunk * next;
+} dart_local_alloc_chunk_t;
+
+static dart_local_alloc_chunk_t * local_alloc_chunks = NULL;
+static dart_mutex_t               local_alloc_mutex  = DART_MUTEX_INITIALIZER;
+/* Counters of released chunks, protected by local_alloc_mutex */
+static uint64_t                   local_alloc_released_allocs = 0;
+static uint64_t                   local_alloc_released_frees  = 0;
+static uint64_t                   local_alloc_released_hits   = 0;
+
 dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
 {
   int16_t segid = gptr.segid;
@@ -122,6 +148,131 @@ dart_ret_t dart_gptr_setflags(dart_gptr_t *gptr, uint16_t flags)
 }
 
 
+static dart_ret_t
+local_alloc_chunk_add(size_t nbytes, dart_local_alloc_chunk_t ** chunk_out)
+{
+  size_t size = DART_LOCAL_ALLOC_CHUNK_SIZE;
+  while (size < nbytes) {
+    size *= 2;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  char *base;
+  if (MPI_Alloc_mem(size, MPI_INFO_NULL, &base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memalloc: MPI_Alloc_mem of %zu bytes failed", size);
+    return DART_ERR_NOMEM;
+  }
+  if (MPI_Win_attach(team_data->window, base, size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memalloc: MPI_Win_attach of %zu bytes failed", size);
+    MPI_Free_mem(base);
+    return DART_ERR_OTHER;
+  }
+
+  dart_local_alloc_chunk_t *chunk = malloc(sizeof(dart_local_alloc_chunk_t));
+  chunk->pool       = dart_buddy_new(size);
+  chunk->base       = base;
+  chunk->size       = size;
+  chunk->num_allocs = 0;
+  chunk->next       = local_alloc_chunks;
+  MPI_Get_address(base, &chunk->disp);
+  local_alloc_chunks = chunk;
+
+  DART_LOG_DEBUG("dart_memalloc: added chunk of %zu bytes to local pool at %p",
+                 size, base);
+  *chunk_out = chunk;
+  return DART_OK;
+}
+
+static void
+local_alloc_chunk_release(dart_local_alloc_chunk_t * chunk, MPI_Win win)
+{
+  DART_LOG_DEBUG("dart_memfree: releasing chunk of %zu bytes at %p",
+                 chunk->size, chunk->base);
+  dart_mempool_stats_t chunk_stats;
+  dart_buddy_stats(chunk->pool, &chunk_stats);
+  local_alloc_released_allocs += chunk_stats.num_allocs;
+  local_alloc_released_frees  += chunk_stats.num_frees;
+  local_alloc_released_hits   += chunk_stats.num_cache_hits;
+
+  dart__mpi__coalesce_flush_all(win);
+  MPI_Win_detach(win, chunk->base);
+  MPI_Free_mem(chunk->base);
+  dart_buddy_delete(chunk->pool);
+  free(chunk);
+}
+
+/**
+ * Serve a local allocation from memory attached to the dynamic window,
+ * adding a new chunk if none of the existing chunks can hold \c nbytes.
+ * The resulting offset is the displacement in the dynamic window.
+ */
+static dart_ret_t
+local_alloc_dynamic(size_t nbytes, uint64_t * offset)
+{
+  dart_ret_t ret = DART_OK;
+  dart__base__mutex_lock(&local_alloc_mutex);
+  dart_local_alloc_chunk_t *chunk;
+  ssize_t chunk_offset = -1;
+  for (chunk = local_alloc_chunks; chunk != NULL; chunk = chunk->next) {
+    chunk_offset = dart_buddy_alloc(chunk->pool, nbytes);
+    if (chunk_offset >= 0) break;
+  }
+  if (chunk == NULL) {
+    ret = local_alloc_chunk_add(nbytes, &chunk);
+    if (ret == DART_OK) {
+      chunk_offset = dart_buddy_alloc(chunk->pool, nbytes);
+    }
+  }
+  if (ret == DART_OK) {
+    DART_ASSERT(chunk_offset >= 0);
+    chunk->num_allocs++;
+    *offset = chunk->disp + chunk_offset;
+  }
+  dart__base__mutex_unlock(&local_alloc_mutex);
+  return ret;
+}
+
+static dart_ret_t
+local_free_dynamic(uint64_t offset)
+{
+  dart_ret_t ret = DART_ERR_INVAL;
+  dart__base__mutex_lock(&local_alloc_mutex);
+  dart_local_alloc_chunk_t **pred = &local_alloc_chunks;
+  while (*pred != NULL) {
+    dart_local_alloc_chunk_t *chunk = *pred;
+    if (offset >= (uint64_t)chunk->disp &&
+        offset <  (uint64_t)chunk->disp + chunk->size) {
+      if (dart_buddy_free(chunk->pool, offset - chunk->disp) == 0) {
+        ret = DART_OK;
+        if (--chunk->num_allocs == 0) {
+          // return unused memory
+          *pred = chunk->next;
+          dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+          local_alloc_chunk_release(chunk, team_data->window);
+        }
+      }
+      break;
+    }
+    pred = &chunk->next;
+  }
+  dart__base__mutex_unlock(&local_alloc_mutex);
+  return ret;
+}
+
+void dart__mpi__local_alloc_release(MPI_Win win)
+{
+  dart__base__mutex_lock(&local_alloc_mutex);
+  while (local_alloc_chunks != NULL) {
+    dart_local_alloc_chunk_t *chunk = local_alloc_chunks;
+    local_alloc_chunks = chunk->next;
+    local_alloc_chunk_release(chunk, win);
+  }
+  local_alloc_released_allocs = 0;
+  local_alloc_released_frees  = 0;
+  local_alloc_released_hits   = 0;
+  dart__base__mutex_unlock(&local_alloc_mutex);
+}
+
 dart_ret_t dart_memalloc(
   size_t            nelem,
   dart_datatype_t   dtype,
@@ -136,11 +287,15 @@ dart_ret_t dart_memalloc(
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
   gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
   if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
-    DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
-                   nbytes);
-    *gptr = DART_GPTR_NULL;
-    return DART_ERR_OTHER;
+    // pre-allocated pool exhausted, grow the pool on demand
+    gptr->segid = DART_SEGMENT_LOCAL_DYNAMIC;
+    if (local_alloc_dynamic(nbytes, &gptr->addr_or_offs.offset) != DART_OK) {
+      DART_LOG_ERROR("dart_memalloc: Out of bounds "
+                     "(dart_buddy_alloc %zu bytes): global memory exhausted",
+                     nbytes);
+      *gptr = DART_GPTR_NULL;
+      return DART_ERR_OTHER;
+    }
   }
   DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
                  nbytes, gptr->addr_or_offs.offset);
@@ -149,13 +304,22 @@ dart_ret_t dart_memalloc(
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
+  if ((gptr.segid != DART_SEGMENT_LOCAL &&
+       gptr.segid != DART_SEGMENT_LOCAL_DYNAMIC) ||
+      gptr.teamid != DART_TEAM_ALL) {
     DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
                    gptr.segid, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (gptr.segid == DART_SEGMENT_LOCAL_DYNAMIC) {
+    if (local_free_dynamic(gptr.addr_or_offs.offset) != DART_OK) {
+      DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
+                     "invalid offset: %"PRIu64"",
+                     gptr.addr_or_offs.offset);
+      return DART_ERR_INVAL;
+    }
+  } else if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
@@ -166,6 +330,46 @@ dart_ret_t dart_memfree (dart_gptr_t gptr)
   return DART_OK;
 }
 
+dart_ret_t dart_memalloc_stats(dart_mempool_stats_t * stats)
+{
+  if (stats == NULL) {
+    DART_LOG_ERROR("dart_memalloc_stats: stats may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  dart_buddy_stats(dart_localpool, stats);
+
+  // include chunks added on demand
+  size_t bytes_free = stats->pool_size - stats->bytes_allocated
+                                       - stats->bytes_cached;
+  dart__base__mutex_lock(&local_alloc_mutex);
+  stats->num_allocs     += local_alloc_released_allocs;
+  stats->num_frees      += local_alloc_released_frees;
+  stats->num_cache_hits += local_alloc_released_hits;
+  for (dart_local_alloc_chunk_t *chunk = local_alloc_chunks;
+       chunk != NULL; chunk = chunk->next) {
+    dart_mempool_stats_t chunk_stats;
+    dart_buddy_stats(chunk->pool, &chunk_stats);
+    stats->pool_size       += chunk_stats.pool_size;
+    stats->bytes_allocated += chunk_stats.bytes_allocated;
+    stats->bytes_cached    += chunk_stats.bytes_cached;
+    stats->num_allocs      += chunk_stats.num_allocs;
+    stats->num_frees       += chunk_stats.num_frees;
+    stats->num_cache_hits  += chunk_stats.num_cache_hits;
+    bytes_free             += chunk_stats.pool_size
+                                - chunk_stats.bytes_allocated
+                                - chunk_stats.bytes_cached;
+    if (chunk_stats.largest_free_block > stats->largest_free_block) {
+      stats->largest_free_block = chunk_stats.largest_free_block;
+    }
+  }
+  dart__base__mutex_unlock(&local_alloc_mutex);
+  stats->fragmentation = (bytes_free > 0)
+                           ? 1.0 - ((double)stats->largest_free_block /
+                                    (double)bytes_free)
+                           : 0.0;
+  return DART_OK;
+}
+
 #ifdef DART_MPI_ENABLE_DYNAMIC_WINDOWS
 static dart_ret_t
 dart_team_memalloc_aligned_dynamic(
@@ -488,6 +692,7 @@ dart_ret_t dart_team_memfree(
           &team_data->segdata, segid, &sub_mem) != DART_OK) {
       return DART_ERR_INVAL;
     }
+    dart__mpi__coalesce_flush_all(win);
     /* Detach the window associated with sub-memory to be freed */
     if (sub_mem != NULL) {
       MPI_Win_detach(win, sub_mem);
@@ -515,6 +720,7 @@ dart_ret_t dart_team_memfree(
 #endif
   } else {
     // full allocation
+    dart__mpi__coalesce_flush_all(seginfo->win);
     if (MPI_Win_unlock_all(seginfo->win) != MPI_SUCCESS) {
       DART_LOG_ERROR("dart_team_memfree: MPI_Win_unlock_all failed");
       return DART_ERR_OTHER;
@@ -711,6 +917,7 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
+  dart__mpi__coalesce_flush_all(win);
   MPI_Win_detach(win, sub_mem);
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
@@ -17,6 +17,9 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
+#include <dash/dart/mpi/dart_coalesce_priv.h>
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
+#include <dash/dart/mpi/dart_synchronization_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
@@ -137,6 +140,33 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   return DART_OK;
 }
 
+/**
+ * Register the segment of local allocations that are served from memory
+ * attached to the dynamic window \c win once the pre-allocated pool is
+ * exhausted, see \c dart_memalloc.
+ */
+static
+dart_ret_t create_local_alloc_dynamic(dart_team_data_t *team_data, MPI_Win win)
+{
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                &team_data->segdata,
+                                DART_SEGMENT_LOCAL_DYNAMIC_ALLOC);
+  if (segment == NULL) {
+    return DART_ERR_OTHER;
+  }
+  segment->flags       = 1;
+  segment->size        = 0;
+  segment->baseptr     = NULL;
+  segment->win         = win;
+  segment->shmwin      = MPI_WIN_NULL;
+  // offsets are displacements in the dynamic window, i.e., addresses
+  segment->selfbaseptr = NULL;
+  segment->disp        = NULL;
+  segment->is_dynamic  = true;
+
+  return DART_OK;
+}
+
 static
 dart_ret_t do_init()
 {
@@ -164,6 +194,14 @@ dart_ret_t do_init()
     return DART_ERR_OTHER;
   }
 
+  if (dart__mpi__coalesce_init() != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
+  if (dart__mpi__coll_hier_init() != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
   dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
 
   /* Create a global translation table for all
@@ -198,6 +236,11 @@ dart_ret_t do_init()
    */
   MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
 
+  ret = create_local_alloc_dynamic(team_data, win);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -303,6 +346,12 @@ dart_ret_t dart_exit()
 
   dart_segment_info_t *seginfo = dart_segment_get_info(&team_data->segdata, 0);
 
+  dart__mpi__coalesce_flush_all(team_data->window);
+  dart__mpi__coalesce_flush_all(seginfo->win);
+
+  /* Release memory added to the local allocation pool on demand. */
+  dart__mpi__local_alloc_release(team_data->window);
+
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
     DART_LOG_ERROR("%2d: dart_exit: MPI_Win_unlock_all failed", unitid.id);
     return DART_ERR_OTHER;
@@ -314,6 +363,8 @@ dart_ret_t dart_exit()
   }
 
   /* -- Free up all the resources for dart programme -- */
+  dart__mpi__coll_hier_team_fini(team_data);
+  dart__mpi__destroylocks(team_data);
   MPI_Win_free(&seginfo->win);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /* Has MPI shared windows: */
@@ -342,6 +393,10 @@ dart_ret_t dart_exit()
 
   dart__mpi__op_fini();
 
+  dart__mpi__coalesce_fini();
+
+  dart__mpi__handle_pool_fini();
+
   if (_init_by_dart) {
     DART_LOG_DEBUG("%2d: dart_exit: MPI_Finalize", unitid.id);
     MPI_Finalize();
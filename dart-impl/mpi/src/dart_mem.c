@@ -8,6 +8,10 @@
  * The code was taken from https://github.com/cloudwu/buddy and
  * the right to use it has been kindly granted by the author.
  *
+ * Small blocks are served from per-thread caches of released blocks,
+ * grouped by size class. Threads only acquire the allocator's mutex
+ * to refill or drain their caches in batches and for allocations that
+ * exceed the cached size classes.
  */
 
 #include <dash/dart/mpi/dart_mem.h>
@@ -22,6 +26,15 @@
 #define DART_MEM_ALIGN_BITS 3
 #define DART_MEM_ALIGN_BYTES (1<<DART_MEM_ALIGN_BITS)
 
+// number of size classes served from thread caches (8 B ... 4 KiB)
+#define DART_MEM_CACHE_CLASSES 10
+// maximum number of blocks cached per thread and size class
+#define DART_MEM_CACHE_DEPTH   32
+// number of blocks moved between cache and tree at once
+#define DART_MEM_CACHE_BATCH   (DART_MEM_CACHE_DEPTH / 2)
+// blocks of a cached size class may not exceed this fraction of the pool
+#define DART_MEM_CACHE_POOL_FRACTION 1024
+
 enum {
  NODE_UNUSED = 0,
  NODE_USED   = 1,
@@ -29,8 +42,37 @@ enum {
  NODE_FULL   = 3
 };
 
+/**
+ * Released blocks cached by a single thread. Only the owning thread
+ * accesses the blocks, the statistics are read without synchronization
+ * in \c dart_buddy_stats.
+ */
+struct dart_buddy_cache {
+  uint64_t                  offsets[DART_MEM_CACHE_CLASSES]
+                                   [DART_MEM_CACHE_DEPTH];
+  int                       num_cached[DART_MEM_CACHE_CLASSES];
+  size_t                    bytes_cached;
+  uint64_t                  num_allocs;
+  uint64_t                  num_frees;
+  uint64_t                  num_hits;
+  struct dart_buddy       * owner;
+  struct dart_buddy_cache * next;
+};
+
 struct dart_buddy {
   dart_mutex_t mutex;
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_t cache_key;
+#endif
+  // list of thread caches, protected by mutex
+  struct dart_buddy_cache * caches;
+  // number of size classes served from thread caches
+  int cache_classes;
+  // statistics of the tree, protected by mutex
+  size_t   bytes_used;
+  uint64_t num_allocs;
+  uint64_t num_frees;
+  uint64_t num_hits;
   int level;
   uint8_t tree[1];
 };
@@ -59,11 +101,25 @@ num_level(size_t size)
   return level;
 }
 
+/**
+ * Node states are only modified while holding the mutex but are read
+ * concurrently in \c _block_size.
+ */
+static inline void
+_set_node(struct dart_buddy * self, int index, uint8_t state) {
+  __atomic_store_n(&self->tree[index], state, __ATOMIC_RELAXED);
+}
+
 static inline int
 is_pow_of_2(uint32_t x) {
   return !(x & (x - 1));
 }
 
+#ifdef DART_HAVE_PTHREADS
+static void
+_cache_release(void *cache);
+#endif
+
 struct dart_buddy *
 dart_buddy_new(size_t size)
 {
@@ -81,11 +137,39 @@ dart_buddy_new(size_t size)
 	self->level = level;
 	memset(self->tree, NODE_UNUSED, lsize * 2 - 1);
 	dart__base__mutex_init(&self->mutex);
+
+  self->bytes_used = 0;
+  self->num_allocs = 0;
+  self->num_frees  = 0;
+  self->num_hits   = 0;
+  self->cache_classes = 0;
+  while (self->cache_classes < DART_MEM_CACHE_CLASSES &&
+         ((size_t)1 << self->cache_classes) * DART_MEM_CACHE_POOL_FRACTION
+           <= lsize) {
+    self->cache_classes++;
+  }
+#ifdef DART_HAVE_PTHREADS
+  self->caches = NULL;
+  pthread_key_create(&self->cache_key, &_cache_release);
+#else
+  // single-threaded: one cache shared by all calls
+  self->caches = calloc(1, sizeof(struct dart_buddy_cache));
+  self->caches->owner = self;
+#endif
 	return self;
 }
 
 void
 dart_buddy_delete(struct dart_buddy * self) {
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_delete(self->cache_key);
+#endif
+  struct dart_buddy_cache *cache = self->caches;
+  while (cache != NULL) {
+    struct dart_buddy_cache *next = cache->next;
+    free(cache);
+    cache = next;
+  }
   dart__base__mutex_destroy(&self->mutex);
 	free(self);
 }
@@ -120,7 +204,7 @@ _mark_parent(struct dart_buddy * self, int index) {
     if (buddy > 0 && (self->tree[buddy] == NODE_USED ||
         self->tree[buddy] == NODE_FULL)) {
       index = (index + 1) / 2 - 1;
-      self->tree[index] = NODE_FULL;
+      _set_node(self, index, NODE_FULL);
     }
     else {
       return;
@@ -128,31 +212,21 @@ _mark_parent(struct dart_buddy * self, int index) {
   }
 }
 
-ssize_t
-dart_buddy_alloc(struct dart_buddy * self, size_t s) {
-  // honor the alignment
-  size_t size = (s >> DART_MEM_ALIGN_BITS);
-  if ((size<<DART_MEM_ALIGN_BITS) < s) ++size;
-  size = (int)next_pow_of_2(size);
+/**
+ * Allocate a block of \c size units from the tree, the mutex has to be held.
+ */
+static ssize_t
+_tree_alloc(struct dart_buddy * self, size_t size) {
   size_t length = 1 << self->level;
-
-  if (size > length) {
-    DART_LOG_ERROR("Allocation size larger than total allocator size (%zu > %zu)",
-                   s, length<<DART_MEM_ALIGN_BITS);
-    return -1;
-  }
-
   int index = 0;
   int level = 0;
 
-  dart__base__mutex_lock(&self->mutex);
-
   while (index >= 0) {
     if (size == length) {
       if (self->tree[index] == NODE_UNUSED) {
-        self->tree[index] = NODE_USED;
+        _set_node(self, index, NODE_USED);
         _mark_parent(self, index);
-        dart__base__mutex_unlock(&self->mutex);
+        self->bytes_used += size << DART_MEM_ALIGN_BITS;
         return _index_offset(index, level, self->level);
       }
     }
@@ -164,9 +238,9 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
         break;
       case NODE_UNUSED:
         // split first
-        self->tree[index] = NODE_SPLIT;
-        self->tree[index * 2 + 1] = NODE_UNUSED;
-        self->tree[index * 2 + 2] = NODE_UNUSED;
+        _set_node(self, index, NODE_SPLIT);
+        _set_node(self, index * 2 + 1, NODE_UNUSED);
+        _set_node(self, index * 2 + 2, NODE_UNUSED);
         // intentional fall-through (?)
       default:
         index = index * 2 + 1;
@@ -184,7 +258,6 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
       length *= 2;
       index = (index + 1) / 2 - 1;
       if (index < 0) {
-        dart__base__mutex_unlock(&self->mutex);
         return -1;
       }
       if (index & 1) {
@@ -193,11 +266,175 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
       }
     }
   }
+  return -1;
+}
+
+static int
+_tree_free(struct dart_buddy * self, uint64_t offset);
+
+/**
+ * Size in units of the allocated block at \c offset (in units) or 0 if
+ * there is no such block.
+ * The tree is traversed without holding the mutex: as long as the block is
+ * allocated, its ancestors are either split or full and the block itself
+ * remains in use, regardless of concurrent modifications elsewhere.
+ */
+static size_t
+_block_size(struct dart_buddy * self, uint64_t offset) {
+  size_t   length = (size_t)1 << self->level;
+  uint64_t left   = 0;
+  int      index  = 0;
+  for (;;) {
+    switch (__atomic_load_n(&self->tree[index], __ATOMIC_RELAXED)) {
+    case NODE_USED:
+      return (offset == left) ? length : 0;
+    case NODE_UNUSED:
+      return 0;
+    default:
+      length /= 2;
+      if (offset < left + length) {
+        index = index * 2 + 1;
+      }
+      else {
+        left += length;
+        index = index * 2 + 2;
+      }
+      break;
+    }
+  }
+}
 
+static struct dart_buddy_cache *
+_get_cache(struct dart_buddy * self) {
+#ifdef DART_HAVE_PTHREADS
+  struct dart_buddy_cache *cache = pthread_getspecific(self->cache_key);
+  if (dart__unlikely(cache == NULL)) {
+    cache = calloc(1, sizeof(struct dart_buddy_cache));
+    cache->owner = self;
+    dart__base__mutex_lock(&self->mutex);
+    cache->next  = self->caches;
+    self->caches = cache;
+    dart__base__mutex_unlock(&self->mutex);
+    pthread_setspecific(self->cache_key, cache);
+  }
+  return cache;
+#else
+  return self->caches;
+#endif
+}
+
+/**
+ * Return up to \c num cached blocks of size class \c cls to the tree,
+ * the mutex has to be held.
+ */
+static void
+_cache_drain(
+  struct dart_buddy       * self,
+  struct dart_buddy_cache * cache,
+  int                       cls,
+  int                       num) {
+  while (num-- > 0 && cache->num_cached[cls] > 0) {
+    uint64_t offset = cache->offsets[cls][--cache->num_cached[cls]];
+    _tree_free(self, offset >> DART_MEM_ALIGN_BITS);
+    cache->bytes_cached -= (size_t)DART_MEM_ALIGN_BYTES << cls;
+  }
+}
+
+static void
+_cache_drain_all(struct dart_buddy * self, struct dart_buddy_cache * cache) {
+  dart__base__mutex_lock(&self->mutex);
+  for (int cls = 0; cls < self->cache_classes; ++cls) {
+    _cache_drain(self, cache, cls, DART_MEM_CACHE_DEPTH);
+  }
   dart__base__mutex_unlock(&self->mutex);
-  DART_LOG_ERROR(
-    "Allocation larger than remaining available allocator memory (%zu)", s);
-  return -1;
+}
+
+#ifdef DART_HAVE_PTHREADS
+/**
+ * Called on thread exit: returns the thread's cached blocks to the tree.
+ */
+static void
+_cache_release(void *cache_) {
+  struct dart_buddy_cache *cache = cache_;
+  struct dart_buddy       *self  = cache->owner;
+  dart__base__mutex_lock(&self->mutex);
+  for (int cls = 0; cls < self->cache_classes; ++cls) {
+    _cache_drain(self, cache, cls, DART_MEM_CACHE_DEPTH);
+  }
+  self->num_allocs += cache->num_allocs;
+  self->num_frees  += cache->num_frees;
+  self->num_hits   += cache->num_hits;
+  struct dart_buddy_cache **pred = &self->caches;
+  while (*pred != cache) {
+    pred = &(*pred)->next;
+  }
+  *pred = cache->next;
+  dart__base__mutex_unlock(&self->mutex);
+  free(cache);
+}
+#endif
+
+ssize_t
+dart_buddy_alloc(struct dart_buddy * self, size_t s) {
+  // honor the alignment
+  size_t size = (s >> DART_MEM_ALIGN_BITS);
+  if ((size<<DART_MEM_ALIGN_BITS) < s) ++size;
+  // empty allocations occupy the smallest block (class 0)
+  if (size == 0) size = 1;
+  size = (int)next_pow_of_2(size);
+  size_t length = 1 << self->level;
+
+  if (size > length) {
+    DART_LOG_ERROR("Allocation size larger than total allocator size (%zu > %zu)",
+                   s, length<<DART_MEM_ALIGN_BITS);
+    return -1;
+  }
+
+  int cls = __builtin_ctzl(size);
+  if (cls < self->cache_classes) {
+    struct dart_buddy_cache *cache = _get_cache(self);
+    cache->num_allocs++;
+    if (cache->num_cached[cls] > 0) {
+      cache->num_hits++;
+    } else {
+      // refill the cache with a batch of blocks
+      dart__base__mutex_lock(&self->mutex);
+      while (cache->num_cached[cls] < DART_MEM_CACHE_BATCH) {
+        ssize_t offset = _tree_alloc(self, size);
+        if (offset < 0) break;
+        cache->offsets[cls][cache->num_cached[cls]++] = offset;
+        cache->bytes_cached += size << DART_MEM_ALIGN_BITS;
+      }
+      dart__base__mutex_unlock(&self->mutex);
+    }
+    if (cache->num_cached[cls] == 0) {
+      // the pool is exhausted, blocks held in this thread's cache may be
+      // merged into a sufficiently large block
+      _cache_drain_all(self, cache);
+      dart__base__mutex_lock(&self->mutex);
+      ssize_t offset = _tree_alloc(self, size);
+      dart__base__mutex_unlock(&self->mutex);
+      if (offset < 0) {
+        DART_LOG_DEBUG(
+          "Allocation larger than remaining available allocator memory (%zu)",
+          s);
+      }
+      return offset;
+    }
+    cache->bytes_cached -= size << DART_MEM_ALIGN_BITS;
+    return cache->offsets[cls][--cache->num_cached[cls]];
+  }
+
+  dart__base__mutex_lock(&self->mutex);
+  ssize_t offset = _tree_alloc(self, size);
+  self->num_allocs++;
+  dart__base__mutex_unlock(&self->mutex);
+
+  if (offset < 0) {
+    DART_LOG_DEBUG(
+      "Allocation larger than remaining available allocator memory (%zu)", s);
+  }
+  return offset;
 }
 
 static void
@@ -205,10 +442,10 @@ _combine(struct dart_buddy * self, int index) {
 	for (;;) {
 		int buddy = index - 1 + (index & 1) * 2;
 		if (buddy < 0 || self->tree[buddy] != NODE_UNUSED) {
-			self->tree[index] = NODE_UNUSED;
+			_set_node(self, index, NODE_UNUSED);
 			while (((index = (index + 1) / 2 - 1) >= 0) &&
              self->tree[index] == NODE_FULL){
-				self->tree[index] = NODE_SPLIT;
+				_set_node(self, index, NODE_SPLIT);
 			}
 			return;
 		}
@@ -216,36 +453,31 @@ _combine(struct dart_buddy * self, int index) {
 	}
 }
 
-int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
+/**
+ * Return the block at \c offset (in units) to the tree, the mutex has to be
+ * held.
+ */
+static int
+_tree_free(struct dart_buddy * self, uint64_t offset)
 {
-	int      length = 1 << self->level;
+	size_t   length = 1 << self->level;
 	uint64_t left   = 0;
 	int      index  = 0;
 
-	offset >>= DART_MEM_ALIGN_BITS;
-
-	if (offset >= (uint64_t)length) {
-		assert(offset < (uint64_t)length);
-		return -1;
-	}
-
-  dart__base__mutex_lock(&self->mutex);
   for (;;) {
     switch (self->tree[index]) {
     case NODE_USED:
       if (offset != left){
         assert (offset == left);
-        dart__base__mutex_unlock(&self->mutex);
         return -1;
       }
       _combine(self, index);
-      dart__base__mutex_unlock(&self->mutex);
+      self->bytes_used -= length << DART_MEM_ALIGN_BITS;
       return 0;
     case NODE_UNUSED:
       DART_LOG_ERROR("Invalid offset %lX in dart_buddy_free(alloc:%p)!",
                     offset, self);
       dart_abort(DART_EXIT_ABORT);
-      dart__base__mutex_unlock(&self->mutex);
       return -1;
     default:
       length /= 2;
@@ -260,14 +492,100 @@ int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
     }
   }
 
-  dart__base__mutex_unlock(&self->mutex);
-
   // TODO: is this ever reached?
   DART_LOG_ERROR("Failed to free buddy allocation!");
   dart_abort(DART_EXIT_ABORT);
   return -1;
 }
 
+int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
+{
+	int      length = 1 << self->level;
+
+	offset >>= DART_MEM_ALIGN_BITS;
+
+	if (offset >= (uint64_t)length) {
+		assert(offset < (uint64_t)length);
+		return -1;
+	}
+
+  size_t size = _block_size(self, offset);
+  if (size > 0 && __builtin_ctzl(size) < self->cache_classes) {
+    int cls = __builtin_ctzl(size);
+    struct dart_buddy_cache *cache = _get_cache(self);
+    uint64_t byte_offset = offset << DART_MEM_ALIGN_BITS;
+    for (int i = 0; i < cache->num_cached[cls]; ++i) {
+      if (cache->offsets[cls][i] == byte_offset) {
+        DART_LOG_ERROR("Invalid offset %lX in dart_buddy_free(alloc:%p): "
+                       "block has already been free'd!", offset, (void *)self);
+        return -1;
+      }
+    }
+    if (cache->num_cached[cls] == DART_MEM_CACHE_DEPTH) {
+      dart__base__mutex_lock(&self->mutex);
+      _cache_drain(self, cache, cls, DART_MEM_CACHE_BATCH);
+      dart__base__mutex_unlock(&self->mutex);
+    }
+    cache->offsets[cls][cache->num_cached[cls]++] = byte_offset;
+    cache->bytes_cached += size << DART_MEM_ALIGN_BITS;
+    cache->num_frees++;
+    return 0;
+  }
+
+  dart__base__mutex_lock(&self->mutex);
+  int ret = _tree_free(self, offset);
+  self->num_frees++;
+  dart__base__mutex_unlock(&self->mutex);
+  return ret;
+}
+
+static size_t
+_largest_free(struct dart_buddy * self, int index, size_t length) {
+  switch (self->tree[index]) {
+  case NODE_UNUSED:
+    return length;
+  case NODE_SPLIT: {
+    size_t left  = _largest_free(self, index * 2 + 1, length / 2);
+    size_t right = _largest_free(self, index * 2 + 2, length / 2);
+    return (left > right) ? left : right;
+  }
+  default:
+    return 0;
+  }
+}
+
+void dart_buddy_stats(struct dart_buddy * self, dart_mempool_stats_t * stats)
+{
+  size_t bytes_cached = 0;
+  size_t pool_size    = ((size_t)1 << self->level) << DART_MEM_ALIGN_BITS;
+
+  dart__base__mutex_lock(&self->mutex);
+  stats->num_allocs = self->num_allocs;
+  stats->num_frees  = self->num_frees;
+  stats->num_cache_hits = self->num_hits;
+  for (struct dart_buddy_cache *cache = self->caches;
+       cache != NULL; cache = cache->next) {
+    bytes_cached          += cache->bytes_cached;
+    stats->num_allocs     += cache->num_allocs;
+    stats->num_frees      += cache->num_frees;
+    stats->num_cache_hits += cache->num_hits;
+  }
+  size_t bytes_used = self->bytes_used;
+  size_t largest    = _largest_free(self, 0, (size_t)1 << self->level)
+                        << DART_MEM_ALIGN_BITS;
+  dart__base__mutex_unlock(&self->mutex);
+
+  // cached blocks are in use by the tree but available to the threads
+  stats->pool_size          = pool_size;
+  stats->bytes_allocated    = bytes_used - bytes_cached;
+  stats->bytes_cached       = bytes_cached;
+  stats->largest_free_block = largest;
+  stats->fragmentation      = (bytes_used < pool_size)
+                                ? 1.0 - ((double)largest /
+                                         (double)(pool_size - bytes_used))
+                                : 0.0;
+}
+
 int buddy_size(struct dart_buddy * self, uint64_t offset)
 {
 	uint64_t left   = 0;
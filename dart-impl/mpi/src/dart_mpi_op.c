@@ -51,6 +51,84 @@ DART_DEFINE_MINMAX_OP(float,            float)
 DART_DEFINE_MINMAX_OP(double,           double)
 DART_DEFINE_MINMAX_OP(longdouble,       long double)
 
+/*
+ * Value-index pairs of DART_OP_MINLOC, DART_OP_MAXLOC and
+ * DART_OP_MINMAXLOC. The predefined MPI_MINLOC and MPI_MAXLOC operate on
+ * pairs with an index of type int that cannot address global ranges of
+ * more than INT_MAX elements, so we provide our own operations on pairs
+ * with 64-bit indices.
+ */
+
+#define DART_NAME_LOC_PAIR(__name) dart__mpi_loc_pair_##__name##_t
+
+#define DART_NAME_LOC_OP(__kind, __name) dart__mpi_##__kind##_reduce_##__name
+
+/* the pair in takes precedence over the pair inout */
+#define DART_LOC_PAIR_PRECEDES(__in, __inout, __cmp, __idx_cmp)           \
+  ((__in).index >= 0 &&                                                    \
+   ((__inout).index < 0 ||                                                 \
+    (__in).value __cmp (__inout).value ||                                  \
+    ((__in).value == (__inout).value &&                                    \
+     (__in).index __idx_cmp (__inout).index)))
+
+#define DART_DEFINE_LOC_OPS(__name, __type)                                \
+typedef DART_OP_MINLOC_PAIR(__type) DART_NAME_LOC_PAIR(__name);            \
+                                                                           \
+static void DART_NAME_LOC_OP(minloc, __name)(                              \
+  void *in_, void *inout_, int *len_, MPI_Datatype *dptr_)                 \
+{                                                                          \
+  (void)(dptr_);                                                           \
+  const DART_NAME_LOC_PAIR(__name) *in    = in_;                           \
+  DART_NAME_LOC_PAIR(__name)       *inout = inout_;                        \
+  for (int i = 0; i < *len_; ++i) {                                        \
+    if (DART_LOC_PAIR_PRECEDES(in[i], inout[i], <, <))                     \
+      inout[i] = in[i];                                                    \
+  }                                                                        \
+}                                                                          \
+                                                                           \
+static void DART_NAME_LOC_OP(maxloc, __name)(                              \
+  void *in_, void *inout_, int *len_, MPI_Datatype *dptr_)                 \
+{                                                                          \
+  (void)(dptr_);                                                           \
+  const DART_NAME_LOC_PAIR(__name) *in    = in_;                           \
+  DART_NAME_LOC_PAIR(__name)       *inout = inout_;                        \
+  for (int i = 0; i < *len_; ++i) {                                        \
+    if (DART_LOC_PAIR_PRECEDES(in[i], inout[i], >, <))                     \
+      inout[i] = in[i];                                                    \
+  }                                                                        \
+}                                                                          \
+                                                                           \
+static void DART_NAME_LOC_OP(minmaxloc, __name)(                           \
+  void *in_, void *inout_, int *len_, MPI_Datatype *dptr_)                 \
+{                                                                          \
+  (void)(dptr_);                                                           \
+  const DART_NAME_LOC_PAIR(__name) *in    = in_;                           \
+  DART_NAME_LOC_PAIR(__name)       *inout = inout_;                        \
+  int                               len   = *len_;                         \
+  DART_ASSERT_MSG(                                                         \
+    (len % 2) == 0, "DART_OP_MINMAXLOC requires multiple of two elements");\
+  for (int i = 0; i < len; i += 2, in += 2, inout += 2) {                  \
+    if (DART_LOC_PAIR_PRECEDES(in[DART_OP_MINMAX_MIN],                     \
+                               inout[DART_OP_MINMAX_MIN], <, <))           \
+      inout[DART_OP_MINMAX_MIN] = in[DART_OP_MINMAX_MIN];                  \
+    if (DART_LOC_PAIR_PRECEDES(in[DART_OP_MINMAX_MAX],                     \
+                               inout[DART_OP_MINMAX_MAX], >, >))           \
+      inout[DART_OP_MINMAX_MAX] = in[DART_OP_MINMAX_MAX];                  \
+  }                                                                        \
+}
+
+DART_DEFINE_LOC_OPS(byte,             char)
+DART_DEFINE_LOC_OPS(short,            short int)
+DART_DEFINE_LOC_OPS(int,              int)
+DART_DEFINE_LOC_OPS(unsigned,         unsigned int)
+DART_DEFINE_LOC_OPS(long,             long)
+DART_DEFINE_LOC_OPS(unsignedlong,     unsigned long)
+DART_DEFINE_LOC_OPS(longlong,         long long)
+DART_DEFINE_LOC_OPS(unsignedlonglong, unsigned long long)
+DART_DEFINE_LOC_OPS(float,            float)
+DART_DEFINE_LOC_OPS(double,           double)
+DART_DEFINE_LOC_OPS(longdouble,       long double)
+
 static const char *dart_op_names[DART_OP_LAST] = {
   "DART_OP_UNDEFINED",
   "DART_OP_MIN",
@@ -65,11 +143,19 @@ static const char *dart_op_names[DART_OP_LAST] = {
   "DART_OP_BXOR",
   "DART_OP_LXOR",
   "DART_OP_REPLACE",
-  "DART_OP_NO_OP"
+  "DART_OP_NO_OP",
+  "DART_OP_MINLOC",
+  "DART_OP_MAXLOC",
+  "DART_OP_MINMAXLOC"
 };
 
 static MPI_Op dart__mpi_minmax_reduce_ops[DART_TYPE_LAST];
 
+static MPI_Op       dart__mpi_minloc_reduce_ops[DART_TYPE_LAST];
+static MPI_Op       dart__mpi_maxloc_reduce_ops[DART_TYPE_LAST];
+static MPI_Op       dart__mpi_minmaxloc_reduce_ops[DART_TYPE_LAST];
+static MPI_Datatype dart__mpi_loc_pair_types[DART_TYPE_LAST];
+
 MPI_Op dart__mpi__op_minmax(dart_operation_t op, dart_datatype_t type)
 {
   DART_ASSERT_MSG(op == DART_OP_MINMAX, "Unknown custom operation!");
@@ -77,6 +163,37 @@ MPI_Op dart__mpi__op_minmax(dart_operation_t op, dart_datatype_t type)
   return dart__mpi_minmax_reduce_ops[basetype];
 }
 
+MPI_Op dart__mpi__op_loc(dart_operation_t op, dart_datatype_t type)
+{
+  dart_datatype_t basetype = dart__mpi__datatype_base(type);
+  switch (op) {
+    case DART_OP_MINLOC    : return dart__mpi_minloc_reduce_ops[basetype];
+    case DART_OP_MAXLOC    : return dart__mpi_maxloc_reduce_ops[basetype];
+    case DART_OP_MINMAXLOC : return dart__mpi_minmaxloc_reduce_ops[basetype];
+    default                :
+      DART_ASSERT_MSG(false, "Unknown custom operation!");
+      return MPI_OP_NULL;
+  }
+}
+
+MPI_Datatype dart__mpi__op_loc_type(dart_datatype_t type)
+{
+  return dart__mpi_loc_pair_types[dart__mpi__datatype_base(type)];
+}
+
+#define DART_CREATE_LOC_OPS(__name, __dtype)                               \
+  do {                                                                     \
+    MPI_Op_create(&DART_NAME_LOC_OP(minloc, __name), true,                 \
+                  &dart__mpi_minloc_reduce_ops[__dtype]);                  \
+    MPI_Op_create(&DART_NAME_LOC_OP(maxloc, __name), true,                 \
+                  &dart__mpi_maxloc_reduce_ops[__dtype]);                  \
+    MPI_Op_create(&DART_NAME_LOC_OP(minmaxloc, __name), true,              \
+                  &dart__mpi_minmaxloc_reduce_ops[__dtype]);               \
+    MPI_Type_contiguous(sizeof(DART_NAME_LOC_PAIR(__name)), MPI_BYTE,      \
+                        &dart__mpi_loc_pair_types[__dtype]);               \
+    MPI_Type_commit(&dart__mpi_loc_pair_types[__dtype]);                   \
+  } while (0)
+
 dart_ret_t dart__mpi__op_init()
 {
   memset(hashtab, 0, sizeof(hashtab));
@@ -103,6 +220,18 @@ dart_ret_t dart__mpi__op_init()
   MPI_Op_create(&DART_NAME_MINMAX_OP(longdouble), true,
                 &dart__mpi_minmax_reduce_ops[DART_TYPE_LONG_DOUBLE]);
 
+  DART_CREATE_LOC_OPS(byte,             DART_TYPE_BYTE);
+  DART_CREATE_LOC_OPS(short,            DART_TYPE_SHORT);
+  DART_CREATE_LOC_OPS(int,              DART_TYPE_INT);
+  DART_CREATE_LOC_OPS(unsigned,         DART_TYPE_UINT);
+  DART_CREATE_LOC_OPS(long,             DART_TYPE_LONG);
+  DART_CREATE_LOC_OPS(unsignedlong,     DART_TYPE_ULONG);
+  DART_CREATE_LOC_OPS(longlong,         DART_TYPE_LONGLONG);
+  DART_CREATE_LOC_OPS(unsignedlonglong, DART_TYPE_ULONGLONG);
+  DART_CREATE_LOC_OPS(float,            DART_TYPE_FLOAT);
+  DART_CREATE_LOC_OPS(double,           DART_TYPE_DOUBLE);
+  DART_CREATE_LOC_OPS(longdouble,       DART_TYPE_LONG_DOUBLE);
+
   return DART_OK;
 }
 
@@ -127,6 +256,13 @@ dart_ret_t dart__mpi__op_fini()
   MPI_Op_free(&dart__mpi_minmax_reduce_ops[DART_TYPE_DOUBLE]);
   MPI_Op_free(&dart__mpi_minmax_reduce_ops[DART_TYPE_LONG_DOUBLE]);
 
+  for (dart_datatype_t type = DART_TYPE_BYTE; type < DART_TYPE_LAST; ++type) {
+    MPI_Op_free(&dart__mpi_minloc_reduce_ops[type]);
+    MPI_Op_free(&dart__mpi_maxloc_reduce_ops[type]);
+    MPI_Op_free(&dart__mpi_minmaxloc_reduce_ops[type]);
+    MPI_Type_free(&dart__mpi_loc_pair_types[type]);
+  }
+
   return DART_OK;
 }
 
@@ -9,6 +9,7 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <stdlib.h>
@@ -18,6 +19,23 @@
 
 #define DART_TYPE_NAMELEN 256
 
+#define DART_STRIDED_CACHE_SIZE 127
+
+/**
+ * Cache entry holding a committed MPI vector type for a strided DART type
+ * and a specific number of blocks.
+ */
+typedef struct dart_strided_cache_entry {
+  dart_datatype_t                   dart_type;
+  size_t                            num_blocks;
+  MPI_Datatype                      mpi_type;
+  struct dart_strided_cache_entry * next;
+} dart_strided_cache_entry_t;
+
+static dart_strided_cache_entry_t * strided_cache[DART_STRIDED_CACHE_SIZE];
+static dart_mutex_t strided_cache_mtx = DART_MUTEX_INITIALIZER;
+static void strided_cache_evict(dart_datatype_t dart_type);
+
 static const char* __dart_base_type_names[DART_TYPE_LAST+1] = {
   "UNDEFINED",
   "BYTE",
@@ -103,6 +121,8 @@ dart__mpi__datatype_init()
   init_basic_datatype(DART_TYPE_DOUBLE,       MPI_DOUBLE);
   init_basic_datatype(DART_TYPE_LONG_DOUBLE,  MPI_LONG_DOUBLE);
 
+  memset(strided_cache, 0, sizeof(strided_cache));
+
   return DART_OK;
 }
 
@@ -181,8 +201,8 @@ dart_type_create_strided(
 }
 
 
-MPI_Datatype
-dart__mpi__create_strided_mpi(
+static MPI_Datatype
+create_strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks)
 {
@@ -198,10 +218,67 @@ dart__mpi__create_strided_mpi(
   return new_mpi_dtype;
 }
 
-void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
+static inline int
+hash_strided(dart_datatype_t dart_type, size_t num_blocks)
 {
-  MPI_Type_free(mpi_type);
+  // the lower bits of the struct pointer carry no information
+  return (((uintptr_t)dart_type >> 4) ^ num_blocks) % DART_STRIDED_CACHE_SIZE;
+}
+
+MPI_Datatype
+dart__mpi__strided_mpi(
+  dart_datatype_t dart_type,
+  size_t          num_blocks)
+{
+  int slot = hash_strided(dart_type, num_blocks);
+  dart__base__mutex_lock(&strided_cache_mtx);
+  dart_strided_cache_entry_t *elem = strided_cache[slot];
+  while (elem != NULL) {
+    if (elem->dart_type == dart_type && elem->num_blocks == num_blocks) {
+      break;
+    }
+    elem = elem->next;
+  }
+
+  if (elem == NULL) {
+    elem = malloc(sizeof(*elem));
+    elem->dart_type  = dart_type;
+    elem->num_blocks = num_blocks;
+    elem->mpi_type   = create_strided_mpi(dart_type, num_blocks);
+    elem->next       = strided_cache[slot];
+    strided_cache[slot] = elem;
+    DART_LOG_TRACE("Cached MPI type for strided type %p with %zu blocks",
+                   (void*)dart_type, num_blocks);
+  }
+  MPI_Datatype mpi_type = elem->mpi_type;
+  dart__base__mutex_unlock(&strided_cache_mtx);
+
+  return mpi_type;
+}
+
+/**
+ * Free all cached MPI types created for \c dart_type or all cached types
+ * if \c dart_type is \c DART_TYPE_UNDEFINED.
+ */
+static void
+strided_cache_evict(dart_datatype_t dart_type)
+{
+  dart__base__mutex_lock(&strided_cache_mtx);
+  for (int slot = 0; slot < DART_STRIDED_CACHE_SIZE; ++slot) {
+    dart_strided_cache_entry_t **elem_ptr = &strided_cache[slot];
+    while (*elem_ptr != NULL) {
+      dart_strided_cache_entry_t *elem = *elem_ptr;
+      if (dart_type == DART_TYPE_UNDEFINED || elem->dart_type == dart_type) {
+        // pending operations using this type will still complete normally
+        MPI_Type_free(&elem->mpi_type);
+        *elem_ptr = elem->next;
+        free(elem);
+      } else {
+        elem_ptr = &elem->next;
+      }
+    }
+  }
+  dart__base__mutex_unlock(&strided_cache_mtx);
 }
 
 dart_ret_t
@@ -346,6 +423,8 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     if (dart_type->contiguous.max_type != DART_MPI_TYPE_UNDEFINED) {
       MPI_Type_free(&dart_type->contiguous.max_type);
     }
+  } else if (dart_type->kind == DART_KIND_STRIDED) {
+    strided_cache_evict(*dart_type_ptr);
   }
 
   free(dart_type);
@@ -364,6 +443,9 @@ static void destroy_basic_type(dart_datatype_t dart_type_id)
 dart_ret_t
 dart__mpi__datatype_fini()
 {
+  // release the MPI types of strided types that have not been destroyed
+  strided_cache_evict(DART_TYPE_UNDEFINED);
+
   destroy_basic_type(DART_TYPE_BYTE);
   destroy_basic_type(DART_TYPE_SHORT);
   destroy_basic_type(DART_TYPE_INT);
@@ -10,73 +10,53 @@
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
-  dart_segment_info_t  data;
-};
-
-
-static inline int hash_segid(dart_segid_t segid)
+static inline dart_segment_table_t *
+segment_table(dart_segmentdata_t *segdata, dart_segid_t segid)
 {
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
+  return (segid >= 0) ? &segdata->mem_segs : &segdata->reg_segs;
 }
 
-static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
-{
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
-}
-
-static dart_segment_info_t * get_segment(
-    dart_segmentdata_t *segdata,
-    dart_segid_t        segid)
+/**
+ * Returns the slot of segment \c segid in the table, allocating the
+ * containing block if necessary.
+ */
+static dart_segment_info_t *
+segment_slot(dart_segmentdata_t *segdata, dart_segid_t segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
+  dart_segment_table_t *tab = segment_table(segdata, segid);
+  int idx   = abs(segid);
+  int block = idx >> DART_SEGMENT_BLOCK_BITS;
+  if (tab->blocks[block] == NULL) {
+    dart_segment_info_t *entries = calloc(
+                                     DART_SEGMENT_BLOCK_SIZE,
+                                     sizeof(dart_segment_info_t));
+    for (int i = 0; i < DART_SEGMENT_BLOCK_SIZE; ++i) {
+      entries[i].segid = DART_SEGMENT_INVALID;
     }
-    elem = elem->next;
+    tab->blocks[block] = entries;
   }
-
-  if (elem == NULL) {
-    DART_LOG_ERROR("dart_segment__get_segment : "
-                   "Invalid segment ID %i on team %i",
-                   segid, segdata->team_id);
-    return NULL;
-  }
-
-  return &(elem->data);
+  return &tab->blocks[block][idx & (DART_SEGMENT_BLOCK_SIZE - 1)];
 }
 
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid)
+dart_segment_info_t * dart_segment__invalid(
+  const dart_segmentdata_t *segdata,
+  dart_segid_t              segid)
 {
-  return get_segment(segdata, segid);
+  DART_LOG_ERROR("dart_segment_get_info : "
+                 "Invalid segment ID %i on team %i",
+                 segid, segdata->team_id);
+  return NULL;
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment table.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  memset(&segdata->mem_segs, 0, sizeof(dart_segment_table_t));
+  memset(&segdata->reg_segs, 0, sizeof(dart_segment_table_t));
 
   segdata->team_id = teamid;
-  segdata->mem_freelist = NULL;
-  segdata->reg_freelist = NULL;
   segdata->memid = 1;
   segdata->registermemid = -1;
 
@@ -95,17 +75,14 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid = INT16_MAX;
-  dart_seghash_elem_t *elem = NULL;
   if (type == DART_SEGMENT_LOCAL_ALLOC) {
     // no need to check for overflow
     segid = DART_SEGMENT_LOCAL;
-    elem = calloc(1, sizeof(dart_seghash_elem_t));
-    elem->data.segid = segid;
+  } else if (type == DART_SEGMENT_LOCAL_DYNAMIC_ALLOC) {
+    segid = DART_SEGMENT_LOCAL_DYNAMIC;
   } else if (type == DART_SEGMENT_ALLOC) {
-    if (segdata->mem_freelist != NULL) {
-      elem  = segdata->mem_freelist;
-      segid = elem->data.segid;
-      segdata->mem_freelist = elem->next;
+    if (segdata->mem_segs.freelist_size > 0) {
+      segid = segdata->mem_segs.freelist[--segdata->mem_segs.freelist_size];
     } else {
       if (segdata->memid == INT16_MAX || segdata->memid <= 0) {
         DART_LOG_ERROR(
@@ -114,16 +91,12 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
-      elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
-    if (segdata->reg_freelist != NULL) {
-      elem  = segdata->reg_freelist;
-      segid = elem->data.segid;
-      segdata->reg_freelist = elem->next;
+    if (segdata->reg_segs.freelist_size > 0) {
+      segid = segdata->reg_segs.freelist[--segdata->reg_segs.freelist_size];
     } else {
-      if (segdata->registermemid == INT16_MIN || segdata->registermemid >= 0) {
+      if (segdata->registermemid <= DART_SEGMENT_LOCAL_DYNAMIC || segdata->registermemid >= 0) {
         DART_LOG_ERROR(
             "Failed to allocate segment ID, "
             "too many segments already registered? (registermemid: %i)",
@@ -131,19 +104,19 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
-      elem->data.segid = segid;
     }
   } else {
     // this should not happen!
     DART_ASSERT(type != DART_SEGMENT_REGISTER && type != DART_SEGMENT_ALLOC);
   }
 
-  register_segment(segdata, elem);
+  // released segments keep their buffers, which are re-used by the caller
+  dart_segment_info_t *seg = segment_slot(segdata, segid);
+  seg->segid = segid;
 
   DART_LOG_DEBUG("dart_segment_alloc > segid:%d team_id:%d",
                  segid, segdata->team_id);
-  return &(elem->data);
+  return seg;
 }
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
@@ -152,7 +125,7 @@ dart_ret_t dart_segment_get_shmwin(
     int16_t              segid,
     MPI_Win            * win)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("Invalid segment ID %i on team %i", segid, segdata->team_id);
     return DART_ERR_INVAL;
@@ -173,7 +146,7 @@ dart_ret_t dart_segment_get_disp(dart_segmentdata_t * segdata,
   DART_LOG_TRACE("dart_segment_get_disp() "
                  "seq_id:%d rel_unitid:%d", segid, rel_unitid.id);
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
 
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_disp ! Invalid segment ID %i on team %i",
@@ -194,7 +167,7 @@ dart_ret_t dart_segment_get_baseptr(
   dart_team_unit_t      rel_unitid,
   char              **  baseptr_s)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_baseptr ! Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
@@ -212,7 +185,7 @@ dart_ret_t dart_segment_get_selfbaseptr(
   char               ** baseptr)
 {
   *baseptr = NULL;
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_selfbaseptr ! "
                    "Invalid segment ID %i on team %i",
@@ -229,7 +202,7 @@ dart_ret_t dart_segment_get_size(
   int16_t               segid,
   size_t              * size)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -245,7 +218,7 @@ dart_ret_t dart_segment_get_flags(
   uint16_t           * flags)
 {
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -261,7 +234,7 @@ dart_ret_t dart_segment_set_flags(
   uint16_t             flags)
 {
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -297,84 +270,64 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
+  if (segid == DART_SEGMENT_LOCAL) {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+    return DART_ERR_INVAL;
+  }
 
-    pred = elem;
-    elem = elem->next;
+  dart_segment_info_t *seg = dart_segment_get_info(segdata, segid);
+  if (seg == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
 
-  // element not found
-  return DART_ERR_INVAL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  seg->segid = DART_SEGMENT_INVALID;
+
+  dart_segment_table_t *tab = segment_table(segdata, segid);
+  if (tab->freelist_size == tab->freelist_capacity) {
+    tab->freelist_capacity = (tab->freelist_capacity == 0)
+                                ? DART_SEGMENT_BLOCK_SIZE
+                                : 2 * tab->freelist_capacity;
+    tab->freelist = realloc(tab->freelist,
+                            tab->freelist_capacity * sizeof(dart_segid_t));
+  }
+  tab->freelist[tab->freelist_size++] = segid;
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void
+clear_segment_table(dart_segment_table_t *tab)
 {
-  dart_seghash_elem_t *elem = listhead;
-  while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
-    elem = tmp->next;
-    tmp->next = NULL;
-    // segment info should have been cleared in dart_segment_fini
-    if (tmp->data.segid != DART_SEGMENT_LOCAL) {
-      free_segment_info(&tmp->data);
+  for (int b = 0; b < DART_SEGMENT_NUM_BLOCKS; ++b) {
+    dart_segment_info_t *entries = tab->blocks[b];
+    if (entries == NULL) {
+      continue;
+    }
+    for (int i = 0; i < DART_SEGMENT_BLOCK_SIZE; ++i) {
+      free_segment_info(&entries[i]);
     }
-    free(tmp);
+    free(entries);
+    tab->blocks[b] = NULL;
   }
+  free(tab->freelist);
+  tab->freelist          = NULL;
+  tab->freelist_size     = 0;
+  tab->freelist_capacity = 0;
 }
 
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment table.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
 {
-  // only clear up the local allocation segment in DART_TEAM_ALL
-  if (segdata->team_id == DART_TEAM_ALL) {
-    dart_segment_info_t *seg = get_segment(
-                        &(dart_adapt_teamlist_get(DART_TEAM_ALL)->segdata),
-                        DART_SEGMENT_LOCAL);
-    free_segment_info(seg);
-  }
-
-  // clear the remaining hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
-  }
-  clear_segdata_list(segdata->mem_freelist);
-  segdata->mem_freelist = NULL;
-
-  clear_segdata_list(segdata->reg_freelist);
-  segdata->reg_freelist = NULL;
+  // releases all segments including the local allocation segment in
+  // DART_TEAM_ALL
+  clear_segment_table(&segdata->mem_segs);
+  clear_segment_table(&segdata->reg_segs);
 
   return DART_OK;
 }
@@ -2,6 +2,21 @@
  *  \file  dart_synchronization.c
  *
  *  Synchronization operations.
+ *
+ *  Locks are MCS queue locks: a unit acquiring a lock appends itself to the
+ *  queue of waiting units by swapping its ID into the tail of the lock and
+ *  then spins on a flag in its own memory until its predecessor hands the
+ *  lock over by clearing that flag.
+ *
+ *  The state of all locks of a team is kept in a lock pool of the team that
+ *  consists of blocks of \c DART_LOCK_BLOCK_SLOTS lock slots on every unit.
+ *  Every lock occupies one slot, the tail and the reader count of a lock
+ *  are stored in the slot of its home unit, which is determined by the slot
+ *  index to spread the tails of many locks across the units of the team.
+ *
+ *  With shared memory windows, the lock state of units on the same node is
+ *  accessed through shared memory. If all units of the team are located on
+ *  the same node, no MPI communication is involved at all.
  */
 
 #include <dash/dart/base/logging.h>
@@ -15,129 +30,444 @@
 #include <dash/dart/if/dart_synchronization.h>
 
 #include <dash/dart/mpi/dart_team_private.h>
-#include <dash/dart/mpi/dart_mem.h>
-#include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_synchronization_priv.h>
-#include <dash/dart/mpi/dart_segment.h>
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <unistd.h>
-#include <malloc.h>
+#include <stdbool.h>
+#include <sched.h>
+
+
+/** Number of lock slots in a block of the lock pool of a team. */
+#define DART_LOCK_BLOCK_SLOTS  64
+
+/** Fields of a lock slot */
+enum {
+  /** unit at the tail of the queue (home unit only), -1 if free */
+  DART_LOCK_TAIL = 0,
+  /** the unit's successor in the queue, -1 if unknown */
+  DART_LOCK_NEXT,
+  /** non-zero while the unit waits for the lock to be handed over */
+  DART_LOCK_WAIT,
+  /** number of readers and writer flag (home unit only) */
+  DART_LOCK_RW,
+  DART_LOCK_NUM_FIELDS
+};
 
+/** Flag set in the reader count while a writer holds or claims the lock */
+#define DART_LOCK_WRITER  (1 << 30)
+
+#define DART_LOCK_SLOT_SIZE  (DART_LOCK_NUM_FIELDS * sizeof(int32_t))
+
+#define CHECK_MPI_RET(__call, __name)                      \
+  do {                                                     \
+    if (dart__unlikely(__call != MPI_SUCCESS)) {           \
+      DART_LOG_ERROR("%s ! %s failed!", __func__, __name); \
+      dart_abort(DART_EXIT_ABORT);                         \
+    }                                                      \
+  } while (0)
+
+typedef struct dart_lock_block {
+  /** Window spanning the block on all units of the team */
+  MPI_Win    win;
+  /** The slots of this block at the calling unit */
+  int32_t  * base;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  /** Shared memory window of the block on the node */
+  MPI_Win    shmwin;
+  /** The slots of this block at all units on the node */
+  int32_t ** node_base;
+#endif
+} dart_lock_block_t;
+
+struct dart_lock_pool {
+  dart_lock_block_t * blocks;
+  int                 num_blocks;
+  /** Free slots, identical on all units as locks are created collectively */
+  int32_t           * free_slots;
+  int                 num_free;
+  /** Whether all units of the team share a node */
+  bool                node_local;
+};
 
 struct dart_lock_struct
 {
   /**
-   * Global memory storing the unit at the tail of lock queue.
-   * Stored in team-unit 0 by default.
+   * The lock pool of the team, \c NULL after the team has been destroyed.
    */
-  dart_gptr_t  gptr_tail;
-  /**
-   * Pointer to the current unit's successor in the waiting list,
-   * to which we send a release message.
-   */
-  dart_gptr_t  gptr_list;
+  struct dart_lock_pool   * pool;
   /**
    * Pointer to the next element a the list.
    */
-  struct dart_lock_struct *next;
+  struct dart_lock_struct * next;
   /**
    * Local mutex to ensure mutual exclusion between threads.
    */
-  dart_mutex_t mutex;
-  dart_team_t teamid;
+  dart_mutex_t              mutex;
+  dart_team_t               teamid;
+  /** Index of the slot of this lock in the lock pool. */
+  int32_t                   slot;
+  /** Unit holding the tail and the reader count of this lock. */
+  dart_team_unit_t          home;
+  /** Whether the lock supports shared acquisition. */
+  bool                      is_rw;
   /** Whether this unit has acquired the lock. */
-  int32_t is_acquired;
+  int32_t                   is_acquired;
 };
 
-static dart_ret_t destroy_lock_segments(dart_lock_t lock);
+static inline
+dart_lock_block_t * lock_block(dart_lock_t lock)
+{
+  return &lock->pool->blocks[lock->slot / DART_LOCK_BLOCK_SLOTS];
+}
 
-dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
+static inline
+MPI_Aint lock_disp(dart_lock_t lock, int field)
 {
-  int ret;
-  dart_gptr_t gptr_tail;
-  dart_gptr_t gptr_list;
-  dart_team_unit_t unitid;
+  return (lock->slot % DART_LOCK_BLOCK_SLOTS) * DART_LOCK_SLOT_SIZE
+         + field * sizeof(int32_t);
+}
 
-  *lock = DART_LOCK_NULL;
+/**
+ * Pointer to the \c field of the lock's slot at \c unit or \c NULL if the
+ * slot is not accessible through shared memory.
+ */
+static inline
+int32_t * lock_field_ptr(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  int                field)
+{
+  dart_lock_block_t *block = lock_block(lock);
+  int offset = (lock->slot % DART_LOCK_BLOCK_SLOTS) * DART_LOCK_NUM_FIELDS
+               + field;
+  if (unit.id == team_data->unitid) {
+    return block->base + offset;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_team_unit_t luid = team_data->sharedmem_tab[unit.id];
+  if (luid.id >= 0) {
+    return block->node_base[luid.id] + offset;
+  }
+#endif
+  return NULL;
+}
 
+/**
+ * Atomic read-modify-write operation on a field that is concurrently
+ * modified by multiple units. All units have to use the same mechanism,
+ * i.e., shared memory atomics are only used if the whole team is on one
+ * node.
+ */
+static int32_t lock_fetch_op(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  int                field,
+  int32_t            value,
+  MPI_Op             op)
+{
+  int32_t result;
+  if (lock->pool->node_local) {
+    int32_t *ptr = lock_field_ptr(team_data, lock, unit, field);
+    if (op == MPI_REPLACE) {
+      result = __atomic_exchange_n(ptr, value, __ATOMIC_ACQ_REL);
+    } else if (op == MPI_SUM) {
+      result = __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+    } else {
+      result = __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    }
+    return result;
+  }
+  MPI_Win win = lock_block(lock)->win;
+  CHECK_MPI_RET(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT32_T, unit.id, lock_disp(lock, field), op, win),
+    "MPI_Fetch_and_op");
+  CHECK_MPI_RET(MPI_Win_flush(unit.id, win), "MPI_Win_flush");
+  return result;
+}
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
-  if (team_data == NULL) {
-    return DART_ERR_INVAL;
+static int32_t lock_compare_and_swap(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  int                field,
+  int32_t            compare,
+  int32_t            value)
+{
+  int32_t result = compare;
+  if (lock->pool->node_local) {
+    int32_t *ptr = lock_field_ptr(team_data, lock, unit, field);
+    __atomic_compare_exchange_n(
+      ptr, &result, value, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return result;
   }
+  MPI_Win win = lock_block(lock)->win;
+  CHECK_MPI_RET(
+    MPI_Compare_and_swap(
+      &value, &compare, &result, MPI_INT32_T, unit.id,
+      lock_disp(lock, field), win),
+    "MPI_Compare_and_swap");
+  CHECK_MPI_RET(MPI_Win_flush(unit.id, win), "MPI_Win_flush");
+  return result;
+}
 
-  dart_team_myid(teamid, &unitid);
+/**
+ * Write to a field that has a single writer at a time and is only read by
+ * the unit owning it, which allows using shared memory for units on the
+ * same node.
+ */
+static void lock_store(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  int                field,
+  int32_t            value)
+{
+  int32_t *ptr = lock_field_ptr(team_data, lock, unit, field);
+  if (ptr != NULL) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+    return;
+  }
+  MPI_Win win = lock_block(lock)->win;
+  CHECK_MPI_RET(
+    MPI_Accumulate(
+      &value, 1, MPI_INT32_T, unit.id, lock_disp(lock, field),
+      1, MPI_INT32_T, MPI_REPLACE, win),
+    "MPI_Accumulate");
+  CHECK_MPI_RET(MPI_Win_flush(unit.id, win), "MPI_Win_flush");
+}
 
+/**
+ * Make updates through MPI visible and trigger progress on requests of
+ * other units targeting the calling unit, which some MPI implementations
+ * only process inside of MPI calls.
+ */
+static inline void lock_progress(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock)
+{
+  if (!lock->pool->node_local) {
+    int flag;
+    MPI_Win_sync(lock_block(lock)->win);
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &flag, MPI_STATUS_IGNORE);
+  }
+}
 
-  /* Unit 0 is the process holding the gptr_tail by default. */
-  if (unitid.id == 0) {
-    int32_t *tail_ptr;
-    ret = dart_memalloc(1, DART_TYPE_INT, &gptr_tail);
-    if (ret != DART_OK) {
-      DART_LOG_ERROR("%s: Failed to allocate global memory!", __func__);
-      return ret;
-    }
-    DART_ASSERT_RETURNS(
-      dart_gptr_getaddr(gptr_tail, (void*)&tail_ptr),
-      DART_OK);
+/**
+ * Spin on a field in the memory of the calling unit until it differs
+ * from \c value and return its new value.
+ */
+static int32_t lock_wait_local(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock,
+  int                field,
+  int32_t            value)
+{
+  int32_t *ptr = lock_field_ptr(
+                   team_data, lock, DART_TEAM_UNIT_ID(team_data->unitid),
+                   field);
+  int32_t  res;
+  while ((res = __atomic_load_n(ptr, __ATOMIC_ACQUIRE)) == value) {
+    lock_progress(team_data, lock);
+    sched_yield();
+  }
+  return res;
+}
 
-    /* Local store is safe and effective followed by the sync call. */
-    *tail_ptr = -1;
-    MPI_Win_sync(dart_win_local_alloc);
+static dart_ret_t lock_pool_grow(
+  dart_team_data_t      * team_data,
+  struct dart_lock_pool * pool)
+{
+  MPI_Aint           nbytes = DART_LOCK_BLOCK_SLOTS * DART_LOCK_SLOT_SIZE;
+  dart_lock_block_t  block;
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  MPI_Info win_info;
+  MPI_Info_create(&win_info);
+  MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
+  int ret = MPI_Win_allocate_shared(
+              nbytes, 1, win_info, team_data->sharedmem_comm,
+              &block.base, &block.shmwin);
+  MPI_Info_free(&win_info);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: MPI_Win_allocate_shared failed", __func__);
+    return DART_ERR_OTHER;
+  }
+  block.node_base = malloc(
+                      team_data->sharedmem_nodesize * sizeof(int32_t *));
+  for (int i = 0; i < team_data->sharedmem_nodesize; ++i) {
+    MPI_Aint size;
+    int      disp_unit;
+    MPI_Win_shared_query(
+      block.shmwin, i, &size, &disp_unit, &block.node_base[i]);
+  }
+  ret = MPI_Win_create(
+          block.base, nbytes, 1, MPI_INFO_NULL, team_data->comm, &block.win);
+#else
+  int ret = MPI_Win_allocate(
+              nbytes, 1, MPI_INFO_NULL, team_data->comm,
+              &block.base, &block.win);
+#endif
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: failed to create window for lock pool", __func__);
+    return DART_ERR_OTHER;
   }
 
-  /* Create a global memory region across the team.
-   * Every local memory segment holds the next unit
-   * waiting on the lock. */
-  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr_list);
-  if (ret != DART_OK) {
-    DART_LOG_ERROR("%s: Failed to allocate global memory!", __func__);
-    return ret;
+  for (int i = 0; i < DART_LOCK_BLOCK_SLOTS; ++i) {
+    int32_t *slot = block.base + i * DART_LOCK_NUM_FIELDS;
+    slot[DART_LOCK_TAIL] = -1;
+    slot[DART_LOCK_NEXT] = -1;
+    slot[DART_LOCK_WAIT] = 0;
+    slot[DART_LOCK_RW]   = 0;
+  }
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, block.win);
+  MPI_Win_sync(block.win);
+
+  dart_lock_block_t *blocks = realloc(
+                                pool->blocks,
+                                (pool->num_blocks + 1) * sizeof(*blocks));
+  /* all slots may be free at some point */
+  int32_t *free_slots = realloc(
+                          pool->free_slots,
+                          (pool->num_blocks + 1) * DART_LOCK_BLOCK_SLOTS
+                            * sizeof(int32_t));
+  pool->blocks     = blocks;
+  pool->free_slots = free_slots;
+  pool->blocks[pool->num_blocks] = block;
+  // hand out the slots of the new block in ascending order
+  for (int i = DART_LOCK_BLOCK_SLOTS - 1; i >= 0; --i) {
+    pool->free_slots[pool->num_free++] =
+                        pool->num_blocks * DART_LOCK_BLOCK_SLOTS + i;
   }
+  pool->num_blocks++;
+
+  DART_LOG_DEBUG("%s: lock pool of team %d grown to %d blocks",
+                 __func__, team_data->teamid, pool->num_blocks);
+  return DART_OK;
+}
 
-  int32_t *list_ptr;
-  dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                    &(team_data->segdata), gptr_list.segid);
-  MPI_Win win = list_seginfo->win; // window object used for atomic operations
+static dart_ret_t lock_init(
+  dart_team_t   teamid,
+  bool          is_rw,
+  dart_lock_t * lock)
+{
+  *lock = DART_LOCK_NULL;
 
-  dart_gptr_setunit(&gptr_list, unitid);
-  dart_gptr_getaddr(gptr_list, (void*)&list_ptr);
-  *list_ptr = -1;
-  MPI_Win_sync(win);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
 
-  // communicate tail pointer
-  ret = dart_bcast(
-    &gptr_tail,
-    sizeof(dart_gptr_t),
-    DART_TYPE_BYTE,
-    DART_TEAM_UNIT_ID(0),
-    teamid);
-  if (ret != DART_OK) {
-    DART_LOG_ERROR("%s: Failed to broadcast lock information!", __func__);
-    return ret;
+  struct dart_lock_pool *pool = team_data->lock_pool;
+  if (pool == NULL) {
+    pool = calloc(1, sizeof(struct dart_lock_pool));
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+    // the same on all units, either all or none share the node
+    pool->node_local = (team_data->sharedmem_nodesize == team_data->size);
+#endif
+    team_data->lock_pool = pool;
   }
 
+  /* Collective: all units see the same free slots */
+  if (pool->num_free == 0) {
+    dart_ret_t ret = lock_pool_grow(team_data, pool);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("%s: Failed to allocate lock pool!", __func__);
+      return ret;
+    }
+  }
 
   *lock = malloc(sizeof(struct dart_lock_struct));
-  (*lock)->gptr_tail   = gptr_tail;
-  (*lock)->gptr_list   = gptr_list;
+  (*lock)->pool        = pool;
+  (*lock)->slot        = pool->free_slots[--pool->num_free];
+  (*lock)->home        = DART_TEAM_UNIT_ID((*lock)->slot % team_data->size);
   (*lock)->teamid      = teamid;
+  (*lock)->is_rw       = is_rw;
   (*lock)->is_acquired = 0;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
 
+  /* Slots are reset when released, make sure all units see them */
+  MPI_Win_sync(lock_block(*lock)->win);
+  CHECK_MPI_RET(MPI_Barrier(team_data->comm), "MPI_Barrier");
+
   // register the lock
   (*lock)->next   = team_data->allocated_locks;
   team_data->allocated_locks = (*lock);
 
-  DART_LOG_DEBUG("dart_team_lock_init: INIT - done");
+  DART_LOG_DEBUG("dart_team_lock_init: slot %d with home unit %d in team %d",
+                 (*lock)->slot, (*lock)->home.id, teamid);
 
   return DART_OK;
 }
 
+dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
+{
+  return lock_init(teamid, false, lock);
+}
+
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_lock_t* lock)
+{
+  return lock_init(teamid, true, lock);
+}
+
+/**
+ * Wait for all readers to leave after the calling unit has acquired the
+ * writer queue of a reader/writer lock.
+ */
+static void lock_writer_drain(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock)
+{
+  int32_t rw = lock_fetch_op(
+                 team_data, lock, lock->home, DART_LOCK_RW,
+                 DART_LOCK_WRITER, MPI_SUM);
+  while ((rw & ~DART_LOCK_WRITER) != 0) {
+    lock_progress(team_data, lock);
+    sched_yield();
+    rw = lock_fetch_op(
+           team_data, lock, lock->home, DART_LOCK_RW, 0, MPI_NO_OP);
+  }
+}
+
+/**
+ * Hand the lock over to the successor of the calling unit, if any.
+ */
+static void lock_handover(
+  dart_team_data_t * team_data,
+  dart_lock_t        lock,
+  dart_team_unit_t   unitid)
+{
+  int32_t *next_ptr = lock_field_ptr(team_data, lock, unitid, DART_LOCK_NEXT);
+  int32_t  next     = __atomic_load_n(next_ptr, __ATOMIC_ACQUIRE);
+
+  if (next == -1) {
+    /* Check if we are at the tail of this lock queue and reset the tail
+     * pointer if we are. If that is the case we are done. */
+    int32_t result = lock_compare_and_swap(
+                       team_data, lock, lock->home, DART_LOCK_TAIL,
+                       unitid.id, -1);
+    if (result == unitid.id) {
+      return;
+    }
+    /* A successor is about to enqueue, wait for our next pointer. */
+    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
+                   "(tail = %d) in team %d", result, lock->teamid);
+    next = lock_wait_local(team_data, lock, DART_LOCK_NEXT, -1);
+  }
+
+  __atomic_store_n(next_ptr, -1, __ATOMIC_RELAXED);
+  DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d",
+                 next, lock->teamid);
+  lock_store(team_data, lock, DART_TEAM_UNIT_ID(next), DART_LOCK_WAIT, 0);
+}
+
 dart_ret_t dart_lock_acquire(dart_lock_t lock)
 {
   /* lock the local mutex and keep it until the global lock is released */
@@ -151,82 +481,47 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
   }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
-  if (team_data == NULL) {
+  if (team_data == NULL || lock->pool == NULL) {
     DART_LOG_ERROR("dart_lock_acquire ! failed: Unknown team %i!",
                    lock->teamid);
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
+  dart_team_unit_t unitid = DART_TEAM_UNIT_ID(team_data->unitid);
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
+  /* Prepare to wait before becoming visible to the predecessor */
+  int32_t *wait_ptr = lock_field_ptr(team_data, lock, unitid, DART_LOCK_WAIT);
+  __atomic_store_n(wait_ptr, 1, __ATOMIC_RELEASE);
+  if (!lock->pool->node_local) {
+    MPI_Win_sync(lock_block(lock)->win);
+  }
 
-  int32_t predecessor;
-
-  /* Fetch the current unit's tail and make this unit the new tail */
-  DART_LOG_TRACE(
-    "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
-    "tail_unit %i with offset %lu",
-    unitid.id, tail_unit, tail_offset);
-  DART_ASSERT_RETURNS(
-    MPI_Fetch_and_op(
-      &unitid.id,
-      &predecessor,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      MPI_REPLACE,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
-      MPI_SUCCESS);
+  /* Make this unit the new tail and fetch the previous tail */
+  int32_t predecessor = lock_fetch_op(
+                          team_data, lock, lock->home, DART_LOCK_TAIL,
+                          unitid.id, MPI_REPLACE);
 
   DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
     predecessor, unitid.id);
 
   /* If there was a previous tail (predecessor), update the previous tail's
-   * next pointer with unitid and wait for notification from its predecessor.
+   * next pointer with unitid and wait for notification from it.
    */
   if (predecessor != -1) {
-    int32_t    result;
-    MPI_Status status;
-
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win  win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(
-                            list_seginfo, DART_TEAM_UNIT_ID(predecessor));
-
-    /* Atomicity: Update its predecessor's next pointer */
-    DART_ASSERT_RETURNS(
-      MPI_Fetch_and_op(
-        &unitid.id,
-        &result,
-        MPI_INT32_T,
-        predecessor,
-        disp_list,
-        MPI_REPLACE,
-        win),
-      MPI_SUCCESS);
-
-    DART_ASSERT_RETURNS(
-      MPI_Win_flush(predecessor, win),
-      DART_OK);
-
-    /* Waiting for notification from its predecessor*/
+    lock_store(
+      team_data, lock, DART_TEAM_UNIT_ID(predecessor), DART_LOCK_NEXT,
+      unitid.id);
     DART_LOG_DEBUG("dart_lock_acquire: waiting for notification from "
                    "%d in team %d",
                    predecessor, lock->teamid);
+    lock_wait_local(team_data, lock, DART_LOCK_WAIT, 1);
+  } else {
+    __atomic_store_n(wait_ptr, 0, __ATOMIC_RELAXED);
+  }
 
-    MPI_Recv(NULL, 0, MPI_INT, predecessor, 0, team_data->comm,
-        &status);
+  if (lock->is_rw) {
+    lock_writer_drain(team_data, lock);
   }
 
   DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
@@ -251,40 +546,41 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t result;
-  int32_t compare = -1;
-
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL || lock->pool == NULL) {
+    DART_LOG_ERROR("dart_lock_try_acquire ! failed: Unknown team %i!",
+                   lock->teamid);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
 
-  dart_gptr_t gptr_tail   = lock->gptr_tail;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+  dart_team_unit_t unitid = DART_TEAM_UNIT_ID(team_data->unitid);
 
   /* Atomicity: Check if the lock is available and claim it if it is. */
-  DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &unitid.id,
-      &compare,
-      &result,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
-    MPI_SUCCESS);
+  int32_t result = lock_compare_and_swap(
+                     team_data, lock, lock->home, DART_LOCK_TAIL,
+                     -1, unitid.id);
 
   /* If the old predecessor was -1, we have claimed the lock,
    * otherwise, do nothing. */
-  if (result == -1)
-  {
+  *is_acquired = (result == -1);
+
+  if (*is_acquired && lock->is_rw) {
+    /* Claim the lock from readers, give it back if there are any */
+    result = lock_compare_and_swap(
+               team_data, lock, lock->home, DART_LOCK_RW,
+               0, DART_LOCK_WRITER);
+    if (result != 0) {
+      lock_handover(team_data, lock, unitid);
+      *is_acquired = 0;
+    }
+  }
+
+  if (*is_acquired) {
     lock->is_acquired = 1;
-    *is_acquired = 1;
   } else {
-    *is_acquired = 0;
+    /* callers typically retry, let the lock holder make progress */
+    lock_progress(team_data, lock);
     /* unlock the local mutex if we have not acqcuired the global lock */
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   }
@@ -302,86 +598,84 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
-  uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
-  dart_unit_t   tail        = gptr_tail.unitid;
-  int32_t     * addr;
-  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
+  dart_team_unit_t unitid = DART_TEAM_UNIT_ID(team_data->unitid);
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
+  if (lock->is_rw) {
+    lock_fetch_op(
+      team_data, lock, lock->home, DART_LOCK_RW, -DART_LOCK_WRITER, MPI_SUM);
+  }
 
-  int32_t result;
-  int32_t reset = -1;
+  lock_handover(team_data, lock, unitid);
 
-  /* Check if we are at the tail of this lock queue and reset the tail pointer
-   * if we are. If that is the case we are done.
-   * Otherwise, the reset fails and we need to send notification. */
-  DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &reset,
-      &unitid.id,
-      &result,
-      MPI_INT32_T,
-      tail,
-      offset_tail,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
-    MPI_SUCCESS);
+  lock->is_acquired = 0;
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
+                 (lock -> teamid));
+  return DART_OK;
+}
 
-  if (result != unitid.id) {
-    /* We are not at the tail of this lock queue. */
-    int32_t  next;
-    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
-                   "(tail = %d) in team %d",
-                   result, (lock -> teamid));
+dart_ret_t dart_lock_try_acquire_shared(
+  dart_lock_t   lock,
+  int32_t     * is_acquired)
+{
+  *is_acquired = 0;
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL || lock->pool == NULL || !lock->is_rw) {
+    DART_LOG_ERROR("dart_lock_try_acquire_shared ! "
+                   "not a reader/writer lock of a valid team");
+    return DART_ERR_INVAL;
+  }
 
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid);
+  int32_t rw = lock_fetch_op(
+                 team_data, lock, lock->home, DART_LOCK_RW, 1, MPI_SUM);
+  if (rw & DART_LOCK_WRITER) {
+    /* a writer holds or claims the lock, back off */
+    lock_fetch_op(team_data, lock, lock->home, DART_LOCK_RW, -1, MPI_SUM);
+    lock_progress(team_data, lock);
+  } else {
+    *is_acquired = 1;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_acquire_shared(dart_lock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL || lock->pool == NULL || !lock->is_rw) {
+    DART_LOG_ERROR("dart_lock_acquire_shared ! "
+                   "not a reader/writer lock of a valid team");
+    return DART_ERR_INVAL;
+  }
 
-    /* Wait for the update of our next pointer. */
+  int32_t acquired;
+  while (1) {
+    dart_ret_t ret = dart_lock_try_acquire_shared(lock, &acquired);
+    if (ret != DART_OK || acquired) {
+      return ret;
+    }
+    /* wait for the writer to leave before trying again */
+    int32_t rw;
     do {
-      // trigger progress
-      int flag;
-      MPI_Iprobe(
-        MPI_ANY_SOURCE, MPI_ANY_TAG,
-        team_data->comm, &flag, MPI_STATUS_IGNORE);
-      DART_ASSERT_RETURNS(
-        MPI_Fetch_and_op(
-          NULL,
-          &next,
-          MPI_INT,
-          unitid.id,
-          disp_list,
-          MPI_NO_OP,
-          win),
-        MPI_SUCCESS);
-      DART_ASSERT_RETURNS(
-        MPI_Win_flush(unitid.id, win),
-        MPI_SUCCESS);
-    } while (next == -1);
-
-    DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d", next,
-                   (lock->teamid));
-
-    /* Notifying the next unit waiting on the lock queue. */
-    MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
-    *addr = -1;
-    MPI_Win_sync(win);
+      lock_progress(team_data, lock);
+      sched_yield();
+      rw = lock_fetch_op(
+             team_data, lock, lock->home, DART_LOCK_RW, 0, MPI_NO_OP);
+    } while (rw & DART_LOCK_WRITER);
   }
-  lock->is_acquired = 0;
-  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
-  DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
-                 (lock -> teamid));
+}
+
+dart_ret_t dart_lock_release_shared(dart_lock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL || lock->pool == NULL || !lock->is_rw) {
+    DART_LOG_ERROR("dart_lock_release_shared ! "
+                   "not a reader/writer lock of a valid team");
+    return DART_ERR_INVAL;
+  }
+  lock_fetch_op(team_data, lock, lock->home, DART_LOCK_RW, -1, MPI_SUM);
   return DART_OK;
 }
 
@@ -395,8 +689,8 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
 
-  if (team_data != NULL) {
-    // if the team is still alive the lock segments have not been free'd
+  if (team_data != NULL && (*lock)->pool != NULL) {
+    // if the team is still alive the lock slot has not been released
     struct dart_lock_struct *prev = NULL, *elem = team_data->allocated_locks;
     while (elem != NULL) {
       if (elem == *lock) {
@@ -413,10 +707,20 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
       prev->next = elem->next;
     }
 
-    destroy_lock_segments(*lock);
+    /* Reset the slot at this unit and return it to the pool, which happens
+     * in the same order on all units. */
+    dart_team_unit_t unitid = DART_TEAM_UNIT_ID(team_data->unitid);
+    int32_t *slot = lock_field_ptr(team_data, *lock, unitid, 0);
+    slot[DART_LOCK_TAIL] = -1;
+    slot[DART_LOCK_NEXT] = -1;
+    slot[DART_LOCK_WAIT] = 0;
+    slot[DART_LOCK_RW]   = 0;
+    struct dart_lock_pool *pool = (*lock)->pool;
+    pool->free_slots[pool->num_free++] = (*lock)->slot;
   }
 
   (*lock)->teamid    = DART_TEAM_NULL;
+  (*lock)->pool      = NULL;
   dart__base__mutex_destroy(&(*lock)->mutex);
   DART_LOG_DEBUG("dart_team_lock_free: done in team %d", teamid);
   free(*lock);
@@ -426,55 +730,37 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 
 bool dart_lock_initialized(struct dart_lock_struct const * lock)
 {
-  return lock &&
-    !DART_GPTR_ISNULL(lock->gptr_tail) &&
-         !DART_GPTR_ISNULL(lock->gptr_list);
+  return lock && lock->pool != NULL;
 }
 
-dart_ret_t dart__mpi__destroylocks(struct dart_lock_struct *allocated_locks)
+dart_ret_t dart__mpi__destroylocks(dart_team_data_t *team_data)
 {
-  // Iterate over all allocated and free the segments
-  // However, do not free the lock or remove it from the list as the user might
-  // call dart_team_lock_destroy later
-  struct dart_lock_struct *lock = allocated_locks;
+  // Invalidate all locks of the team and release the lock pool.
+  // However, do not free the locks as the user might call
+  // dart_team_lock_destroy later
+  struct dart_lock_struct *lock = team_data->allocated_locks;
   while (lock != NULL) {
-    destroy_lock_segments(lock);
+    lock->pool = NULL;
     lock = lock->next;
   }
-  return DART_OK;
-}
-
+  team_data->allocated_locks = NULL;
 
-static
-dart_ret_t destroy_lock_segments(dart_lock_t lock)
-{
-  dart_ret_t ret;
-  dart_team_unit_t unitid;
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-  dart_team_t teamid    = lock->teamid;
-
-  dart_team_myid(teamid, &unitid);
-
-  /* Unit 0 is the process holding the gptr_tail by default. */
-  if (unitid.id == 0) {
-    if (!DART_GPTR_ISNULL(gptr_tail)) {
-      ret = dart_memfree(gptr_tail);
-      if (ret != DART_OK) {
-        DART_LOG_ERROR("Failed to free global mmeory");
-        return ret;
-      }
-      lock->gptr_tail = DART_GPTR_NULL;
-    }
+  struct dart_lock_pool *pool = team_data->lock_pool;
+  if (pool == NULL) {
+    return DART_OK;
   }
-  if (!DART_GPTR_ISNULL(gptr_list)) {
-    ret = dart_team_memfree(gptr_list);
-    if (ret != DART_OK) {
-      DART_LOG_ERROR("Failed to free global mmeory");
-      return ret;
-    }
-    lock->gptr_list = DART_GPTR_NULL;
+  for (int i = 0; i < pool->num_blocks; ++i) {
+    dart_lock_block_t *block = &pool->blocks[i];
+    MPI_Win_unlock_all(block->win);
+    MPI_Win_free(&block->win);
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+    MPI_Win_free(&block->shmwin);
+    free(block->node_base);
+#endif
   }
-
+  free(pool->blocks);
+  free(pool->free_slots);
+  free(pool);
+  team_data->lock_pool = NULL;
   return DART_OK;
 }
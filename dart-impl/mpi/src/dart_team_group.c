@@ -19,6 +19,8 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
 #include <dash/dart/mpi/dart_synchronization_priv.h>
+#include <dash/dart/mpi/dart_coalesce_priv.h>
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
 
 #include <limits.h>
 
@@ -634,6 +636,7 @@ dart_ret_t dart_team_create(
     MPI_Comm_size(team_data->comm, &team_data->size);
 
     team_data->allocated_locks = NULL;
+    team_data->lock_pool       = NULL;
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
     dart_allocate_shared_comm(team_data);
@@ -669,10 +672,13 @@ dart_ret_t dart_team_destroy(
   // free(dart_unit_mapping[index]);
 
   // MPI_Win_free (&(sharedmem_win_list[index]));
+  dart__mpi__coll_hier_team_fini(team_data);
+  dart__mpi__destroylocks(team_data);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
 #endif
   win = team_data->window;
+  dart__mpi__coalesce_flush_all(win);
   MPI_Win_unlock_all(win);
   MPI_Win_free(&win);
 
@@ -683,9 +689,6 @@ dart_ret_t dart_team_destroy(
 
   dart_adapt_teamlist_dealloc(*teamid);
 
-  dart__mpi__destroylocks(team_data->allocated_locks);
-  team_data->allocated_locks = NULL;
-
   DART_LOG_DEBUG("dart_team_destroy > teamid:%d", *teamid);
 
   *teamid = DART_TEAM_NULL;
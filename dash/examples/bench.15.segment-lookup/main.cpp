@@ -0,0 +1,203 @@
+/**
+ * Measures the latency of single-element DART put and get operations
+ * depending on the number of live global memory segments.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+  int    max_segments;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  int         num_segments;
+  double      put_latency_us;
+  double      get_latency_us;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              const std::vector<dart_gptr_t> & segments,
+              benchmark_params                 params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.15.segment-lookup");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::vector<dart_gptr_t> segments;
+  for (int num_segments = 1; num_segments <= params.max_segments;
+       num_segments *= 4) {
+    // grow the number of live segments
+    while (static_cast<int>(segments.size()) < num_segments) {
+      dart_gptr_t gptr;
+      dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptr);
+      segments.push_back(gptr);
+    }
+    for (int round = 0; round < params.rounds; ++round) {
+      auto res = evaluate(segments, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+  }
+
+  dash::barrier();
+  for (auto gptr : segments) {
+    dart_team_memfree(gptr);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(
+  const std::vector<dart_gptr_t> & segments,
+  benchmark_params                 params)
+{
+  measurement mes;
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  int         value    = dash::myid();
+  size_t      nseg     = segments.size();
+
+  dash::barrier();
+
+  // access segments round-robin to avoid favoring a single hot entry
+  auto ts_put_start = Timer::Now();
+  for (int i = 0; i < params.reps; i++) {
+    dart_gptr_t gptr = segments[i % nseg];
+    gptr.unitid      = neighbor;
+    dart_put_blocking(gptr, &value, 1, DART_TYPE_INT, DART_TYPE_INT);
+  }
+  mes.put_latency_us = Timer::ElapsedSince(ts_put_start) / params.reps;
+
+  dash::barrier();
+
+  auto ts_get_start = Timer::Now();
+  for (int i = 0; i < params.reps; i++) {
+    dart_gptr_t gptr = segments[i % nseg];
+    gptr.unitid      = neighbor;
+    dart_get_blocking(&value, gptr, 1, DART_TYPE_INT, DART_TYPE_INT);
+  }
+  mes.get_latency_us = Timer::ElapsedSince(ts_get_start) / params.reps;
+
+  mes.testcase     = "segment.lookup";
+  mes.num_segments = nseg;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(20) << "impl"       << ","
+         << std::setw( 9) << "segments"   << ","
+         << std::setw(12) << "put.us"     << ","
+         << std::setw(12) << "get.us"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5) << dash::size() << ","
+         << std::setw(9) << mpi_impl     << ","
+         << std::setw(20) << mes.testcase << ","
+         << std::setw(9) << mes.num_segments << ","
+         << std::fixed << setprecision(4) << setw(12) << mes.put_latency_us
+         << ","
+         << std::fixed << setprecision(4) << setw(12) << mes.get_latency_us
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 10000;
+  params.rounds         = 5;
+  params.max_segments   = 4096;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-s") {
+      params.max_segments = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",    "repetitions per round", params.reps);
+  bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-s",    "max. number of live segments",
+                        params.max_segments);
+  bench_cfg.print_section_end();
+}
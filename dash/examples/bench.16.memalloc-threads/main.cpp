@@ -0,0 +1,242 @@
+/**
+ * Measures the throughput of concurrent local global memory allocations
+ * using dart_memalloc and dart_memfree depending on the number of threads
+ * and reports the fragmentation of the local memory pool.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+  int    max_threads;
+  int    max_size;
+  int    live_allocs;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string          testcase;
+  int                  num_threads;
+  double               mops;
+  dart_mempool_stats_t stats;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              int              num_threads,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.16.memalloc-threads");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  if (!dash::is_multithreaded()) {
+    if (dash::myid() == 0) {
+      cout << "DASH not initialized with thread support, "
+           << "running single-threaded" << endl;
+    }
+    params.max_threads = 1;
+  }
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  for (int num_threads = 1; num_threads <= params.max_threads;
+       num_threads *= 2) {
+    for (int round = 0; round < params.rounds; ++round) {
+      auto res = evaluate(num_threads, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void alloc_free_task(int thread_id, benchmark_params params)
+{
+  std::mt19937 rng(dash::myid() * params.max_threads + thread_id);
+  std::uniform_int_distribution<int> size_dist(1, params.max_size);
+  std::uniform_int_distribution<int> slot_dist(0, params.live_allocs - 1);
+
+  // keep a working set of live allocations and replace random entries
+  std::vector<dart_gptr_t> live(params.live_allocs, DART_GPTR_NULL);
+  for (int i = 0; i < params.reps; i++) {
+    auto & gptr = live[slot_dist(rng)];
+    if (!DART_GPTR_ISNULL(gptr)) {
+      dart_memfree(gptr);
+    }
+    dart_memalloc(size_dist(rng), DART_TYPE_BYTE, &gptr);
+  }
+  for (auto & gptr : live) {
+    if (!DART_GPTR_ISNULL(gptr)) {
+      dart_memfree(gptr);
+    }
+  }
+}
+
+measurement evaluate(
+  int              num_threads,
+  benchmark_params params)
+{
+  measurement mes;
+
+  dash::barrier();
+
+  auto ts_start = Timer::Now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back(alloc_free_task, t, params);
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  double elapsed_us = Timer::ElapsedSince(ts_start);
+
+  dart_memalloc_stats(&mes.stats);
+
+  dash::barrier();
+
+  // one allocation and one free per repetition
+  mes.mops        = (2.0 * params.reps * num_threads) / elapsed_us;
+  mes.testcase    = "memalloc.threads";
+  mes.num_threads = num_threads;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(20) << "impl"       << ","
+         << std::setw( 8) << "threads"    << ","
+         << std::setw(12) << "mops"       << ","
+         << std::setw(12) << "hit.rate"   << ","
+         << std::setw(12) << "frag"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    double hit_rate = (mes.stats.num_allocs > 0)
+                        ? static_cast<double>(mes.stats.num_cache_hits) /
+                          mes.stats.num_allocs
+                        : 0.0;
+    cout << std::right
+         << std::setw(5) << dash::size() << ","
+         << std::setw(9) << mpi_impl     << ","
+         << std::setw(20) << mes.testcase << ","
+         << std::setw(8) << mes.num_threads << ","
+         << std::fixed << setprecision(4) << setw(12) << mes.mops
+         << ","
+         << std::fixed << setprecision(4) << setw(12) << hit_rate
+         << ","
+         << std::fixed << setprecision(4) << setw(12)
+         << mes.stats.fragmentation
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 100000;
+  params.rounds         = 5;
+  params.max_threads    = std::thread::hardware_concurrency();
+  params.max_size       = 256;
+  params.live_allocs    = 64;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-t") {
+      params.max_threads = atoi(argv[i+1]);
+    }
+    if (flag == "-s") {
+      params.max_size = atoi(argv[i+1]);
+    }
+    if (flag == "-l") {
+      params.live_allocs = atoi(argv[i+1]);
+    }
+  }
+  if (params.max_threads < 1) {
+    params.max_threads = 1;
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",    "allocations per thread", params.reps);
+  bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-t",    "max. number of threads",
+                        params.max_threads);
+  bench_cfg.print_param("-s",    "max. allocation size (bytes)",
+                        params.max_size);
+  bench_cfg.print_param("-l",    "live allocations per thread",
+                        params.live_allocs);
+  bench_cfg.print_section_end();
+}
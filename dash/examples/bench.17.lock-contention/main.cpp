@@ -0,0 +1,232 @@
+/**
+ * Measures the throughput of dash::Mutex and dash::SharedMutex under
+ * contention of all units, for exclusive acquisition and for a mix of
+ * shared and exclusive acquisitions of a reader/writer lock.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+  int    num_locks;
+  int    write_pct;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  int         num_locks;
+  double      time_us;
+  double      mops;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate_mutex(benchmark_params params);
+measurement evaluate_shared_mutex(
+              benchmark_params params,
+              int              write_pct);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.17.lock-contention");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  for (int round = 0; round < params.rounds; ++round) {
+    print_measurement_record(bench_cfg, evaluate_mutex(params), params);
+    print_measurement_record(
+      bench_cfg, evaluate_shared_mutex(params, 100), params);
+    print_measurement_record(
+      bench_cfg, evaluate_shared_mutex(params, params.write_pct), params);
+    print_measurement_record(
+      bench_cfg, evaluate_shared_mutex(params, 0), params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+template <class MutexT, class OpFunc>
+measurement evaluate_locks(
+  std::vector<MutexT> & locks,
+  benchmark_params      params,
+  OpFunc                op)
+{
+  measurement mes;
+  std::mt19937 rng(dash::myid());
+  std::uniform_int_distribution<int> lock_dist(0, params.num_locks - 1);
+
+  dash::barrier();
+
+  auto ts_start = Timer::Now();
+  for (int i = 0; i < params.reps; i++) {
+    op(locks[lock_dist(rng)], rng);
+  }
+  dash::barrier();
+  mes.time_us = Timer::ElapsedSince(ts_start);
+
+  mes.num_locks = params.num_locks;
+  mes.mops      = (static_cast<double>(params.reps) * dash::size())
+                  / mes.time_us;
+  return mes;
+}
+
+measurement evaluate_mutex(benchmark_params params)
+{
+  std::vector<dash::Mutex> locks;
+  for (int l = 0; l < params.num_locks; ++l) {
+    locks.emplace_back();
+  }
+  auto mes = evaluate_locks(locks, params,
+               [](dash::Mutex & mx, std::mt19937 &) {
+                 mx.lock();
+                 mx.unlock();
+               });
+  mes.testcase = "mutex";
+  return mes;
+}
+
+measurement evaluate_shared_mutex(
+  benchmark_params params,
+  int              write_pct)
+{
+  std::vector<dash::SharedMutex> locks;
+  for (int l = 0; l < params.num_locks; ++l) {
+    locks.emplace_back();
+  }
+  std::uniform_int_distribution<int> pct_dist(0, 99);
+  auto mes = evaluate_locks(locks, params,
+               [&](dash::SharedMutex & mx, std::mt19937 & rng) {
+                 if (pct_dist(rng) < write_pct) {
+                   mx.lock();
+                   mx.unlock();
+                 } else {
+                   mx.lock_shared();
+                   mx.unlock_shared();
+                 }
+               });
+  mes.testcase = "shared_mutex.w" + std::to_string(write_pct);
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(20) << "impl"       << ","
+         << std::setw( 8) << "locks"      << ","
+         << std::setw(12) << "time.s"     << ","
+         << std::setw(12) << "mops"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5) << dash::size() << ","
+         << std::setw(9) << mpi_impl     << ","
+         << std::setw(20) << mes.testcase << ","
+         << std::setw(8) << mes.num_locks << ","
+         << std::fixed << setprecision(4) << setw(12) << 1e-6 * mes.time_us
+         << ","
+         << std::fixed << setprecision(4) << setw(12) << mes.mops
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 10000;
+  params.rounds         = 5;
+  params.num_locks      = 1;
+  params.write_pct      = 10;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-l") {
+      params.num_locks = atoi(argv[i+1]);
+    }
+    if (flag == "-w") {
+      params.write_pct = atoi(argv[i+1]);
+    }
+  }
+  if (params.num_locks < 1) {
+    params.num_locks = 1;
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",    "acquisitions per unit", params.reps);
+  bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-l",    "number of locks", params.num_locks);
+  bench_cfg.print_param("-w",    "exclusive acquisitions (%)",
+                        params.write_pct);
+  bench_cfg.print_section_end();
+}
@@ -18,14 +18,20 @@
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Bcast.h>
 #include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/TransformReduce.h>
+#include <dash/algorithm/Count.h>
+#include <dash/algorithm/Histogram.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
 #include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/None_of.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
 #include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Select.h>
 
 #include <dash/algorithm/SUMMA.h>
 
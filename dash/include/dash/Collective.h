@@ -0,0 +1,206 @@
+#ifndef DASH__COLLECTIVE_H__
+#define DASH__COLLECTIVE_H__
+
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Future.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/Operation.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <memory>
+
+
+namespace dash {
+
+namespace internal {
+
+  /**
+   * Create a future completing the non-blocking collective operation
+   * referenced by \c handle.
+   *
+   * Collective operations cannot be abandoned, a future that is destroyed
+   * before the operation completed waits for its completion.
+   */
+  inline
+  dash::Future<void>
+  collective_future(dart_handle_t handle)
+  {
+    auto handle_ptr = std::make_shared<dart_handle_t>(handle);
+    return dash::Future<void>(
+      // wait
+      [handle_ptr]() {
+        DASH_ASSERT_RETURNS(
+          dart_wait_local(handle_ptr.get()),
+          DART_OK);
+      },
+      // test
+      [handle_ptr]() {
+        int32_t flag;
+        DASH_ASSERT_RETURNS(
+          dart_test_local(handle_ptr.get(), &flag),
+          DART_OK);
+        return (flag != 0);
+      },
+      // destroy
+      [handle_ptr]() {
+        if (*handle_ptr != DART_HANDLE_NULL) {
+          DASH_ASSERT_RETURNS(
+            dart_wait_local(handle_ptr.get()),
+            DART_OK);
+        }
+      }
+    );
+  }
+
+} // namespace internal
+
+/**
+ * Non-blocking barrier on the units in \c team.
+ *
+ * Collective operation.
+ *
+ * \return A future that completes once all units in \c team have entered
+ *         the barrier.
+ *
+ * \see dart_ibarrier
+ */
+inline
+dash::Future<void>
+barrier_async(dash::Team & team = dash::Team::All())
+{
+  dart_handle_t handle;
+  DASH_ASSERT_RETURNS(
+    dart_ibarrier(team.dart_id(), &handle),
+    DART_OK);
+  return dash::internal::collective_future(handle);
+}
+
+/**
+ * Non-blocking broadcast of the \c nelem values in \c buf from unit \c root
+ * to all other units in \c team.
+ *
+ * Collective operation. The buffer may not be accessed before the returned
+ * future completed.
+ *
+ * \see dart_ibcast
+ */
+template <typename ValueType>
+dash::Future<void>
+broadcast_async(
+  ValueType         * buf,
+  size_t              nelem,
+  dash::team_unit_t   root,
+  dash::Team        & team = dash::Team::All())
+{
+  dart_handle_t handle;
+  auto ds = dash::dart_storage<ValueType>(nelem);
+  DASH_ASSERT_RETURNS(
+    dart_ibcast(buf, ds.nelem, ds.dtype, root, team.dart_id(), &handle),
+    DART_OK);
+  return dash::internal::collective_future(handle);
+}
+
+/**
+ * Non-blocking allgather of the \c nelem values in \c sendbuf of every unit
+ * in \c team into \c recvbuf, which has to hold \c nelem values for every
+ * unit. The values of the calling unit are taken from its position in
+ * \c recvbuf if \c sendbuf is \c nullptr.
+ *
+ * Collective operation. The buffers may not be accessed before the returned
+ * future completed.
+ *
+ * \see dart_iallgather
+ */
+template <typename ValueType>
+dash::Future<void>
+allgather_async(
+  const ValueType * sendbuf,
+  ValueType       * recvbuf,
+  size_t            nelem,
+  dash::Team      & team = dash::Team::All())
+{
+  dart_handle_t handle;
+  auto ds = dash::dart_storage<ValueType>(nelem);
+  DASH_ASSERT_RETURNS(
+    dart_iallgather(sendbuf, recvbuf, ds.nelem, ds.dtype,
+                    team.dart_id(), &handle),
+    DART_OK);
+  return dash::internal::collective_future(handle);
+}
+
+/**
+ * Non-blocking element-wise reduction of the \c nelem values in \c sendbuf
+ * of all units in \c team using \c binary_op, with the result stored in
+ * \c recvbuf on all units. The reduction is performed in place if
+ * \c sendbuf and \c recvbuf are the same.
+ *
+ * Only the reduce operations predefined by DART (see
+ * \ref dash::internal::dart_reduce_operation) on value types with a DART
+ * equivalent are supported.
+ *
+ * Collective operation. The buffers may not be accessed before the returned
+ * future completed.
+ *
+ * \see dart_iallreduce
+ */
+template <
+  typename ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+dash::Future<void>
+allreduce_async(
+  const ValueType * sendbuf,
+  ValueType       * recvbuf,
+  size_t            nelem,
+  BinaryOperation   binary_op = BinaryOperation(),
+  dash::Team      & team = dash::Team::All())
+{
+  dart_operation_t dop =
+                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
+  dart_datatype_t  dtype = dash::dart_datatype<ValueType>::value;
+  if (dop == DART_OP_UNDEFINED || dtype == DART_TYPE_UNDEFINED) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::allreduce_async: only predefined reduce operations on "
+      "basic types are supported");
+  }
+  dart_handle_t handle;
+  DASH_ASSERT_RETURNS(
+    dart_iallreduce(sendbuf, recvbuf, nelem, dtype, dop,
+                    team.dart_id(), &handle),
+    DART_OK);
+  return dash::internal::collective_future(handle);
+}
+
+/**
+ * Non-blocking all-to-all exchange, sending the \c nelem values at position
+ * \c i * \c nelem in \c sendbuf to unit \c i in \c team and receiving the
+ * \c nelem values from unit \c i at position \c i * \c nelem in \c recvbuf.
+ *
+ * Collective operation. The buffers may not be accessed before the returned
+ * future completed.
+ *
+ * \see dart_ialltoall
+ */
+template <typename ValueType>
+dash::Future<void>
+alltoall_async(
+  const ValueType * sendbuf,
+  ValueType       * recvbuf,
+  size_t            nelem,
+  dash::Team      & team = dash::Team::All())
+{
+  dart_handle_t handle;
+  auto ds = dash::dart_storage<ValueType>(nelem);
+  DASH_ASSERT_RETURNS(
+    dart_ialltoall(sendbuf, recvbuf, ds.nelem, ds.dtype,
+                   team.dart_id(), &handle),
+    DART_OK);
+  return dash::internal::collective_future(handle);
+}
+
+} // namespace dash
+
+#endif // DASH__COLLECTIVE_H__
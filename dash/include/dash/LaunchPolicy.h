@@ -12,6 +12,37 @@ sync     = 0x1,
 async    = 0x2
 };
 
+namespace execution {
+
+/**
+ * Execution policy of algorithms processing local elements: every unit
+ * processes its local elements sequentially, the operation ends with a
+ * barrier.
+ */
+struct sequenced_policy { };
+
+/**
+ * Execution policy of algorithms processing local elements: every unit
+ * processes its local elements in chunks distributed to the threads
+ * available to the unit, the operation ends with a barrier.
+ */
+struct parallel_policy { };
+
+/**
+ * Execution policy of algorithms processing local elements: every unit
+ * processes its local elements in chunks distributed to the threads
+ * available to the unit, asynchronously to the calling thread. The
+ * operation returns a future for the completion at the calling unit and
+ * does not synchronize with other units.
+ */
+struct parallel_local_policy { };
+
+constexpr sequenced_policy      seq{};
+constexpr parallel_policy       par{};
+constexpr parallel_local_policy par_local{};
+
+} // namespace execution
+
 }
 
 
@@ -13,10 +13,15 @@
 #include <dash/list/ListRef.h>
 #include <dash/list/LocalListRef.h>
 #include <dash/list/GlobListIter.h>
+#include <dash/list/LocalListIter.h>
 #include <dash/list/internal/ListTypes.h>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 namespace dash {
@@ -92,6 +97,7 @@ namespace dash {
  * <tt>reverse</tt>             | <tt>void</tt>       | Reverse the order of list elements
  * <b>Views (DASH specific)</b> | &nbsp;              | &nbsp;
  * <tt>local</tt>               | <tt>local_type</tt> | View on list elements local to calling unit
+ * <tt>rebalance</tt>           | <tt>void</tt>       | Distribute list elements evenly to units
  * \}
  *
  * Usage examples:
@@ -145,7 +151,7 @@ namespace dash {
  * //                                .-- 13 <-'
  * //                                `-> 14 ---> Nil
  *
- * list.balance();
+ * list.rebalance();
  *
  * // Logical structure of list for 3 units:
  * //
@@ -163,6 +169,11 @@ namespace dash {
 /**
  * A dynamic bi-directional list with support for workload balancing.
  *
+ * Threads of a unit may insert, remove and splice local elements
+ * concurrently, see \c LocalListRef. Collective operations like
+ * \c barrier and \c rebalance must not be called while threads of the
+ * unit update the local list.
+ *
  * \concept{DashListConcept}
  */
 template <
@@ -184,6 +195,8 @@ private:
 
   typedef internal::ListNode<ElementType> node_type;
 
+  typedef internal::ListLock              local_lock_type;
+
   typedef dash::Array<
       dash::default_size_t,
       int,
@@ -230,9 +243,32 @@ public:
   typedef GlobHeapPtr<value_type, glob_mem_type> pointer;
   typedef GlobHeapPtr<const value_type, glob_mem_type> const_pointer;
 
-  // TODO: define ListLocalIter to dereference node iterators
-  typedef               local_node_iterator                   local_iterator;
-  typedef         const_local_node_iterator             const_local_iterator;
+  typedef LocalListIter<value_type, node_type>                local_iterator;
+  typedef LocalListIter<const value_type, node_type>    const_local_iterator;
+
+private:
+  /// Numbers of operations on the global list queued at a unit.
+  struct global_ops_descriptor {
+    size_type npush_front;
+    size_type npush_back;
+    size_type npop_front;
+    size_type npop_back;
+    size_type lsize;
+  };
+
+  /// First and last node in the local part of a unit's list.
+  struct local_links_descriptor {
+    dart_gptr_t head;
+    dart_gptr_t tail;
+    size_type   lsize;
+  };
+
+  /// Address range of an attached local bucket of list nodes.
+  struct bucket_range {
+    const node_type * lbegin;
+    const node_type * lend;
+    dart_gptr_t       gptr;
+  };
 
 public:
   /// Local proxy object, allows use in range-based for loops.
@@ -254,14 +290,39 @@ private:
   /// Number of elements in the list.
   size_type            _remote_size
                          = 0;
-  /// Native pointer to first local element in the list.
-  local_iterator       _lbegin;
-  /// Native pointer past the last local element in the list.
-  local_iterator       _lend;
-  /// Sentinel node in empty list.
+  /// Sentinel node of the local list, preceding the first and following
+  /// the last local element.
   node_type            _nil_node;
   /// Mapping units to their number of local list elements.
   local_sizes_map      _local_sizes;
+  /// Number of local list elements of every unit at the last barrier.
+  std::vector<size_type> _unit_lsizes;
+  /// Next node in the local node pool that has not been used yet.
+  node_type          * _lpool_next
+                         = nullptr;
+  /// End of the bucket providing the local node pool.
+  node_type          * _lpool_end
+                         = nullptr;
+  /// Head of the list of released local nodes, linked by their successor.
+  node_type          * _lfree
+                         = nullptr;
+  /// Number of released local nodes.
+  size_type            _lnfree
+                         = 0;
+  /// Lock serializing updates of the local list and the local node pool.
+  local_lock_type      _llock;
+  /// Values to insert at the front of the global list in the next barrier.
+  std::vector<value_type> _push_front_values;
+  /// Values to insert at the back of the global list in the next barrier.
+  std::vector<value_type> _push_back_values;
+  /// Number of elements to remove from the front of the global list in
+  /// the next barrier.
+  size_type            _npop_front
+                         = 0;
+  /// Number of elements to remove from the back of the global list in
+  /// the next barrier.
+  size_type            _npop_back
+                         = 0;
   /// Capacity of local buffer containing locally added node elements that
   /// have not been committed to global memory yet.
   /// Default is 4 KB.
@@ -282,6 +343,8 @@ public:
     _myid(team.myid())
   {
     DASH_LOG_TRACE("List() >", "default constructor");
+    _nil_node.lprev = &_nil_node;
+    _nil_node.lnext = &_nil_node;
   }
 
   /**
@@ -343,23 +406,27 @@ public:
    * inserted element.
    * Increases the container size by one.
    *
-   * The operation takes immediate effect for the calling unit.
-   * For other units, changes will only be visible after the next call of
-   * \c barrier.
    * As one-sided, non-collective allocation on remote units is not possible
-   * with most DART communication backends, the new list element is allocated
-   * locally and moved to its final position in global memory in \c barrier.
+   * with most DART communication backends, the element is inserted at the
+   * end of the local list of the last unit in the next call of \c barrier.
+   * Elements pushed by different units are inserted in the order of their
+   * unit ids.
    */
-  void push_back(const value_type & element)
+  void push_back(const value_type & value)
   {
+    _push_back_values.push_back(value);
   }
 
   /**
    * Removes and destroys the last element in the list, reducing the
    * container size by one.
+   *
+   * The element is removed in the next call of \c barrier, after elements
+   * pushed to the list have been inserted.
    */
   void pop_back()
   {
+    ++_npop_back;
   }
 
   /**
@@ -367,6 +434,9 @@ public:
    */
   reference back()
   {
+    iterator last = _end;
+    --last;
+    return *last;
   }
 
   /**
@@ -375,23 +445,28 @@ public:
    * inserted element.
    * Increases the container size by one.
    *
-   * The operation takes immediate effect for the calling unit.
-   * For other units, changes will only be visible after the next call of
-   * \c barrier.
    * As one-sided, non-collective allocation on remote units is not possible
-   * with most DART communication backends, the new list element is allocated
-   * locally and moved to its final position in global memory in \c barrier.
+   * with most DART communication backends, the element is inserted at the
+   * beginning of the local list of the first unit in the next call of
+   * \c barrier.
+   * Elements pushed by different units are inserted in the order of their
+   * unit ids.
    */
   void push_front(const value_type & value)
   {
+    _push_front_values.push_back(value);
   }
 
   /**
    * Removes and destroys the first element in the list, reducing the
    * container size by one.
+   *
+   * The element is removed in the next call of \c barrier, after elements
+   * pushed to the list have been inserted.
    */
   void pop_front()
   {
+    ++_npop_front;
   }
 
   /**
@@ -399,6 +474,7 @@ public:
    */
   reference front()
   {
+    return *_begin;
   }
 
   /**
@@ -412,7 +488,7 @@ public:
   /**
    * Global pointer to the beginning of the list.
    */
-  constexpr const_iterator begin() const noexcept
+  const_iterator begin() const noexcept
   {
     return _begin;
   }
@@ -428,41 +504,41 @@ public:
   /**
    * Global pointer to the end of the list.
    */
-  constexpr const_iterator end() const noexcept
+  const_iterator end() const noexcept
   {
     return _end;
   }
 
   /**
-   * Native pointer to the first local element in the list.
+   * Iterator to the first local element in the list.
    */
   local_iterator lbegin() noexcept
   {
-    return _lbegin;
+    return local_iterator(_nil_node.lnext);
   }
 
   /**
-   * Native pointer to the first local element in the list.
+   * Iterator to the first local element in the list.
    */
-  constexpr const_local_iterator lbegin() const noexcept
+  const_local_iterator lbegin() const noexcept
   {
-    return _lbegin;
+    return const_local_iterator(_nil_node.lnext);
   }
 
   /**
-   * Native pointer to the end of the list.
+   * Iterator past the last local element in the list.
    */
   local_iterator lend() noexcept
   {
-    return _lend;
+    return local_iterator(&_nil_node);
   }
 
   /**
-   * Native pointer to the end of the list.
+   * Iterator past the last local element in the list.
    */
-  constexpr const_local_iterator lend() const noexcept
+  const_local_iterator lend() const noexcept
   {
-    return _lend;
+    return const_local_iterator(const_cast<node_type *>(&_nil_node));
   }
 
   /**
@@ -508,25 +584,44 @@ public:
   /**
    * Removes and destroys single element referenced by given iterator from
    * the container, decreasing the container size by 1.
+   * Only elements local to the calling unit can be removed.
    *
    * \return  iterator to the element that follows the last element removed,
    *          or \c end() if the last element was removed.
    */
   inline iterator erase(const_iterator position)
   {
-    return _begin;
+    dart_gptr_t gnode = position.dart_gptr();
+    if (gnode.unitid != _myid.id) {
+      DASH_THROW(dash::exception::NotImplemented,
+                 "dash::List.erase is only implemented for local elements");
+    }
+    void * addr = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(gnode, &addr),
+      DART_OK);
+    node_type * node = static_cast<node_type *>(addr);
+    iterator    next(_globmem, node->gnext, node->gprev);
+    std::lock_guard<local_lock_type> lock(_llock);
+    _erase_local(node);
+    return next;
   }
 
   /**
    * Removes and destroys elements in the given range from the container,
    * decreasing the container size by the number of elements removed.
+   * Only elements local to the calling unit can be removed.
    *
    * \return  iterator to the element that follows the last element removed,
    *          or \c end() if the last element was removed.
    */
   inline iterator erase(const_iterator first, const_iterator last)
   {
-    return _end;
+    iterator next(_globmem, first.dart_gptr(), first.dart_gptr_prev());
+    while (next != last) {
+      next = erase(next);
+    }
+    return next;
   }
 
   /**
@@ -577,23 +672,102 @@ public:
   /**
    * Establish a barrier for all units operating on the list, publishing all
    * changes to all units.
+   *
+   * Applies pending global insert and remove operations, attaches local
+   * memory allocated since the last barrier and links the local lists of
+   * all units to the global list.
    */
   void barrier()
   {
     DASH_LOG_TRACE_VAR("List.barrier()", _team);
+    if (_globmem == nullptr) {
+      return;
+    }
+    // Apply global push and pop operations queued at all units:
+    _apply_global_ops();
     // Apply changes in local memory spaces to global memory space:
-    if (_globmem != nullptr) {
-      _globmem->commit();
+    _globmem->commit();
+    // Link local lists and accumulate local sizes of remote units:
+    _link_global();
+    DASH_LOG_TRACE("List.barrier()", "passed barrier");
+  }
+
+  /**
+   * Redistributes the list's elements such that all units hold the same
+   * number of elements, preserving their order in the global list.
+   * Elements are moved between units in a single all-to-all exchange.
+   *
+   * Invalidates all iterators and references to list elements.
+   *
+   * Collective operation.
+   */
+  void rebalance()
+  {
+    DASH_LOG_TRACE("List.rebalance()");
+    barrier();
+    if (_globmem == nullptr) {
+      return;
     }
-    // Accumulate local sizes of remote units:
-    _remote_size = 0;
-    for (int u = 0; u < _team->size(); ++u) {
-      if (u != _myid) {
-        size_type local_size_u  = _local_sizes[u];
-        _remote_size           += local_size_u;
+    constexpr size_type elem_bytes = sizeof(value_type);
+    size_type nunits  = _team->size();
+    size_type myid    = _myid.id;
+    size_type nglobal = size();
+    // Global offsets of the units' local lists before and after
+    // rebalancing:
+    std::vector<size_type> offsets(nunits + 1, 0);
+    std::vector<size_type> targets(nunits + 1, 0);
+    for (size_type u = 0; u < nunits; ++u) {
+      offsets[u + 1] = offsets[u] + _unit_lsizes[u];
+      targets[u + 1] = targets[u] + nglobal / nunits
+                       + (u < nglobal % nunits ? 1 : 0);
+    }
+    auto overlap = [](size_type first_a, size_type last_a,
+                      size_type first_b, size_type last_b) -> size_type {
+                     auto first = std::max(first_a, first_b);
+                     auto last  = std::min(last_a,  last_b);
+                     return last > first ? last - first : 0;
+                   };
+    std::vector<size_type> nsend(nunits, 0);
+    std::vector<size_type> nrecv(nunits, 0);
+    std::vector<size_type> sdispls(nunits, 0);
+    std::vector<size_type> rdispls(nunits, 0);
+    for (size_type u = 0; u < nunits; ++u) {
+      nsend[u] = elem_bytes * overlap(offsets[myid], offsets[myid + 1],
+                                      targets[u],    targets[u + 1]);
+      nrecv[u] = elem_bytes * overlap(offsets[u],    offsets[u + 1],
+                                      targets[myid], targets[myid + 1]);
+      if (u > 0) {
+        sdispls[u] = sdispls[u - 1] + nsend[u - 1];
+        rdispls[u] = rdispls[u - 1] + nrecv[u - 1];
       }
     }
-    DASH_LOG_TRACE("List.barrier()", "passed barrier");
+    // Local elements in list order are sent to consecutive units:
+    std::vector<char> sendbuf(lsize() * elem_bytes);
+    {
+      char * send_pos = sendbuf.data();
+      for (auto lit = lbegin(); lit != lend(); ++lit) {
+        std::memcpy(send_pos, &(*lit), elem_bytes);
+        send_pos += elem_bytes;
+      }
+    }
+    size_type nrecv_elem = targets[myid + 1] - targets[myid];
+    std::vector<char> recvbuf(nrecv_elem * elem_bytes);
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(sendbuf.data(), nsend.data(), sdispls.data(),
+                     recvbuf.data(), nrecv.data(), rdispls.data(),
+                     DART_TYPE_BYTE, _team->dart_id()),
+      DART_OK);
+    // Replace local elements by received elements:
+    _clear_local();
+    _reserve_nodes(nrecv_elem);
+    for (size_type i = 0; i < nrecv_elem; ++i) {
+      _insert_local(
+        &_nil_node,
+        *reinterpret_cast<const value_type *>(
+           recvbuf.data() + i * elem_bytes));
+    }
+    barrier();
+    DASH_LOG_TRACE("List.rebalance >", "local size:", lsize());
   }
 
   /**
@@ -628,18 +802,21 @@ public:
     auto lcap    = dash::math::div_ceil(nelem, _team->size());
     // Initialize members:
     _myid        = _team->myid();
+    _unit_lsizes.assign(_team->size(), 0);
     // Allocate local memory of identical size on every unit:
     DASH_LOG_TRACE_VAR("List.allocate", lcap);
 
     _globmem     = new glob_mem_type(lcap, *_team);
     // Global iterators:
-    _begin       = iterator(_globmem, _nil_node);
+    _begin       = iterator(_globmem, DART_GPTR_NULL, DART_GPTR_NULL);
     _end         = _begin;
-    // Local iterators:
-    _lbegin      = _globmem->lbegin();
-    // More efficient than using _globmem->lend as this a second mapping
-    // of the local memory segment:
-    _lend        = _lbegin;
+    // Local node pool and empty local list:
+    _lpool_next  = static_cast<node_type *>(_globmem->lbegin());
+    _lpool_end   = _lpool_next + lcap;
+    _lfree       = nullptr;
+    _lnfree      = 0;
+    _nil_node.lprev = &_nil_node;
+    _nil_node.lnext = &_nil_node;
     DASH_LOG_TRACE_VAR("List.allocate", _myid);
     // Register deallocator of this list instance at the team
     // instance that has been used to initialized it:
@@ -683,9 +860,373 @@ public:
     }
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
+    _lpool_next           = nullptr;
+    _lpool_end            = nullptr;
+    _lfree                = nullptr;
+    _lnfree               = 0;
+    _nil_node.lprev       = &_nil_node;
+    _nil_node.lnext       = &_nil_node;
+    _push_front_values.clear();
+    _push_back_values.clear();
+    _npop_front           = 0;
+    _npop_back            = 0;
     DASH_LOG_TRACE_VAR("List.deallocate >", this);
   }
 
+private:
+  /**
+   * Acquires a node from the local node pool, growing the pool by the
+   * local buffer size if no released or unused nodes are left.
+   */
+  node_type * _allocate_node()
+  {
+    node_type * node;
+    if (_lfree != nullptr) {
+      node    = _lfree;
+      _lfree  = node->lnext;
+      --_lnfree;
+    } else {
+      if (_lpool_next == _lpool_end) {
+        _grow_pool(_local_buffer_size);
+      }
+      node = _lpool_next++;
+    }
+    return new (node) node_type();
+  }
+
+  /**
+   * Returns a node to the local node pool.
+   */
+  void _release_node(node_type * node)
+  {
+    node->lprev = nullptr;
+    node->lnext = _lfree;
+    _lfree      = node;
+    ++_lnfree;
+  }
+
+  /**
+   * Adds a new bucket of the given number of nodes to the local node pool.
+   * Unused nodes of the previous bucket are released.
+   */
+  void _grow_pool(size_type nnodes)
+  {
+    DASH_LOG_TRACE("List._grow_pool()", "globmem.grow(", nnodes, ")");
+    while (_lpool_next != _lpool_end) {
+      _release_node(_lpool_next++);
+    }
+    _lpool_next = static_cast<node_type *>(_globmem->grow(nnodes));
+    _lpool_end  = _lpool_next + nnodes;
+  }
+
+  /**
+   * Grows the local node pool at most once such that the given number of
+   * nodes can be allocated.
+   */
+  void _reserve_nodes(size_type nnodes)
+  {
+    size_type navail = _lnfree + (_lpool_end - _lpool_next);
+    if (nnodes > navail) {
+      _grow_pool(std::max(nnodes - navail, _local_buffer_size));
+    }
+  }
+
+  /**
+   * Inserts a new local node holding the given value before the given
+   * local node.
+   *
+   * \return  The inserted node.
+   */
+  node_type * _insert_local(
+    node_type        * position,
+    const value_type & value)
+  {
+    node_type * node = _allocate_node();
+    node->value      = value;
+    node->lprev      = position->lprev;
+    node->lnext      = position;
+    position->lprev->lnext = node;
+    position->lprev        = node;
+    ++(_local_sizes.local[0]);
+    return node;
+  }
+
+  /**
+   * Removes the given node from the local list and returns it to the
+   * local node pool.
+   *
+   * \return  The node that followed the removed node.
+   */
+  node_type * _erase_local(node_type * node)
+  {
+    node_type * next   = node->lnext;
+    node->lprev->lnext = next;
+    next->lprev        = node->lprev;
+    _release_node(node);
+    --(_local_sizes.local[0]);
+    return next;
+  }
+
+  /**
+   * Copies the value of the given node to \c value and removes the node
+   * from the local list, unless it is the sentinel node of the empty list.
+   *
+   * \return  True if the node has been removed.
+   */
+  bool _pop_local(node_type * node, value_type & value)
+  {
+    if (node == &_nil_node) {
+      return false;
+    }
+    value = node->value;
+    _erase_local(node);
+    return true;
+  }
+
+  /**
+   * Moves the local nodes in the range \c [first, last) before the given
+   * local node.
+   */
+  void _splice_local(
+    node_type * position,
+    node_type * first,
+    node_type * last)
+  {
+    if (first == last || position == first || position == last) {
+      return;
+    }
+    node_type * final  = last->lprev;
+    // Unlink range:
+    first->lprev->lnext = last;
+    last->lprev         = first->lprev;
+    // Link range before position:
+    first->lprev           = position->lprev;
+    final->lnext           = position;
+    position->lprev->lnext = first;
+    position->lprev        = final;
+  }
+
+  /**
+   * Removes all local nodes, returning them to the local node pool.
+   */
+  void _clear_local()
+  {
+    if (_nil_node.lnext != &_nil_node) {
+      _nil_node.lprev->lnext = _lfree;
+      _lfree                 = _nil_node.lnext;
+      _lnfree               += _local_sizes.local[0];
+    }
+    _nil_node.lprev       = &_nil_node;
+    _nil_node.lnext       = &_nil_node;
+    _local_sizes.local[0] = 0;
+  }
+
+  /**
+   * Applies push and pop operations on the global list that have been
+   * queued at all units since the last barrier.
+   * Pushed elements are inserted before elements are removed.
+   *
+   * Collective operation.
+   */
+  void _apply_global_ops()
+  {
+    constexpr size_type elem_bytes = sizeof(value_type);
+    size_type nunits = _team->size();
+    size_type myid   = _myid.id;
+    size_type last   = nunits - 1;
+
+    global_ops_descriptor desc;
+    desc.npush_front = _push_front_values.size();
+    desc.npush_back  = _push_back_values.size();
+    desc.npop_front  = _npop_front;
+    desc.npop_back   = _npop_back;
+    desc.lsize       = lsize();
+    std::vector<global_ops_descriptor> descs(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&desc, descs.data(), sizeof(global_ops_descriptor),
+                     DART_TYPE_BYTE, _team->dart_id()),
+      DART_OK);
+    global_ops_descriptor total = { 0, 0, 0, 0, 0 };
+    for (const auto & d : descs) {
+      total.npush_front += d.npush_front;
+      total.npush_back  += d.npush_back;
+      total.npop_front  += d.npop_front;
+      total.npop_back   += d.npop_back;
+    }
+    if (total.npush_front + total.npush_back > 0) {
+      // Values pushed to the front are sent to the first unit, values
+      // pushed to the back are sent to the last unit:
+      std::vector<size_type> nsend(nunits, 0);
+      std::vector<size_type> nrecv(nunits, 0);
+      std::vector<size_type> sdispls(nunits, 0);
+      std::vector<size_type> rdispls(nunits, 0);
+      nsend[0]    += desc.npush_front * elem_bytes;
+      nsend[last] += desc.npush_back  * elem_bytes;
+      for (size_type u = 0; u < nunits; ++u) {
+        nrecv[u] = elem_bytes *
+                   ((myid == 0    ? descs[u].npush_front : 0) +
+                    (myid == last ? descs[u].npush_back  : 0));
+        if (u > 0) {
+          sdispls[u] = sdispls[u - 1] + nsend[u - 1];
+          rdispls[u] = rdispls[u - 1] + nrecv[u - 1];
+        }
+      }
+      std::vector<char> sendbuf(nsend[0] + (last > 0 ? nsend[last] : 0));
+      if (desc.npush_front > 0) {
+        std::memcpy(sendbuf.data(), _push_front_values.data(),
+                    desc.npush_front * elem_bytes);
+      }
+      if (desc.npush_back > 0) {
+        std::memcpy(sendbuf.data() + desc.npush_front * elem_bytes,
+                    _push_back_values.data(),
+                    desc.npush_back * elem_bytes);
+      }
+      std::vector<char> recvbuf(rdispls[last] + nrecv[last]);
+      DASH_ASSERT_RETURNS(
+        dart_alltoallv(sendbuf.data(), nsend.data(), sdispls.data(),
+                       recvbuf.data(), nrecv.data(), rdispls.data(),
+                       DART_TYPE_BYTE, _team->dart_id()),
+        DART_OK);
+      _reserve_nodes(recvbuf.size() / elem_bytes);
+      auto recv_pos = reinterpret_cast<const value_type *>(recvbuf.data());
+      for (size_type u = 0; u < nunits; ++u) {
+        if (myid == 0) {
+          for (size_type i = 0; i < descs[u].npush_front; ++i) {
+            _insert_local(_nil_node.lnext, *recv_pos++);
+          }
+        }
+        if (myid == last) {
+          for (size_type i = 0; i < descs[u].npush_back; ++i) {
+            _insert_local(&_nil_node, *recv_pos++);
+          }
+        }
+      }
+    }
+    if (total.npop_front + total.npop_back > 0) {
+      // Local sizes of all units after inserting pushed values:
+      std::vector<size_type> lsizes(nunits);
+      for (size_type u = 0; u < nunits; ++u) {
+        lsizes[u] = descs[u].lsize;
+      }
+      lsizes[0]    += total.npush_front;
+      lsizes[last] += total.npush_back;
+      // Elements are removed from the first and last non-empty units:
+      size_type npop = total.npop_front;
+      for (size_type u = 0; u < nunits && npop > 0; ++u) {
+        size_type nlpop = std::min(npop, lsizes[u]);
+        for (size_type i = 0; u == myid && i < nlpop; ++i) {
+          _erase_local(_nil_node.lnext);
+        }
+        lsizes[u] -= nlpop;
+        npop      -= nlpop;
+      }
+      npop = total.npop_back;
+      for (size_type u = nunits; u > 0 && npop > 0; --u) {
+        size_type nlpop = std::min(npop, lsizes[u - 1]);
+        for (size_type i = 0; u - 1 == myid && i < nlpop; ++i) {
+          _erase_local(_nil_node.lprev);
+        }
+        lsizes[u - 1] -= nlpop;
+        npop          -= nlpop;
+      }
+    }
+    _push_front_values.clear();
+    _push_back_values.clear();
+    _npop_front = 0;
+    _npop_back  = 0;
+  }
+
+  /**
+   * Updates the global links of all local nodes and links the local list
+   * to the local lists of the preceding and following units.
+   * Local memory must be attached to global memory.
+   *
+   * Collective operation.
+   */
+  void _link_global()
+  {
+    size_type nunits = _team->size();
+    size_type myid   = _myid.id;
+    // Address ranges of local buckets, sorted by their native address:
+    std::vector<bucket_range> buckets;
+    for (const auto & bucket : _globmem->local_buckets()) {
+      if (bucket.size > 0 && bucket.attached) {
+        buckets.push_back({ bucket.lptr, bucket.lptr + bucket.size,
+                            bucket.gptr });
+      }
+    }
+    std::sort(buckets.begin(), buckets.end(),
+              [](const bucket_range & a, const bucket_range & b) {
+                return std::less<const node_type *>()(a.lbegin, b.lbegin);
+              });
+    auto node_gptr = [&](const node_type * node) -> dart_gptr_t {
+        auto bucket = std::upper_bound(
+                        buckets.begin(), buckets.end(), node,
+                        [](const node_type * n, const bucket_range & b) {
+                          return std::less<const node_type *>()(n, b.lbegin);
+                        });
+        DASH_ASSERT(bucket != buckets.begin());
+        --bucket;
+        dart_gptr_t gptr = bucket->gptr;
+        DASH_ASSERT_RETURNS(
+          dart_gptr_setunit(&gptr, _myid),
+          DART_OK);
+        DASH_ASSERT_RETURNS(
+          dart_gptr_incaddr(&gptr, (node - bucket->lbegin) * sizeof(node_type)),
+          DART_OK);
+        return gptr;
+      };
+    // Link local nodes:
+    local_links_descriptor desc = { DART_GPTR_NULL, DART_GPTR_NULL, lsize() };
+    for (node_type * node = _nil_node.lnext;
+         node != &_nil_node; node = node->lnext) {
+      dart_gptr_t gnode = node_gptr(node);
+      node->gprev = desc.tail;
+      if (node->lprev != &_nil_node) {
+        node->lprev->gnext = gnode;
+      } else {
+        desc.head = gnode;
+      }
+      desc.tail = gnode;
+    }
+    std::vector<local_links_descriptor> descs(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&desc, descs.data(), sizeof(local_links_descriptor),
+                     DART_TYPE_BYTE, _team->dart_id()),
+      DART_OK);
+    // Link local list to non-empty lists of preceding and following units:
+    dart_gptr_t gfirst = DART_GPTR_NULL;
+    dart_gptr_t glast  = DART_GPTR_NULL;
+    dart_gptr_t gprev  = DART_GPTR_NULL;
+    dart_gptr_t gnext  = DART_GPTR_NULL;
+    _remote_size = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      _unit_lsizes[u] = descs[u].lsize;
+      if (descs[u].lsize == 0) {
+        continue;
+      }
+      if (u != myid) {
+        _remote_size += descs[u].lsize;
+      }
+      if (DART_GPTR_ISNULL(gfirst)) {
+        gfirst = descs[u].head;
+      }
+      if (u < myid) {
+        gprev = descs[u].tail;
+      }
+      if (u > myid && DART_GPTR_ISNULL(gnext)) {
+        gnext = descs[u].head;
+      }
+      glast = descs[u].tail;
+    }
+    if (lsize() > 0) {
+      _nil_node.lnext->gprev = gprev;
+      _nil_node.lprev->gnext = gnext;
+    }
+    _begin = iterator(_globmem, gfirst,         DART_GPTR_NULL);
+    _end   = iterator(_globmem, DART_GPTR_NULL, glast);
+  }
+
 };
 
 } // namespace dash
@@ -10,6 +10,9 @@ namespace dash {
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
  *
+ * Units waiting for the mutex are queued and do not poll a single remote
+ * location, so the mutex scales with the number of contending units.
+ *
  * \note This works properly with \c std::lock_guard
  * \note Mutex cannot be placed in DASH containers
  *
@@ -94,12 +97,74 @@ public:
    */
   void unlock();
 
+protected:
+  /**
+   * Create a mutex, which supports shared ownership if \c shared is true.
+   */
+  Mutex(Team& team, bool shared);
+
+  dart_lock_t dart_lock() const noexcept
+  {
+    return _mutex.get();
+  }
+
 private:
   dash::Team const* _team{nullptr};
+  bool              _shared{false};
   std::unique_ptr<std::remove_pointer<dart_lock_t>::type, DestroyDARTLock>
       _mutex{DART_LOCK_NULL};
 };  // class Mutex
 
+/**
+ * Behaves similar to \c std::shared_mutex: in addition to exclusive
+ * ownership through \c lock() and \c try_lock(), multiple units can
+ * share ownership through \c lock_shared() and \c try_lock_shared(),
+ * e.g., to read data protected by the mutex.
+ *
+ * Acquiring shared ownership is cheaper than exclusive ownership as it
+ * only requires an atomic update on the unit holding the mutex state.
+ *
+ * \note This works properly with \c std::lock_guard and, since C++14,
+ *       \c std::shared_lock
+ *
+ * \code
+ * dash::SharedMutex mx;
+ * mx.lock_shared();
+ * // read data protected by mx
+ * mx.unlock_shared();
+ * \endcode
+ */
+class SharedMutex : public Mutex {
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team& team = dash::Team::All())
+  : Mutex(team, true)
+  { }
+
+  /**
+   * Block until the lock was acquired in shared mode.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock in shared mode and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Release the lock acquired through \c lock_shared() or
+   * \c try_lock_shared().
+   */
+  void unlock_shared();
+};  // class SharedMutex
+
 }  // namespace dash
 
 #endif  // DASH__MUTEX_H__INCLUDED
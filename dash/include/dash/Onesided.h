@@ -142,6 +142,59 @@ namespace internal {
       DART_OK);
   }
 
+  /**
+   * Write of \c nelem values from \c src to the global memory
+   * location referenced by \c gptr. Adds the operation to a handle group
+   * that can be used to wait for completion.
+   *
+   * \sa dart_put_group
+   */
+  template<typename T>
+  inline
+  void
+  put_group(
+    const dart_gptr_t   & gptr,
+    const T             * src,
+    size_t                nelem,
+    dart_handle_group_t   group) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put_group(gptr,
+                     src,
+                     ds.nelem,
+                     ds.dtype,
+                     ds.dtype,
+                     group),
+      DART_OK);
+  }
+
+  /**
+   * Non-blocking read of \c nelem values the global memory
+   * location referenced by \c gptr into memory referenced by \c src.
+   * Adds the operation to a handle group that can be used to wait for
+   * completion.
+   *
+   * \sa dart_get_group
+   */
+  template<typename T>
+  inline
+  void
+  get_group(
+    const dart_gptr_t   & gptr,
+    T                   * dst,
+    size_t                nelem,
+    dart_handle_group_t   group) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_get_group(dst,
+                     gptr,
+                     ds.nelem,
+                     ds.dtype,
+                     ds.dtype,
+                     group),
+      DART_OK);
+  }
+
 } // namespace internal
 
 /**
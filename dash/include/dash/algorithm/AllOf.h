@@ -29,7 +29,7 @@ bool all_of(
   /// Predicate applied to the elements in range [first, last)
   UnaryPredicate p)
 {
-  return find_if_not(first, last, p) == last;
+  return dash::find_if_not(first, last, p) == last;
 }
 
 } // namespace dash
@@ -28,7 +28,7 @@ bool any_of(
   /// Predicate applied to the elements in range [first, last)
   UnaryPredicate                       p)
 {
-  return find_if(first, last, p) != last;
+  return dash::find_if(first, last, p) != last;
 }
 
 } // namespace dash
@@ -93,6 +93,21 @@ dash::Future<ValueType *> copy_async(
 
 namespace internal {
 
+/**
+ * Create a DART handle group collecting the requests of the transfers of a
+ * copy operation. The group is destroyed with the last reference to it.
+ */
+inline std::shared_ptr<dart_handle_group_struct> make_handle_group()
+{
+  dart_handle_group_t group;
+  DASH_ASSERT_RETURNS(
+    dart_handle_group_create(&group),
+    DART_OK);
+  return std::shared_ptr<dart_handle_group_struct>(
+           group,
+           [](dart_handle_group_t g) { dart_handle_group_destroy(&g); });
+}
+
 // =========================================================================
 // Global to Local
 // =========================================================================
@@ -108,7 +123,7 @@ ValueType * copy_impl(
   GlobInputIt                  in_first,
   GlobInputIt                  in_last,
   ValueType                  * out_first,
-  std::vector<dart_handle_t> & handles)
+  dart_handle_group_t          group)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "in_first:",  in_first.pos(),
@@ -147,15 +162,11 @@ ValueType * copy_impl(
                     "get elements:",   num_elem_total);
     auto cur_in_first  = g_in_first;
     auto cur_out_first = out_first;
-    dart_handle_t handle;
-    dash::internal::get_handle(
+    dash::internal::get_group(
       cur_in_first.dart_gptr(),
       cur_out_first,
       num_elem_total,
-      &handle);
-    if (handle != DART_HANDLE_NULL) {
-      handles.push_back(handle);
-    }
+      group);
     num_elem_copied = num_elem_total;
   } else {
     // Input range is spread over several remote units:
@@ -198,12 +209,8 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto dest_ptr = out_first + num_elem_copied;
       auto src_gptr = cur_in_first.dart_gptr();
-      dart_handle_t handle;
-      dash::internal::get_handle(src_gptr, dest_ptr, num_copy_elem, &handle);
+      dash::internal::get_group(src_gptr, dest_ptr, num_copy_elem, group);
       num_elem_copied += num_copy_elem;
-      if (handle != DART_HANDLE_NULL) {
-        handles.push_back(handle);
-      }
     }
   }
 
@@ -227,7 +234,7 @@ GlobOutputIt copy_impl(
   ValueType                  * in_first,
   ValueType                  * in_last,
   GlobOutputIt                 out_first,
-  std::vector<dart_handle_t> & handles)
+  dart_handle_group_t          group)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "l_in_first:",  in_first,
@@ -235,15 +242,11 @@ GlobOutputIt copy_impl(
                  "g_out_first:", out_first);
 
   auto num_elements = std::distance(in_first, in_last);
-  dart_handle_t handle;
-  dash::internal::put_handle(
+  dash::internal::put_group(
     out_first.dart_gptr(),
     in_first,
     num_elements,
-    &handle);
-  if (handle != DART_HANDLE_NULL) {
-    handles.push_back(handle);
-  }
+    group);
 
   auto out_last = out_first + num_elements;
   DASH_LOG_TRACE("dash::copy_impl >",
@@ -330,7 +333,7 @@ dash::Future<ValueType *> copy_async(
     return dash::Future<ValueType *>(out_last);
   }
 
-  auto handles = std::make_shared<std::vector<dart_handle_t>>();
+  auto group = dash::internal::make_handle_group();
 
   DASH_LOG_TRACE("dash::copy_async", "local range:",
                  li_range_in.begin,
@@ -380,7 +383,7 @@ dash::Future<ValueType *> copy_async(
       dash::internal::copy_impl(g_in_first,
                                 g_l_in_first,
                                 dest_first,
-                                *handles);
+                                group.get());
       // Advance output pointers:
       out_last   += num_prelocal_elem;
       dest_first  = out_last;
@@ -403,7 +406,7 @@ dash::Future<ValueType *> copy_async(
       dash::internal::copy_impl(g_l_in_last,
                                 g_in_last,
                                 dest_first,
-                                *handles);
+                                group.get());
       out_last += num_postlocal_elem;
     }
     //
@@ -452,12 +455,14 @@ dash::Future<ValueType *> copy_async(
     dash::internal::copy_impl(in_first,
                               in_last,
                               dest_first,
-                              *handles);
+                              group.get());
     out_last = out_first + total_copy_elem;
   }
   DASH_LOG_TRACE("dash::copy_async", "preparing future");
-  if (handles->empty()) {
-    DASH_LOG_TRACE("dash::copy_async >", "finished (no pending handles), ",
+  size_t num_pending;
+  dart_handle_group_size(group.get(), &num_pending);
+  if (num_pending == 0) {
+    DASH_LOG_TRACE("dash::copy_async >", "finished (no pending requests), ",
                    "out_last:", out_last);
     return dash::Future<ValueType *>(out_last);
   }
@@ -467,19 +472,15 @@ dash::Future<ValueType *> copy_async(
       // Wait for all get requests to complete:
       ValueType * _out = out_last;
       DASH_LOG_TRACE("dash::copy_async_impl [Future]()",
-                    "  wait for", handles->size(), "async get request");
+                    "  wait for", num_pending, "async get requests");
       DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  _out:", _out);
-      if (!handles->empty()) {
-        if (dart_waitall_local(handles->data(), handles->size())
-            != DART_OK) {
-          DASH_LOG_ERROR("dash::copy_async_impl [Future]",
-                        "  dart_waitall_local failed");
-          DASH_THROW(
-            dash::exception::RuntimeError,
-            "dash::copy_async_impl [Future]: dart_waitall_local failed");
-        }
-      } else {
-        DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  No pending handles");
+      if (dart_handle_group_wait_local(group.get()) != DART_OK) {
+        DASH_LOG_ERROR("dash::copy_async_impl [Future]",
+                      "  dart_handle_group_wait_local failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::copy_async_impl [Future]: "
+          "dart_handle_group_wait_local failed");
       }
       DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
                     "  async requests completed, _out:", _out);
@@ -490,21 +491,13 @@ dash::Future<ValueType *> copy_async(
       int32_t flag;
       DASH_ASSERT_RETURNS(
         DART_OK,
-        dart_testall_local(handles->data(), handles->size(), &flag));
+        dart_handle_group_test_local(group.get(), &flag));
       if (flag) {
-        handles->clear();
         *out = out_last;
       }
       return (flag != 0);
-    },
-    // destroy
-    [=]() mutable {
-      for (auto& handle : *handles) {
-        DASH_ASSERT_RETURNS(
-          DART_OK,
-          dart_handle_free(&handle));
-      }
     }
+    // the handle group is released with the last copy of these functions
   );
 
   DASH_LOG_TRACE("dash::copy_async >", "finished,",
@@ -573,7 +566,8 @@ ValueType * copy(
     return out_last;
   }
 
-  std::vector<dart_handle_t> handles;
+  // Requests of all transfers, completed at once:
+  auto group = dash::internal::make_handle_group();
 
   DASH_LOG_TRACE("dash::copy", "local range:",
                  li_range_in.begin,
@@ -628,7 +622,7 @@ ValueType * copy(
       out_last = dash::internal::copy_impl(g_in_first,
                                            g_l_in_first,
                                            dest_first,
-                                           handles);
+                                           group.get());
       // Advance output pointers:
       dest_first = out_last;
     }
@@ -687,7 +681,7 @@ ValueType * copy(
       out_last = dash::internal::copy_impl(g_l_in_last,
                                            g_in_last,
                                            dest_first,
-                                           handles);
+                                           group.get());
     }
   } else {
     DASH_LOG_TRACE("dash::copy", "no local subrange");
@@ -695,14 +689,13 @@ ValueType * copy(
     out_last = dash::internal::copy_impl(in_first,
                                          in_last,
                                          dest_first,
-                                         handles);
+                                         group.get());
   }
 
-  if (!handles.empty()) {
-    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
-                  "num_handles: ", handles.size());
-    dart_waitall_local(handles.data(), handles.size());
-  }
+  DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete");
+  DASH_ASSERT_RETURNS(
+    dart_handle_group_wait_local(group.get()),
+    DART_OK);
 
   DASH_LOG_TRACE("dash::copy >", "finished,",
                  "out_last:", out_last);
@@ -727,36 +720,32 @@ dash::Future<GlobOutputIt> copy_async(
   ValueType    * in_last,
   GlobOutputIt   out_first)
 {
-  auto handles  = std::make_shared<std::vector<dart_handle_t>>();
+  auto group    = dash::internal::make_handle_group();
   auto out_last = dash::internal::copy_impl(in_first,
                                             in_last,
                                             out_first,
-                                            *handles);
+                                            group.get());
 
-  if (handles->empty()) {
+  size_t num_pending;
+  dart_handle_group_size(group.get(), &num_pending);
+  if (num_pending == 0) {
     return dash::Future<GlobOutputIt>(out_last);
   }
   dash::Future<GlobOutputIt> fut_result(
     // get
     [=]() mutable {
-      // Wait for all get requests to complete:
+      // Wait for all put requests to complete:
       GlobOutputIt _out = out_last;
       DASH_LOG_TRACE("dash::copy_async [Future]()",
-                    "  wait for", handles->size(), "async put request");
+                    "  wait for", num_pending, "async put requests");
       DASH_LOG_TRACE("dash::copy_async [Future]", "  _out:", _out);
-      if (!handles->empty()) {
-        if (dart_waitall(handles->data(), handles->size())
-            != DART_OK) {
-          DASH_LOG_ERROR("dash::copy_async [Future]",
-                        "  dart_waitall failed");
-          DASH_THROW(
-            dash::exception::RuntimeError,
-            "dash::copy_async [Future]: dart_waitall failed");
-        }
-      } else {
-        DASH_LOG_TRACE("dash::copy_async [Future]", "  No pending handles");
+      if (dart_handle_group_wait(group.get()) != DART_OK) {
+        DASH_LOG_ERROR("dash::copy_async [Future]",
+                      "  dart_handle_group_wait failed");
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::copy_async [Future]: dart_handle_group_wait failed");
       }
-      handles->clear();
       DASH_LOG_TRACE("dash::copy_async [Future] >",
                     "  async requests completed, _out:", _out);
       return _out;
@@ -766,21 +755,13 @@ dash::Future<GlobOutputIt> copy_async(
       int32_t flag;
       DASH_ASSERT_RETURNS(
         DART_OK,
-        dart_testall(handles->data(), handles->size(), &flag));
+        dart_handle_group_test(group.get(), &flag));
       if (flag) {
-        handles->clear();
         *out = out_last;
       }
       return (flag != 0);
-    },
-    // destroy
-    [=]() mutable {
-      for (auto& handle : *handles) {
-        DASH_ASSERT_RETURNS(
-          DART_OK,
-          dart_handle_free(&handle));
-      }
     }
+    // the handle group is released with the last copy of these functions
   );
   return fut_result;
 }
@@ -815,8 +796,8 @@ GlobOutputIt copy(
   DASH_LOG_TRACE_VAR("dash::copy", li_range_out.end);
   // Number of elements in the local subrange:
   auto num_local_elem     = li_range_out.end - li_range_out.begin;
-  // handles to wait on at the end
-  std::vector<dart_handle_t> handles;
+  // requests to wait on at the end
+  auto group              = dash::internal::make_handle_group();
   // Check if part of the output range is local:
   if (num_local_elem > 0) {
     // Part of the output range is local
@@ -857,7 +838,7 @@ GlobOutputIt copy(
                    in_first,
                    in_first + l_elem_offset,
                    out_first,
-                   handles);
+                   group.get());
     }
     // Copy to remote elements succeeding the local subrange:
     if (g_l_offset_end < out_h_last.pos()) {
@@ -866,7 +847,7 @@ GlobOutputIt copy(
                    in_first + l_elem_offset + num_local_elem,
                    in_last,
                    out_first + num_local_elem,
-                   handles);
+                   group.get());
     }
   } else {
     // All elements in output range are remote
@@ -875,14 +856,13 @@ GlobOutputIt copy(
                  in_first,
                  in_last,
                  out_first,
-                 handles);
+                 group.get());
   }
 
-  if (!handles.empty()) {
-    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
-                  "num_handles: ", handles.size());
-    dart_waitall(handles.data(), handles.size());
-  }
+  DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete");
+  DASH_ASSERT_RETURNS(
+    dart_handle_group_wait(group.get()),
+    DART_OK);
 
   return out_last;
 }
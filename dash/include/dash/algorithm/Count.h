@@ -0,0 +1,81 @@
+#ifndef DASH__ALGORITHM__COUNT_H__
+#define DASH__ALGORITHM__COUNT_H__
+
+#include <dash/Iterator.h>
+
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/TransformReduce.h>
+
+#include <type_traits>
+
+namespace dash {
+
+/**
+ * Returns the number of elements in the range \c [first, last) that
+ * satisfy the predicate \c p.
+ *
+ * Every unit counts the matching elements in its local portion of the
+ * range, using the threads available to the unit, and the local counts
+ * are summed up in a single allreduce.
+ *
+ * Collective operation.
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class GlobInputIt, class UnaryPredicate>
+typename dash::iterator_traits<GlobInputIt>::difference_type
+count_if(
+  /// Iterator to the initial position in the sequence
+  GlobInputIt    first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt    last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate p)
+{
+  using difference_type =
+    typename dash::iterator_traits<GlobInputIt>::difference_type;
+  using value_type = typename std::remove_cv<
+    typename dash::iterator_traits<GlobInputIt>::value_type>::type;
+
+  return dash::transform_reduce(
+           first, last,
+           difference_type(0),
+           dash::plus<difference_type>(),
+           [&p](const value_type & v) -> difference_type {
+             return p(v) ? 1 : 0;
+           });
+}
+
+/**
+ * Returns the number of elements in the range \c [first, last) that
+ * compare equal to \c value.
+ *
+ * Collective operation.
+ *
+ * \see dash::count_if
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class GlobInputIt, class ValueType>
+typename dash::iterator_traits<GlobInputIt>::difference_type
+count(
+  /// Iterator to the initial position in the sequence
+  GlobInputIt       first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt       last,
+  /// Value to compare the elements to using operator==
+  const ValueType & value)
+{
+  using value_type = typename std::remove_cv<
+    typename dash::iterator_traits<GlobInputIt>::value_type>::type;
+
+  return dash::count_if(
+           first, last,
+           [&value](const value_type & v) { return v == value; });
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COUNT_H__
@@ -1,100 +1,123 @@
 #ifndef DASH__ALGORITHM__FIND_H__
 #define DASH__ALGORITHM__FIND_H__
 
-#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Shared.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/iterator/GlobIter.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+/**
+ * Number of local elements a unit searches between two reads of the
+ * global index of the first match found so far.
+ */
+#ifndef DASH__FIND__CHUNK_ELEM
+#define DASH__FIND__CHUNK_ELEM (1 << 14)
+#endif
+
 namespace dash {
 
+namespace internal {
+
 /**
- * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
- * If no such element is found, the function returns \c last.
+ * Global index of the first element in the range \c [first,last) that
+ * satisfies the predicate \c p or \c std::numeric_limits<index_type>::max()
+ * if no such element exists.
  *
- * \ingroup     DashAlgorithms
+ * Units search their local range in chunks. The global index of the
+ * first match found so far is published in a shared atomic, a unit
+ * stops searching as soon as the remainder of its local range cannot
+ * contain an element preceding the published match.
  */
-template<
-  typename GlobIter,
-  typename ElementType>
-GlobIter find(
-  /// Iterator to the initial position in the sequence
-  GlobIter   first,
-  /// Iterator to the final position in the sequence
-  GlobIter   last,
-  /// Value which is searched for using operator==
-  const ElementType & value)
+template <typename GlobIter, typename UnaryPredicate>
+typename dash::iterator_traits<GlobIter>::index_type
+find_if_index(
+  GlobIter       first,
+  GlobIter       last,
+  UnaryPredicate predicate)
 {
-
-  //use iterator traits
   using iterator_traits = dash::iterator_traits<GlobIter>;
-
-  using p_index_t = typename iterator_traits::index_type;
-
-  if(first >= last) {
-    return last;
+  using index_t         = typename iterator_traits::index_type;
+  using pattern_t       = typename GlobIter::pattern_type;
+
+  constexpr index_t not_found = std::numeric_limits<index_t>::max();
+  // Local indices only map to ascending global indices in one-dimensional
+  // patterns:
+  constexpr bool ordered = pattern_t::ndim() == 1;
+
+  auto const & pattern     = first.pattern();
+  auto       & team        = pattern.team();
+  auto const   index_range = dash::local_index_range(first, last);
+  auto const   l_range     = dash::local_range(first, last);
+  index_t const n_l_elem   = index_range.end - index_range.begin;
+
+  DASH_LOG_DEBUG("dash::find_if", "local index range",
+                 index_range.begin, index_range.end);
+
+  // Global index of the first match found so far, only required if more
+  // than one unit searches:
+  std::unique_ptr<dash::Shared<dash::Atomic<index_t>>> g_found;
+  if (ordered && team.size() > 1) {
+    g_found.reset(new dash::Shared<dash::Atomic<index_t>>(
+                        not_found, dash::team_unit_t{0}, team));
   }
 
-  p_index_t g_index;
-  auto & pattern     = first.pattern();
-  auto & team        = pattern.team();
-  auto index_range   = dash::local_index_range(first, last);
-  auto l_begin_index = index_range.begin;
-  auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
-  if(l_begin_index == l_end_index){
-    g_index = std::numeric_limits<p_index_t>::max();
-  } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
-    // Pointer to first element in local memory:
-   auto const* lbegin = dash::local_begin(
-       static_cast<typename GlobIter::pointer>(first), team.myid());
-   // Pointers to first / final element in local range:
-   const auto l_range_begin = lbegin + l_begin_index;
-   const auto l_range_end   = lbegin + l_end_index;
-
-   DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
-
-   auto l_result = std::find(l_range_begin, l_range_end, value);
-   if (l_result == l_range_end) {
-     DASH_LOG_DEBUG("Not found in local range");
-     g_index = std::numeric_limits<p_index_t>::max();
-    } else {
-      auto l_hit_index = l_result - lbegin;
-      g_index = pattern.global(l_hit_index);
+  index_t l_found = not_found;
+  for (index_t l = 0; l < n_l_elem; l += DASH__FIND__CHUNK_ELEM) {
+    if (g_found) {
+      if (l > 0 &&
+          g_found->get().load() < pattern.global(index_range.begin + l)) {
+        DASH_LOG_DEBUG("dash::find_if", "match at preceding position found,",
+                       "stopping after", l, "elements");
+        break;
+      }
+    }
+    auto const l_chunk_end = std::min<index_t>(
+                               l + DASH__FIND__CHUNK_ELEM, n_l_elem);
+    auto const l_chunk_begin = l_range.begin + l;
+    auto const l_hit = std::find_if(
+                         l_chunk_begin, l_range.begin + l_chunk_end,
+                         predicate);
+    if (l_hit != l_range.begin + l_chunk_end) {
+      l_found = pattern.global(
+                  index_range.begin + l + (l_hit - l_chunk_begin));
+      if (g_found) {
+        g_found->get().fetch_op(dash::min<index_t>(), l_found);
+      }
+      break;
     }
   }
-  team.barrier();
-
-  // receive buffer for global maximal index
-  p_index_t g_hit_idx;
 
+  // Units only skip elements following a published match, so the first
+  // match is the minimum of the local matches:
+  index_t g_found_idx;
   DASH_ASSERT_RETURNS(
-      dart_allreduce(
-        &g_index,
-        &g_hit_idx,
-        1,
-        dart_datatype<p_index_t>::value,
-        DART_OP_MIN,
-        team.dart_id()),
-      DART_OK);
-
-  if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
-    DASH_LOG_DEBUG("element not found");
-  } else {
-    return first + g_hit_idx;
-  }
-  return last;
+    dart_allreduce(
+      &l_found,
+      &g_found_idx,
+      1,
+      dart_datatype<index_t>::value,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  return g_found_idx;
 }
 
+} // namespace internal
+
 /**
  * Returns an iterator to the first element in the range \c [first,last) that
  * satisfies the predicate \c p.
  * If no such element is found, the function returns \c last.
  *
+ * Units stop searching their local range once a preceding match has
+ * been found by another unit.
+ *
  * \see dash::find
  * \see dash::find_if_not
  *
@@ -109,39 +132,47 @@ GlobIter find_if(
     /// Predicate which will be applied to the elements in range [first, last)
     UnaryPredicate predicate)
 {
-  using iterator_traits = dash::iterator_traits<GlobIter>;
-
-  using index_t = typename iterator_traits::index_type;
+  using index_t = typename dash::iterator_traits<GlobIter>::index_type;
 
-  auto& team = first.pattern().team();
-  auto  myid = team.myid();
-  /// Global iterators to local range:
-  auto index_range = dash::local_range(first, last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-
-  auto l_result = std::find_if(l_first, l_last, predicate);
-  auto l_offset = l_result == l_last ? -1 : std::distance(l_first, l_result);
-
-  dash::Array<index_t> l_results(team.size(), team);
-
-  l_results.local[0] = l_offset;
-
-  team.barrier();
-
-  // All local offsets stored in l_results
-  auto result = last;
+  if (first >= last) {
+    return last;
+  }
 
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern().global_index(u, {l_results[u]});
-      result        = first + g_offset - first.pos();
-      break;
-    }
+  auto const g_found_idx = dash::internal::find_if_index(
+                             first, last, predicate);
+  if (g_found_idx == std::numeric_limits<index_t>::max()) {
+    DASH_LOG_DEBUG("dash::find_if", "element not found");
+    return last;
   }
+  return first + (g_found_idx - first.pos());
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * Units stop searching their local range once a preceding match has
+ * been found by another unit.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename GlobIter,
+  typename ElementType>
+GlobIter find(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  using value_type = typename dash::iterator_traits<GlobIter>::value_type;
 
-  team.barrier();
-  return result;
+  return dash::find_if(
+           first, last,
+           [&value](const value_type & v) { return v == value; });
 }
 
 /**
@@ -165,7 +196,11 @@ GlobIter find_if_not(
     /// Predicate which will be applied to the elements in range [first, last)
     UnaryPredicate predicate)
 {
-  return find_if(first, last, std::not1(predicate));
+  using value_type = typename dash::iterator_traits<GlobIter>::value_type;
+
+  return dash::find_if(
+           first, last,
+           [&predicate](const value_type & v) { return !predicate(v); });
 }
 
 } // namespace dash
@@ -1,14 +1,203 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/Future.h>
+#include <dash/LaunchPolicy.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Threads.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Number of local elements processed by a thread at a time in parallel
+ * execution policies of \c dash::for_each.
+ */
+#define DASH__FOR_EACH__CHUNK_ELEM (1 << 10)
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Number of threads used by the calling unit in parallel execution
+ * policies to process the local elements in the global range
+ * \c [first, last), at least one chunk of \c DASH__FOR_EACH__CHUNK_ELEM
+ * elements per thread.
+ */
+template <typename GlobInputIt>
+inline int for_each_num_threads(
+  const GlobInputIt & first,
+  const GlobInputIt & last)
+{
+  auto index_range = dash::local_index_range(first, last);
+  return dash::internal::num_local_threads(
+           index_range.end - index_range.begin,
+           first.pattern().team(),
+           DASH__FOR_EACH__CHUNK_ELEM);
+}
+
+/**
+ * Invokes \c func on every local index in \c [lbegin_index, lend_index)
+ * in chunks of \c DASH__FOR_EACH__CHUNK_ELEM indices distributed to
+ * \c nthreads threads.
+ */
+template <class IndexType, class IndexFunction>
+void for_each_local_index(
+  IndexType     lbegin_index,
+  IndexType     lend_index,
+  IndexFunction func,
+  int           nthreads)
+{
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(dynamic, 1) \
+    if (nthreads > 1)
+#else
+  (void)nthreads;
+#endif
+  for (IndexType chunk = lbegin_index; chunk < lend_index;
+       chunk += DASH__FOR_EACH__CHUNK_ELEM) {
+    IndexType const chunk_end = std::min<IndexType>(
+                                  chunk + DASH__FOR_EACH__CHUNK_ELEM,
+                                  lend_index);
+    for (IndexType lindex = chunk; lindex < chunk_end; ++lindex) {
+      func(lindex);
+    }
+  }
+}
+
+/**
+ * Invokes \c func on the local elements in the global range
+ * \c [first, last), passing the global index of the element if
+ * \c WithIndex is \c true.
+ */
+template <bool WithIndex, typename GlobInputIt, class Function>
+struct for_each_local_body;
+
+template <typename GlobInputIt, class Function>
+struct for_each_local_body<false, GlobInputIt, Function>
+{
+  typedef typename GlobInputIt::pattern_type     pattern_type;
+  typedef typename pattern_type::index_type      index_type;
+  typedef typename std::remove_reference<
+            decltype(*dash::local_begin(
+              std::declval<typename GlobInputIt::pointer>(),
+              dash::team_unit_t{}))>::type        local_value_type;
+
+  local_value_type   * lbegin;
+  const pattern_type * pattern;
+  Function             func;
+
+  void operator()(index_type lindex) {
+    func(lbegin[lindex]);
+  }
+};
+
+template <typename GlobInputIt, class Function>
+struct for_each_local_body<true, GlobInputIt, Function>
+{
+  typedef typename GlobInputIt::pattern_type     pattern_type;
+  typedef typename pattern_type::index_type      index_type;
+  typedef typename std::remove_reference<
+            decltype(*dash::local_begin(
+              std::declval<typename GlobInputIt::pointer>(),
+              dash::team_unit_t{}))>::type        local_value_type;
+
+  local_value_type   * lbegin;
+  const pattern_type * pattern;
+  Function             func;
+
+  void operator()(index_type lindex) {
+    func(lbegin[lindex], pattern->global(lindex));
+  }
+};
+
+/**
+ * Creates the function invoked on the local elements of the global range
+ * starting at \c first, resolving the begin of the local memory range.
+ */
+template <bool WithIndex, typename GlobInputIt, class Function>
+for_each_local_body<WithIndex, GlobInputIt, Function>
+make_for_each_local_body(
+  const GlobInputIt & first,
+  Function            func)
+{
+  auto & pattern = first.pattern();
+  GlobInputIt first_it(first);
+  return for_each_local_body<WithIndex, GlobInputIt, Function> {
+    dash::local_begin(
+      static_cast<typename GlobInputIt::pointer>(first_it),
+      pattern.team().myid()),
+    &pattern,
+    func
+  };
+}
+
+/**
+ * Processes the local elements in the global range \c [first, last)
+ * with the given number of threads.
+ */
+template <bool WithIndex, typename GlobInputIt, class Function>
+void for_each_local(
+  const GlobInputIt & first,
+  const GlobInputIt & last,
+  Function            func,
+  int                 nthreads)
+{
+  auto index_range = dash::local_index_range(first, last);
+  if (index_range.begin == index_range.end) {
+    return;
+  }
+  for_each_local_index(
+    index_range.begin, index_range.end,
+    make_for_each_local_body<WithIndex>(first, func),
+    nthreads);
+}
+
+/**
+ * Processes the local elements in the global range \c [first, last)
+ * asynchronously.
+ */
+template <bool WithIndex, typename GlobInputIt, class Function>
+dash::Future<void> for_each_local_async(
+  const GlobInputIt & first,
+  const GlobInputIt & last,
+  Function            func)
+{
+  auto index_range = dash::local_index_range(first, last);
+  if (index_range.begin == index_range.end) {
+    return dash::Future<void>([]() { });
+  }
+  // Locality information and the local memory range are resolved in the
+  // calling thread:
+  auto const nthreads = for_each_num_threads(first, last);
+  auto const body     = make_for_each_local_body<WithIndex>(first, func);
+  auto task = std::make_shared<std::future<void>>(
+                std::async(std::launch::async, [=]() {
+                  for_each_local_index(
+                    index_range.begin, index_range.end, body, nthreads);
+                }));
+  return dash::Future<void>(
+    [task]() {
+      task->get();
+    },
+    [task]() {
+      return task->wait_for(std::chrono::seconds(0))
+             == std::future_status::ready;
+    });
+}
+
+} // namespace internal
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * This function has the same signature as \c std::for_each but
@@ -47,16 +236,87 @@ void for_each(
   auto lend_index   = index_range.end;
   auto & team       = first.pattern().team();
   if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
     // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
+    GlobInputIt first_it(first);
+    auto lrange_begin = dash::local_begin(
+                          static_cast<typename GlobInputIt::pointer>(first_it),
+                          team.myid()) + lbegin_index;
+    auto lrange_end   = lrange_begin + (lend_index - lbegin_index);
     std::for_each(lrange_begin, lrange_end, func);
   }
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * see \c dash::for_each. Every unit invokes the function on its local
+ * elements sequentially.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunction>
+void for_each(
+    dash::execution::sequenced_policy,
+    const GlobInputIt& first,
+    const GlobInputIt& last,
+    UnaryFunction      func)
+{
+  dash::for_each(first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * see \c dash::for_each. Every unit invokes the function on its local
+ * elements in chunks distributed to the threads available to the unit,
+ * the function must be safe to call concurrently.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunction>
+void for_each(
+    dash::execution::parallel_policy,
+    const GlobInputIt& first,
+    const GlobInputIt& last,
+    UnaryFunction      func)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  dash::internal::for_each_local<false>(
+    first, last, func, dash::internal::for_each_num_threads(first, last));
+  first.pattern().team().barrier();
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * see \c dash::for_each. Every unit invokes the function on its local
+ * elements in chunks distributed to the threads available to the unit,
+ * asynchronously to the calling thread. The function must be safe to call
+ * concurrently and must not communicate.
+ *
+ * In contrast to the other execution policies, units do not synchronize
+ * at the end of the operation.
+ *
+ * \returns     A future for the completion of the operation at the
+ *              calling unit.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunction>
+dash::Future<void> for_each(
+    dash::execution::parallel_local_policy,
+    const GlobInputIt& first,
+    const GlobInputIt& last,
+    UnaryFunction      func)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  return dash::internal::for_each_local_async<false>(first, last, func);
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * Being a collaborative operation, each unit will invoke the given
@@ -111,6 +371,79 @@ void for_each_with_index(
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * passing the global index of the element, see
+ * \c dash::for_each_with_index. Every unit invokes the function on its
+ * local elements sequentially.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunctionWithIndex>
+void for_each_with_index(
+    dash::execution::sequenced_policy,
+    const GlobInputIt&     first,
+    const GlobInputIt&     last,
+    UnaryFunctionWithIndex func)
+{
+  dash::for_each_with_index(first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * passing the global index of the element, see
+ * \c dash::for_each_with_index. Every unit invokes the function on its
+ * local elements in chunks distributed to the threads available to the
+ * unit, the function must be safe to call concurrently.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunctionWithIndex>
+void for_each_with_index(
+    dash::execution::parallel_policy,
+    const GlobInputIt&     first,
+    const GlobInputIt&     last,
+    UnaryFunctionWithIndex func)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  dash::internal::for_each_local<true>(
+    first, last, func, dash::internal::for_each_num_threads(first, last));
+  first.pattern().team().barrier();
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * passing the global index of the element, see
+ * \c dash::for_each_with_index. Every unit invokes the function on its
+ * local elements in chunks distributed to the threads available to the
+ * unit, asynchronously to the calling thread. The function must be safe
+ * to call concurrently and must not communicate.
+ *
+ * In contrast to the other execution policies, units do not synchronize
+ * at the end of the operation.
+ *
+ * \returns     A future for the completion of the operation at the
+ *              calling unit.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobInputIt, class UnaryFunctionWithIndex>
+dash::Future<void> for_each_with_index(
+    dash::execution::parallel_local_policy,
+    const GlobInputIt&     first,
+    const GlobInputIt&     last,
+    UnaryFunctionWithIndex func)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  return dash::internal::for_each_local_async<true>(first, last, func);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FOR_EACH_H__
@@ -0,0 +1,334 @@
+#ifndef DASH__ALGORITHM__HISTOGRAM_H__
+#define DASH__ALGORITHM__HISTOGRAM_H__
+
+#include <dash/Exception.h>
+#include <dash/Iterator.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Threads.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/Trace.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Counts the elements in the range \c [first, last) per bin: the element
+ * \c v is counted in bin \c bin_of(v), elements mapped to bins outside of
+ * \c [0, nbins) are ignored.
+ *
+ * Every unit builds the histogram of its local elements, using the
+ * threads available to the unit.
+ *
+ * If \c out is a local output iterator, the local histograms are combined
+ * in a single allreduce and every unit writes the complete histogram to
+ * \c [out, out + nbins).
+ *
+ * If \c out is a global iterator, e.g. to a \c dash::Array, the local
+ * histograms are combined in a single reduce-scatter: every unit only
+ * receives the counts of the bins in its local portion of the global
+ * range \c [out, out + nbins). This is preferable for large numbers of
+ * bins. The operation ends with a barrier.
+ *
+ * Collective operation.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<int>  keys(n);
+ *       dash::Array<long> histo(max_key);
+ *       dash::histogram(keys.begin(), keys.end(), max_key, histo.begin(),
+ *                       [](int key) { return key; });
+ * \endcode
+ *
+ * \returns  Iterator past the last bin, \c out + \c nbins.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class OutputIt,
+  class BinFunction >
+OutputIt histogram(
+  GlobInputIt first,
+  GlobInputIt last,
+  std::size_t nbins,
+  OutputIt    out,
+  BinFunction bin_of);
+
+/**
+ * Counts the elements in the range \c [first, last) per bin, integral
+ * elements are used as bin indices.
+ *
+ * \see dash::histogram(GlobInputIt, GlobInputIt, std::size_t, OutputIt,
+ *                      BinFunction)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class OutputIt >
+OutputIt histogram(
+  GlobInputIt first,
+  GlobInputIt last,
+  std::size_t nbins,
+  OutputIt    out);
+
+#else
+
+namespace internal {
+
+/**
+ * Histogram of the local elements of the global range \c [first, last).
+ */
+template <
+  typename CountType,
+  class    GlobInputIt,
+  class    BinFunction >
+std::vector<CountType> histogram_local(
+  GlobInputIt first,
+  GlobInputIt last,
+  std::size_t nbins,
+  BinFunction bin_of)
+{
+  auto & team          = first.pattern().team();
+  auto   index_range   = dash::local_index_range(first, last);
+  auto   n_l_elem      = static_cast<std::size_t>(
+                           index_range.end - index_range.begin);
+  auto const * l_first = dash::local_begin(
+                           static_cast<typename GlobInputIt::pointer>(first),
+                           team.myid()) + index_range.begin;
+
+  std::vector<CountType> l_histo(nbins, 0);
+  if (n_l_elem == 0) {
+    return l_histo;
+  }
+
+  int n_threads = dash::internal::num_local_threads(n_l_elem, team);
+
+  // Threads count in separate histograms that are summed up afterwards
+  std::vector<CountType> t_histos((n_threads - 1) * nbins, 0);
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static, 1) \
+    if (n_threads > 1)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    auto * t_histo = (t == 0) ? l_histo.data()
+                              : t_histos.data() + (t - 1) * nbins;
+    auto const t_last = n_l_elem * (t + 1) / n_threads;
+    for (auto i = n_l_elem * t / n_threads; i < t_last; ++i) {
+      // Negative bin indices wrap around and are ignored as well:
+      auto const bin = static_cast<std::size_t>(bin_of(l_first[i]));
+      if (bin < nbins) {
+        ++t_histo[bin];
+      }
+    }
+  }
+  for (int t = 1; t < n_threads; ++t) {
+    auto const * t_histo = t_histos.data() + (t - 1) * nbins;
+    for (std::size_t b = 0; b < nbins; ++b) {
+      l_histo[b] += t_histo[b];
+    }
+  }
+  return l_histo;
+}
+
+/**
+ * Combines the local histograms in a single allreduce, the histogram is
+ * written to the local range beginning at \c out.
+ */
+template <
+  class GlobInputIt,
+  class OutputIt,
+  class BinFunction >
+OutputIt histogram(
+  GlobInputIt first,
+  GlobInputIt last,
+  std::size_t nbins,
+  OutputIt    out,
+  BinFunction bin_of,
+  std::false_type /* global output */)
+{
+  using count_type = typename std::remove_cv<
+                       typename std::iterator_traits<OutputIt>::value_type
+                     >::type;
+  static_assert(
+    dash::dart_datatype<count_type>::value != DART_TYPE_UNDEFINED,
+    "dash::histogram: counts must be of a DART basic type");
+
+  dash::util::Trace trace("histogram");
+  auto & team = first.pattern().team();
+
+  trace.enter_state("local");
+  auto l_histo = histogram_local<count_type>(first, last, nbins, bin_of);
+  trace.exit_state("local");
+
+  trace.enter_state("allreduce");
+  std::vector<count_type> g_histo(nbins);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      l_histo.data(),
+      g_histo.data(),
+      nbins,
+      dash::dart_datatype<count_type>::value,
+      DART_OP_SUM,
+      team.dart_id()),
+    DART_OK);
+  trace.exit_state("allreduce");
+
+  return std::copy(g_histo.begin(), g_histo.end(), out);
+}
+
+/**
+ * Combines the local histograms in a single reduce-scatter, every unit
+ * receives the bins in its local portion of the global range
+ * \c [out, out + nbins).
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinFunction >
+GlobOutputIt histogram(
+  GlobInputIt  first,
+  GlobInputIt  last,
+  std::size_t  nbins,
+  GlobOutputIt out,
+  BinFunction  bin_of,
+  std::true_type /* global output */)
+{
+  using count_type = typename std::remove_cv<
+                       typename dash::iterator_traits<GlobOutputIt>::value_type
+                     >::type;
+  static_assert(
+    dash::dart_datatype<count_type>::value != DART_TYPE_UNDEFINED,
+    "dash::histogram: counts must be of a DART basic type");
+  static_assert(
+    GlobOutputIt::pattern_type::ndim() == 1,
+    "dash::histogram: output range must be one-dimensional");
+
+  dash::util::Trace trace("histogram");
+  auto & team        = first.pattern().team();
+  auto & pattern_out = out.pattern();
+  auto   nunits      = team.size();
+  auto   myid        = team.myid();
+
+  if (pattern_out.team() != team) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::histogram: input and output range must be distributed in "
+      "the same team");
+  }
+
+  trace.enter_state("local");
+  auto l_histo = histogram_local<count_type>(first, last, nbins, bin_of);
+  trace.exit_state("local");
+
+  // Arrange the bins in the order of their owning units:
+  std::vector<std::size_t> nrecv(nunits, 0);
+  for (std::size_t b = 0; b < nbins; ++b) {
+    ++nrecv[pattern_out.unit_at(out.pos() + b)];
+  }
+  std::vector<std::size_t> send_offset(nunits, 0);
+  for (std::size_t u = 1; u < nunits; ++u) {
+    send_offset[u] = send_offset[u - 1] + nrecv[u - 1];
+  }
+  std::vector<count_type> send_histo(nbins);
+  std::vector<typename GlobOutputIt::index_type> l_bins;
+  l_bins.reserve(nrecv[myid]);
+  for (std::size_t b = 0; b < nbins; ++b) {
+    auto const l_pos = pattern_out.local(out.pos() + b);
+    send_histo[send_offset[l_pos.unit]++] = l_histo[b];
+    if (l_pos.unit == myid) {
+      l_bins.push_back(l_pos.index);
+    }
+  }
+
+  trace.enter_state("reduce_scatter");
+  std::vector<count_type> recv_histo(nrecv[myid]);
+  DASH_ASSERT_RETURNS(
+    dart_reduce_scatter(
+      send_histo.data(),
+      recv_histo.data(),
+      nrecv.data(),
+      dash::dart_datatype<count_type>::value,
+      DART_OP_SUM,
+      team.dart_id()),
+    DART_OK);
+  trace.exit_state("reduce_scatter");
+
+  auto * l_out = dash::local_begin(
+                   static_cast<typename GlobOutputIt::pointer>(out), myid);
+  for (std::size_t i = 0; i < l_bins.size(); ++i) {
+    l_out[l_bins[i]] = recv_histo[i];
+  }
+
+  trace.enter_state("barrier");
+  team.barrier();
+  trace.exit_state("barrier");
+
+  return out + nbins;
+}
+
+} // namespace internal
+
+template <
+  class GlobInputIt,
+  class OutputIt,
+  class BinFunction >
+OutputIt histogram(
+  GlobInputIt first,
+  GlobInputIt last,
+  std::size_t nbins,
+  OutputIt    out,
+  BinFunction bin_of)
+{
+  static_assert(
+    dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+    "dash::histogram: input must be a global iterator");
+
+  return dash::internal::histogram(
+           first, last, nbins, out, bin_of,
+           typename dash::iterator_traits<OutputIt>::is_global_iterator());
+}
+
+template <
+  class GlobInputIt,
+  class OutputIt >
+OutputIt histogram(
+  GlobInputIt first,
+  GlobInputIt last,
+  std::size_t nbins,
+  OutputIt    out)
+{
+  using value_type = typename std::remove_cv<
+                       typename dash::iterator_traits<GlobInputIt>::value_type
+                     >::type;
+  static_assert(
+    std::is_integral<value_type>::value,
+    "dash::histogram: elements must be integral to be used as bin indices");
+
+  return dash::histogram(
+           first, last, nbins, out,
+           [](const value_type & v) { return v; });
+}
+
+#endif // DOXYGEN
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__HISTOGRAM_H__
@@ -4,6 +4,7 @@
 #include <dash/internal/Config.h>
 
 #include <dash/Allocator.h>
+#include <dash/Types.h>
 
 #include <dash/algorithm/LocalRange.h>
 
@@ -15,7 +16,12 @@
 #include <dash/iterator/GlobIter.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
@@ -138,6 +144,206 @@ const ElementType * min_element(
   return ::std::min_element(l_range_begin, l_range_end, compare);
 }
 
+namespace internal {
+
+/**
+ * Value and global index of a local extremum as reduced by
+ * \c DART_OP_MINLOC and \c DART_OP_MAXLOC, a negative index marks units
+ * without elements in the range.
+ */
+template <typename ValueType>
+struct loc_result {
+  ValueType value{};
+  int64_t   g_index = -1;
+};
+
+/**
+ * DART value-index reduction equivalent to selecting the first extremum
+ * with the given compare function, \c DART_OP_UNDEFINED if a custom
+ * reduction is required.
+ */
+template <typename ValueType, typename Compare>
+struct dart_loc_operation
+: public std::integral_constant<dart_operation_t, DART_OP_UNDEFINED>
+{ };
+
+// DART punns unsigned char and short to signed types which would change
+// the order of the values
+template <typename ValueType, typename ArgType>
+struct dart_loc_operation_supported
+: public std::integral_constant<
+    bool,
+    std::is_same<typename std::decay<ArgType>::type, ValueType>::value &&
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED &&
+    (std::is_floating_point<ValueType>::value ||
+     std::is_signed<ValueType>::value ||
+     sizeof(ValueType) >= sizeof(int))>
+{ };
+
+template <typename ValueType, typename ArgType>
+struct dart_loc_operation<ValueType, std::less<ArgType>>
+: public std::integral_constant<
+    dart_operation_t,
+    dart_loc_operation_supported<ValueType, ArgType>::value
+    ? DART_OP_MINLOC
+    : DART_OP_UNDEFINED>
+{ };
+
+template <typename ValueType, typename ArgType>
+struct dart_loc_operation<ValueType, std::greater<ArgType>>
+: public std::integral_constant<
+    dart_operation_t,
+    dart_loc_operation_supported<ValueType, ArgType>::value
+    ? DART_OP_MAXLOC
+    : DART_OP_UNDEFINED>
+{ };
+
+template <typename ValueType, typename Compare>
+void loc_custom_fn(
+  const void   * invec,
+        void   * inoutvec,
+        size_t   len,
+        void   * userdata)
+{
+  using loc_result_t = struct loc_result<ValueType>;
+  const auto * in    = static_cast<const loc_result_t*>(invec);
+  auto       * inout = static_cast<loc_result_t*>(inoutvec);
+  Compare    & compare = *static_cast<Compare*>(userdata);
+  for (size_t i = 0; i < len; ++i, ++in, ++inout) {
+    // ignore units without elements, resolve ties to the first element
+    if (in->g_index >= 0 &&
+        (inout->g_index < 0 ||
+         compare(in->value, inout->value) ||
+         (!compare(inout->value, in->value) &&
+          in->g_index < inout->g_index))) {
+      *inout = *in;
+    }
+  }
+}
+
+/**
+ * Reduces pairs of minimum and maximum, ties are resolved to the first
+ * minimum and the last maximum like in \c std::minmax_element.
+ */
+template <typename ValueType, typename Compare>
+void minmax_loc_custom_fn(
+  const void   * invec,
+        void   * inoutvec,
+        size_t   len,
+        void   * userdata)
+{
+  using loc_result_t = struct loc_result<ValueType>;
+  const auto * in    = static_cast<const loc_result_t*>(invec);
+  auto       * inout = static_cast<loc_result_t*>(inoutvec);
+  Compare    & compare = *static_cast<Compare*>(userdata);
+  for (size_t i = 0; i < len; ++i, in += 2, inout += 2) {
+    loc_custom_fn<ValueType, Compare>(
+      in + DART_OP_MINMAX_MIN, inout + DART_OP_MINMAX_MIN, 1, userdata);
+    const auto & in_max    = in[DART_OP_MINMAX_MAX];
+    auto       & inout_max = inout[DART_OP_MINMAX_MAX];
+    if (in_max.g_index >= 0 &&
+        (inout_max.g_index < 0 ||
+         compare(inout_max.value, in_max.value) ||
+         (!compare(in_max.value, inout_max.value) &&
+          in_max.g_index > inout_max.g_index))) {
+      inout_max = in_max;
+    }
+  }
+}
+
+/**
+ * Reduces the local extrema of all units in a single collective
+ * operation.
+ */
+template <typename ValueType, typename Compare>
+loc_result<ValueType> loc_allreduce(
+  const loc_result<ValueType> & l_result,
+  Compare                       compare,
+  dash::Team                  & team)
+{
+  using loc_result_t = struct loc_result<ValueType>;
+
+  loc_result_t     g_result;
+  dart_operation_t dop   = dart_loc_operation<ValueType, Compare>::value;
+  dart_datatype_t  dtype = dash::dart_datatype<ValueType>::value;
+
+  if (dop != DART_OP_UNDEFINED) {
+    // ideal case: we can use the DART predefined reductions
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&l_result, &g_result, 1, dtype, dop, team.dart_id()),
+      DART_OK);
+  } else {
+    dart_type_create_custom(sizeof(loc_result_t), &dtype);
+    dart_op_create(
+      &loc_custom_fn<ValueType, Compare>,
+      &compare, true, dtype, true, &dop);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&l_result, &g_result, 1, dtype, dop, team.dart_id()),
+      DART_OK);
+    dart_op_destroy(&dop);
+    dart_type_destroy(&dtype);
+  }
+  return g_result;
+}
+
+/**
+ * Reduces the local minima and maxima of all units in a single
+ * collective operation.
+ */
+template <typename ValueType, typename Compare>
+std::array<loc_result<ValueType>, 2> minmax_loc_allreduce(
+  const std::array<loc_result<ValueType>, 2> & l_result,
+  Compare                                      compare,
+  dash::Team                                 & team)
+{
+  using loc_result_t = struct loc_result<ValueType>;
+
+  std::array<loc_result_t, 2> g_result;
+  dart_datatype_t dtype = dash::dart_datatype<ValueType>::value;
+
+  if (dart_loc_operation<ValueType, Compare>::value == DART_OP_MINLOC) {
+    // ideal case: we can use the DART predefined reductions
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(l_result.data(), g_result.data(), 2, dtype,
+                     DART_OP_MINMAXLOC, team.dart_id()),
+      DART_OK);
+  } else {
+    dart_operation_t dop;
+    dart_type_create_custom(2 * sizeof(loc_result_t), &dtype);
+    dart_op_create(
+      &minmax_loc_custom_fn<ValueType, Compare>,
+      &compare, true, dtype, true, &dop);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(l_result.data(), g_result.data(), 1, dtype, dop,
+                     team.dart_id()),
+      DART_OK);
+    dart_op_destroy(&dop);
+    dart_type_destroy(&dtype);
+  }
+  return g_result;
+}
+
+/**
+ * Converts the global index of a reduced extremum to an iterator in the
+ * range [first,last).
+ */
+template <typename GlobIter>
+GlobIter loc_iterator(
+  const GlobIter & first,
+  const GlobIter & last,
+  int64_t          g_index)
+{
+  if (g_index < 0 || g_index == last.gpos()) {
+    return last;
+  }
+  // iterator 'first' is relative to start of input range, convert to start
+  // of its referenced container (= container.begin()), then apply global
+  // offset of the element:
+  return (first - first.gpos()) + g_index;
+}
+
+} // namespace internal
+
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
@@ -168,10 +374,9 @@ GlobInputIt min_element(
     /// Element comparison function, defaults to std::less
     Compare compare = Compare())
 {
-  typedef typename GlobInputIt::pattern_type     pattern_t;
-  typedef typename pattern_t::index_type         index_t;
   typedef typename std::decay<
       typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
+  typedef struct dash::internal::loc_result<value_t> loc_result_t;
 
   // return last for empty array
   if (first == last) {
@@ -184,17 +389,11 @@ GlobInputIt min_element(
 
   auto & pattern = first.pattern();
   auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
-  // Global position of end element in range:
-  auto    gi_last            = last.gpos();
   // Find the local min. element in parallel
   // Get local address range between global iterators:
   auto    local_idx_range    = dash::local_index_range(first, last);
-  // Pointer to local minimum element:
-  const   value_t * lmin = nullptr;
-  // Local offset of local minimum element, or -1 if no element found:
-  index_t l_idx_lmin         = -1;
+  // Local minimum, global index is -1 if no element found:
+  loc_result_t local_min;
   if (local_idx_range.begin == local_idx_range.end) {
     // local range is empty
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
@@ -209,103 +408,33 @@ GlobInputIt min_element(
     const auto * l_range_begin = lbegin + local_idx_range.begin;
     const auto * l_range_end   = lbegin + local_idx_range.end;
 
-    lmin = dash::min_element(l_range_begin, l_range_end, compare);
+    const value_t * lmin = dash::min_element(
+                             l_range_begin, l_range_end, compare);
 
     if (lmin != l_range_end) {
       DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
-      // Offset of local minimum in local memory:
-      l_idx_lmin = lmin - lbegin;
+      local_min.value   = *lmin;
+      local_min.g_index = pattern.global(lmin - lbegin);
     }
 
     trace.exit_state("local");
   }
-  DASH_LOG_TRACE("dash::min_element",
-                 "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
-
-  typedef struct {
-    value_t  value;
-    index_t  g_index;
-  } local_min_t;
-
-  std::vector<local_min_t> local_min_values(team.size());
-
-  // Set global index of local minimum to -1 if no local minimum has been
-  // found:
-  local_min_t local_min;
-  local_min.value   = l_idx_lmin < 0
-                      ? value_t()
-                      : *lmin;
-  local_min.g_index = l_idx_lmin < 0
-                      ? -1
-                      : pattern.global(l_idx_lmin);
 
   DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
                  "value:",   local_min.value,
                  "g.index:", local_min.g_index, "}");
 
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
-  DASH_ASSERT_RETURNS(
-    dart_allgather(
-      &local_min,
-      local_min_values.data(),
-      sizeof(local_min_t),
-      DART_TYPE_BYTE,
-      team.dart_id()),
-    DART_OK);
-  trace.exit_state("allgather");
-
-#ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
-    DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
-                   "unit:",    lmin_u,
-                   "value:",   lmin_entry.value,
-                   "g_index:", lmin_entry.g_index);
-  }
-#endif
-
-  auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
-                             // Ignore elements with global index -1 (no
-                             // element found):
-                             return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
-                                      compare(a.value, b.value)));
-                           });
-
-  if (gmin_elem_it == local_min_values.end()) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
-
-  auto gi_minimum    = gmin_elem_it->g_index;
+  trace.enter_state("allreduce");
+  auto global_min = dash::internal::loc_allreduce(local_min, compare, team);
+  trace.exit_state("allreduce");
 
   DASH_LOG_TRACE("dash::min_element",
-                 "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
-                 "global idx:", gi_minimum);
+                 "min. value:", global_min.value,
+                 "global idx:", global_min.g_index);
 
-  DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
-  if (gi_minimum < 0 || gi_minimum == gi_last) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
-  // iterator 'first' is relative to start of input range, convert to start
-  // of its referenced container (= container.begin()), then apply global
-  // offset of minimum element:
-  auto minimum = (first - first.gpos()) + gi_minimum;
-  DASH_LOG_DEBUG("dash::min_element >", minimum,
-                 "=", static_cast<value_t>(*minimum));
+  auto minimum = dash::internal::loc_iterator(
+                   first, last, global_min.g_index);
+  DASH_LOG_DEBUG_VAR("dash::min_element >", minimum);
 
   return minimum;
 }
@@ -371,6 +500,96 @@ const ElementType *max_element(
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last).
+ *
+ * Local minima and maxima of all units are combined in a single
+ * collective operation.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest value and the last occurrence of the greatest
+ *              value in the range, or a pair of \c last if the range is
+ *              empty.
+ *
+ * \tparam      GlobInputIt  Type of the global iterators
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
+std::pair<GlobInputIt, GlobInputIt> minmax_element(
+    /// Iterator to the initial position in the sequence
+    const typename std::enable_if<
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+        GlobInputIt>::type &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  typedef typename std::decay<
+      typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
+  typedef struct dash::internal::loc_result<value_t> loc_result_t;
+
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::minmax_element >",
+                   "empty range, returning last", last);
+    return std::make_pair(last, last);
+  }
+
+  dash::util::Trace trace("minmax_element");
+
+  auto & pattern         = first.pattern();
+  auto & team            = pattern.team();
+  auto   local_idx_range = dash::local_index_range(first, last);
+
+  std::array<loc_result_t, 2> local_minmax;
+  if (local_idx_range.begin != local_idx_range.end) {
+    trace.enter_state("local");
+
+    auto *lbegin = dash::local_begin(
+        static_cast<typename GlobInputIt::const_pointer>(first), team.myid());
+    const auto * l_range_begin = lbegin + local_idx_range.begin;
+    const auto * l_range_end   = lbegin + local_idx_range.end;
+
+    auto lminmax = std::minmax_element(l_range_begin, l_range_end, compare);
+
+    local_minmax[DART_OP_MINMAX_MIN].value   = *lminmax.first;
+    local_minmax[DART_OP_MINMAX_MIN].g_index =
+      pattern.global(lminmax.first - lbegin);
+    local_minmax[DART_OP_MINMAX_MAX].value   = *lminmax.second;
+    local_minmax[DART_OP_MINMAX_MAX].g_index =
+      pattern.global(lminmax.second - lbegin);
+
+    trace.exit_state("local");
+  }
+
+  trace.enter_state("allreduce");
+  auto global_minmax = dash::internal::minmax_loc_allreduce(
+                         local_minmax, compare, team);
+  trace.exit_state("allreduce");
+
+  DASH_LOG_TRACE("dash::minmax_element",
+                 "min. global idx:",
+                 global_minmax[DART_OP_MINMAX_MIN].g_index,
+                 "max. global idx:",
+                 global_minmax[DART_OP_MINMAX_MAX].g_index);
+
+  return std::make_pair(
+           dash::internal::loc_iterator(
+             first, last, global_minmax[DART_OP_MINMAX_MIN].g_index),
+           dash::internal::loc_iterator(
+             first, last, global_minmax[DART_OP_MINMAX_MAX].g_index));
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__MIN_MAX_H__
@@ -2,29 +2,34 @@
 #define DASH__ALGORITHM__NONE_OF_H__
 
 #include <dash/iterator/GlobIter.h>
-#include <dash/algorithm/LocalRange.h>
-#include <dash/algorithm/Operation.h>
-#include <dash/dart/if/dart_communication.h>
-#include <dash/algorithm/Find_if.h>
+#include <dash/algorithm/Find.h>
+
 
 namespace dash {
 
 /**
- * \ingroup     DashAlgorithms
+ * Check whether no element in the range satisfies predicate \c p.
+ *
+ * \returns \c true if no element satisfies \c p, \c false otherwise.
+ *
+ * \see dash::find_if
+ * \see dash::any_of
+ * \see dash::all_of
+ * \ingroup DashAlgorithms
  */
 template<
-    typename ElementType,
-    class PatternType>
-GlobIter<ElementType, PatternType> any_of(
-    /// Iterator to the initial position in the sequence
-    GlobIter<ElementType, PatternType>   first,
-    /// Iterator to the final position in the sequence
-    GlobIter<ElementType, PatternType>   last,
-    /// Predicate applied to the elements in range [first, last)
-    UnaryPredicate p)
+  typename GlobIter,
+  typename UnaryPredicate >
+bool none_of(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate p)
 {
-    
-    return find_if(first, last, p) == last;
+  return dash::find_if(first, last, p) == last;
+}
 
 } // namespace dash
 
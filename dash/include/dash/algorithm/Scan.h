@@ -0,0 +1,585 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/Exception.h>
+#include <dash/Iterator.h>
+#include <dash/Onesided.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/internal/BlockRange.h>
+#include <dash/algorithm/internal/Threads.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Computes the inclusive prefix sums of the elements in the global range
+ * \c [in_first, in_last) using the associative binary operation
+ * \c binary_op and writes them to the global range beginning at
+ * \c out_first:
+ *
+ * <tt>
+ *   out[i] = in[0] op in[1] op ... op in[i]
+ * </tt>
+ *
+ * The operation does not need to be commutative, the elements are combined
+ * in the order of the global range.
+ *
+ * Every unit scans its local portion of the input range, the values of the
+ * preceding units are combined in a single exclusive scan collective. The
+ * output range may have a different pattern than the input range; elements
+ * of the output range that are not local to the unit holding the
+ * corresponding input elements are written with non-blocking puts.
+ *
+ * Precondition: The local portions of the input range are contiguous
+ * subranges of the global range in the order of the unit IDs, as in
+ * \c dash::BLOCKED distributions. One-dimensional output patterns are
+ * supported for output ranges that are not aligned with the input range.
+ *
+ * Collective operation. Like \c dash::copy, it does not synchronize the
+ * units, a barrier is required before output elements written by other units
+ * can be read.
+ *
+ * \returns  Output iterator to the element past the last element written.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<
+    typename dash::iterator_traits<GlobInputIt>::value_type> >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op = BinaryOperation());
+
+/**
+ * Computes the inclusive prefix sums of the elements in the global range
+ * \c [in_first, in_last), starting from \c init.
+ *
+ * \see dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  ValueType       init);
+
+/**
+ * Computes the exclusive prefix sums of the elements in the global range
+ * \c [in_first, in_last), starting from \c init, and writes them to the
+ * global range beginning at \c out_first:
+ *
+ * <tt>
+ *   out[i] = init op in[0] op ... op in[i-1]
+ * </tt>
+ *
+ * \see dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+GlobOutputIt exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init,
+  BinaryOperation binary_op = BinaryOperation());
+
+/**
+ * Computes the inclusive prefix sums of the results of \c unary_op applied
+ * to the elements in the global range \c [in_first, in_last) in a single
+ * pass over the input range:
+ *
+ * <tt>
+ *   out[i] = unary_op(in[0]) op ... op unary_op(in[i])
+ * </tt>
+ *
+ * \see dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op);
+
+/**
+ * Computes the exclusive prefix sums of the results of \c unary_op applied
+ * to the elements in the global range \c [in_first, in_last), starting from
+ * \c init:
+ *
+ * <tt>
+ *   out[i] = init op unary_op(in[0]) op ... op unary_op(in[i-1])
+ * </tt>
+ *
+ * \see dash::exclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op);
+
+#else
+
+namespace internal {
+
+template <typename ValueType, typename BinaryOperation>
+inline local_result<ValueType> scan_combine(
+  const local_result<ValueType> & lhs,
+  const local_result<ValueType> & rhs,
+  BinaryOperation               & binary_op)
+{
+  if (!lhs.valid) {
+    return rhs;
+  }
+  if (!rhs.valid) {
+    return lhs;
+  }
+  local_result<ValueType> result;
+  result.value = binary_op(lhs.value, rhs.value);
+  result.valid = true;
+  return result;
+}
+
+/**
+ * Combined values of the local ranges of all units preceding the calling
+ * unit in \c team, invalid on the first unit.
+ */
+template <typename ValueType, typename BinaryOperation>
+local_result<ValueType> scan_carry(
+  local_result<ValueType>   l_result,
+  BinaryOperation           binary_op,
+  dash::Team              & team)
+{
+  using local_result_t = struct dash::internal::local_result<ValueType>;
+
+  local_result_t   carry;
+  dart_operation_t dop   =
+                     dash::internal::dart_reduce_operation<
+                       BinaryOperation>::value;
+  dart_datatype_t  dtype = dash::dart_datatype<ValueType>::value;
+
+  if (dop == DART_OP_SUM && dtype != DART_TYPE_UNDEFINED) {
+    // ideal case: units with an empty local range contribute the neutral
+    // element and we can use the DART predefined operation
+    ValueType l_value = l_result.valid ? l_result.value : ValueType();
+    DASH_ASSERT_RETURNS(
+      dart_exscan(&l_value, &carry.value, 1, dtype, dop, team.dart_id()),
+      DART_OK);
+    carry.valid = true;
+  } else {
+    dart_type_create_custom(sizeof(local_result_t), &dtype);
+    // the operation is applied in the order of the unit IDs, it does not
+    // need to be commutative
+    dart_op_create(
+      &dash::internal::reduce_custom_fn<ValueType, BinaryOperation>,
+      &binary_op, false, dtype, true, &dop);
+    DASH_ASSERT_RETURNS(
+      dart_exscan(&l_result, &carry, 1, dtype, dop, team.dart_id()),
+      DART_OK);
+    dart_op_destroy(&dop);
+    dart_type_destroy(&dtype);
+  }
+  if (team.myid() == 0) {
+    // result of the exclusive scan is undefined on the first unit
+    carry.valid = false;
+  }
+  return carry;
+}
+
+/**
+ * Local phase of a scan: combines the local values with the carry of the
+ * preceding units and writes the prefix sums to \c out.
+ *
+ * The local range is split in one chunk per thread. The threads first
+ * reduce their chunks, the carry is obtained by the exclusive scan of the
+ * local results of all units, before every thread scans its chunk starting
+ * from the combined value of the preceding chunks.
+ */
+template <
+  typename ValueType,
+  typename InputType,
+  typename BinaryOperation,
+  typename UnaryOperation >
+void scan_local(
+  const InputType         * in,
+  ValueType               * out,
+  size_t                    nelem,
+  local_result<ValueType>   init,
+  BinaryOperation           binary_op,
+  UnaryOperation            unary_op,
+  bool                      inclusive,
+  dash::Team              & team)
+{
+  using local_result_t = struct dash::internal::local_result<ValueType>;
+
+  int n_threads = dash::internal::num_local_threads(nelem, team);
+  DASH_LOG_TRACE_VAR("dash::internal::scan_local", n_threads);
+
+  std::vector<local_result_t> t_results(n_threads);
+
+  // reduce the chunks of all threads
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static, 1) \
+    if (n_threads > 1)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    auto const t_first = nelem * t / n_threads;
+    auto const t_last  = nelem * (t + 1) / n_threads;
+    if (t_first == t_last) {
+      continue;
+    }
+    ValueType value = unary_op(in[t_first]);
+    for (auto i = t_first + 1; i < t_last; ++i) {
+      value = binary_op(value, unary_op(in[i]));
+    }
+    t_results[t].value = value;
+    t_results[t].valid = true;
+  }
+
+  local_result_t l_result;
+  for (auto const & t_result : t_results) {
+    l_result = scan_combine(l_result, t_result, binary_op);
+  }
+
+  // carry of the preceding units
+  auto carry = scan_combine(
+                 init, scan_carry(l_result, binary_op, team), binary_op);
+
+  // scan the chunks of all threads
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static, 1) \
+    if (n_threads > 1)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    auto t_first = nelem * t / n_threads;
+    auto const t_last  = nelem * (t + 1) / n_threads;
+    if (t_first == t_last) {
+      continue;
+    }
+    local_result_t t_carry = carry;
+    for (int pt = 0; pt < t; ++pt) {
+      t_carry = scan_combine(t_carry, t_results[pt], binary_op);
+    }
+    if (!t_carry.valid) {
+      // inclusive scan starting at the first element of the global range
+      t_carry.value = unary_op(in[t_first]);
+      out[t_first]  = t_carry.value;
+      ++t_first;
+    }
+    ValueType value = t_carry.value;
+    if (inclusive) {
+      for (auto i = t_first; i < t_last; ++i) {
+        value  = binary_op(value, unary_op(in[i]));
+        out[i] = value;
+      }
+    } else {
+      for (auto i = t_first; i < t_last; ++i) {
+        auto const next = binary_op(value, unary_op(in[i]));
+        out[i]          = value;
+        value           = next;
+      }
+    }
+  }
+}
+
+/**
+ * Writes the local range \c [first, first + nelem) to the global range
+ * beginning at \c out_first, split into one transfer per block of the
+ * output pattern.
+ */
+template <
+  typename ValueType,
+  class    GlobOutputIt >
+void scan_put(
+  const ValueType     * first,
+  size_t                nelem,
+  GlobOutputIt          out_first,
+  dart_handle_group_t   group)
+{
+  static_assert(
+    GlobOutputIt::pattern_type::ndim() == 1,
+    "dash::scan: output range must be one-dimensional if it is not "
+    "aligned with the input range");
+
+  dash::internal::for_each_block_range(
+    out_first, nelem,
+    [&](GlobOutputIt block_first, size_t nblock) {
+      dash::internal::put_group(block_first.dart_gptr(), first, nblock, group);
+      first += nblock;
+    });
+}
+
+template <
+  typename ValueType,
+  class    GlobInputIt,
+  class    GlobOutputIt,
+  class    BinaryOperation,
+  class    UnaryOperation >
+GlobOutputIt scan_impl(
+  GlobInputIt              in_first,
+  GlobInputIt              in_last,
+  GlobOutputIt             out_first,
+  local_result<ValueType>  init,
+  BinaryOperation          binary_op,
+  UnaryOperation           unary_op,
+  bool                     inclusive)
+{
+  DASH_LOG_DEBUG("dash::scan()", "inclusive:", inclusive);
+
+  auto       & team     = in_first.team();
+  const auto & pattern  = in_first.pattern();
+  auto const   nelem    = dash::distance(in_first, in_last);
+  auto const   out_last = out_first + nelem;
+
+  auto const l_idx_range = dash::local_index_range(in_first, in_last);
+  auto const l_range     = dash::local_range(in_first, in_last);
+  size_t const n_l_elem  = l_range.end - l_range.begin;
+
+  // Offset of the local input subrange in the input range
+  size_t l_offset = 0;
+  if (n_l_elem > 0) {
+    auto const g_begin = pattern.global(l_idx_range.begin);
+    auto const g_last  = pattern.global(l_idx_range.end - 1);
+    if (static_cast<size_t>(g_last - g_begin) + 1 != n_l_elem) {
+      DASH_THROW(
+        dash::exception::NotImplemented,
+        "dash::scan is only implemented for contiguous local ranges");
+    }
+    l_offset = g_begin - in_first.pos();
+  }
+
+  // Write to local output memory directly if the corresponding output
+  // range is local
+  ValueType * l_out = nullptr;
+  if (n_l_elem > 0) {
+    auto const l_out_first = out_first + l_offset;
+    auto const l_out_range = dash::local_index_range(
+                               l_out_first, l_out_first + n_l_elem);
+    if (static_cast<size_t>(l_out_range.end - l_out_range.begin)
+          == n_l_elem &&
+        l_out_first.is_local()) {
+      l_out = l_out_first.local();
+    }
+  }
+
+  std::vector<ValueType> l_buf;
+  if (n_l_elem > 0 && l_out == nullptr) {
+    l_buf.resize(n_l_elem);
+  }
+
+  dash::internal::scan_local(
+    l_range.begin,
+    (l_out != nullptr) ? l_out : l_buf.data(),
+    n_l_elem,
+    init,
+    binary_op,
+    unary_op,
+    inclusive,
+    team);
+
+  if (!l_buf.empty()) {
+    DASH_LOG_TRACE("dash::scan", "output range not local, put",
+                   n_l_elem, "elements");
+    auto group = dash::internal::make_handle_group();
+    dash::internal::scan_put(
+      l_buf.data(), n_l_elem, out_first + l_offset, group.get());
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_wait(group.get()),
+      DART_OK);
+  }
+
+  return out_last;
+}
+
+/// Identity for scans without a transformation
+template <typename ValueType>
+struct scan_identity {
+  const ValueType & operator()(const ValueType & value) const {
+    return value;
+  }
+};
+
+} // namespace internal
+
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<
+    typename dash::iterator_traits<GlobInputIt>::value_type> >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  using value_t = typename std::remove_cv<
+                    typename dash::iterator_traits<GlobInputIt>::value_type
+                  >::type;
+  return dash::internal::scan_impl(
+           in_first, in_last, out_first,
+           dash::internal::local_result<value_t>(),
+           binary_op,
+           dash::internal::scan_identity<value_t>(),
+           true);
+}
+
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  ValueType       init)
+{
+  using value_t = typename std::remove_cv<
+                    typename dash::iterator_traits<GlobInputIt>::value_type
+                  >::type;
+  dash::internal::local_result<ValueType> l_init;
+  l_init.value = init;
+  l_init.valid = true;
+  return dash::internal::scan_impl(
+           in_first, in_last, out_first,
+           l_init,
+           binary_op,
+           dash::internal::scan_identity<value_t>(),
+           true);
+}
+
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+GlobOutputIt exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  using value_t = typename std::remove_cv<
+                    typename dash::iterator_traits<GlobInputIt>::value_type
+                  >::type;
+  dash::internal::local_result<ValueType> l_init;
+  l_init.value = init;
+  l_init.valid = true;
+  return dash::internal::scan_impl(
+           in_first, in_last, out_first,
+           l_init,
+           binary_op,
+           dash::internal::scan_identity<value_t>(),
+           false);
+}
+
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op)
+{
+  using input_t = typename std::remove_cv<
+                    typename dash::iterator_traits<GlobInputIt>::value_type
+                  >::type;
+  using value_t = typename std::decay<
+                    decltype(unary_op(std::declval<const input_t &>()))
+                  >::type;
+  return dash::internal::scan_impl(
+           in_first, in_last, out_first,
+           dash::internal::local_result<value_t>(),
+           binary_op,
+           unary_op,
+           true);
+}
+
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op)
+{
+  dash::internal::local_result<ValueType> l_init;
+  l_init.value = init;
+  l_init.valid = true;
+  return dash::internal::scan_impl(
+           in_first, in_last, out_first,
+           l_init,
+           binary_op,
+           unary_op,
+           false);
+}
+
+#endif // DOXYGEN
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
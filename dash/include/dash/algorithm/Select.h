@@ -0,0 +1,753 @@
+#ifndef DASH__ALGORITHM__SELECT_H
+#define DASH__ALGORITHM__SELECT_H
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <dash/Array.h>
+#include <dash/Exception.h>
+#include <dash/Future.h>
+#include <dash/Meta.h>
+#include <dash/Types.h>
+#include <dash/dart/if/dart.h>
+
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Sort.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/Trace.h>
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Returns the element that would be at position \c nth if the range
+ * \c [first, last) was sorted in ascending order.
+ *
+ * In contrast to \c std::nth_element, the range is not modified: the
+ * element is selected by determining its key digit by digit in at most
+ * one allreduce per 8 bits of the key range, without exchanging
+ * elements. The elements must be integral or floating point values.
+ *
+ * The operation is collective among the team of the owning dash
+ * container, all units return the same element.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<double> arr(100);
+ *       // median
+ *       double median = dash::nth_element(
+ *                         arr.begin(), arr.begin() + 50, arr.end());
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+typename dash::iterator_traits<GlobRandomIt>::value_type nth_element(
+    GlobRandomIt first, GlobRandomIt nth, GlobRandomIt last);
+
+/**
+ * Returns the element that would be at position \c nth if the range
+ * \c [first, last) was sorted in ascending order of the keys returned by
+ * a user-defined hash function.
+ *
+ * Resulting values of the hash function must be integral or floating
+ * point values. As the local phases of the algorithm may be
+ * multi-threaded, the hash function must be safe to call concurrently.
+ *
+ * \see dash::nth_element(GlobRandomIt, GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+typename dash::iterator_traits<GlobRandomIt>::value_type nth_element(
+    GlobRandomIt first,
+    GlobRandomIt nth,
+    GlobRandomIt last,
+    SortableHash hash);
+
+/**
+ * Rearranges the elements in the range \c [first, last) such that
+ * \c [first, middle) contains the <tt>middle - first</tt> smallest
+ * elements in ascending order. The order of the remaining elements in
+ * \c [middle, last) is unspecified.
+ *
+ * The smallest elements are selected like in \c dash::nth_element and
+ * sorted with \c dash::sort in a temporary array distributed over all
+ * units, so no unit receives more than its share of the selected
+ * elements. The elements must be integral or floating point values and
+ * the range must be one-dimensional.
+ *
+ * The operation is collective among the team of the owning dash
+ * container.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void partial_sort(
+    GlobRandomIt first, GlobRandomIt middle, GlobRandomIt last);
+
+/**
+ * Rearranges the elements in the range \c [first, last) such that
+ * \c [first, middle) contains the <tt>middle - first</tt> elements with
+ * the smallest keys returned by a user-defined hash function in ascending
+ * order of keys.
+ *
+ * \see dash::partial_sort(GlobRandomIt, GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void partial_sort(
+    GlobRandomIt first,
+    GlobRandomIt middle,
+    GlobRandomIt last,
+    SortableHash hash);
+
+/**
+ * Copies the \c k largest elements in the range \c [first, last) in
+ * descending order to the local range beginning at \c out at every unit.
+ *
+ * The largest elements are selected like in \c dash::nth_element, only
+ * the selected elements are exchanged between units. The elements must
+ * be integral or floating point values.
+ *
+ * The operation is collective among the team of the owning dash
+ * container.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<int> arr(100);
+ *       std::vector<int> top(10);
+ *       dash::top_k(arr.begin(), arr.end(), top.size(), top.begin());
+ * \endcode
+ *
+ * \returns  Iterator past the last element copied to \c out, which is
+ *           \c out + <tt>min(k, last - first)</tt>.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class OutputIt>
+OutputIt top_k(
+    GlobRandomIt first,
+    GlobRandomIt last,
+    std::size_t  k,
+    OutputIt     out);
+
+/**
+ * Copies the \c k elements with the largest keys returned by a
+ * user-defined hash function in the range \c [first, last) in descending
+ * order of keys to the local range beginning at \c out at every unit.
+ *
+ * \see dash::top_k(GlobRandomIt, GlobRandomIt, std::size_t, OutputIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class OutputIt, class SortableHash>
+OutputIt top_k(
+    GlobRandomIt first,
+    GlobRandomIt last,
+    std::size_t  k,
+    OutputIt     out,
+    SortableHash hash);
+
+#else
+
+namespace detail {
+
+/**
+ * Local offsets of the elements in \c [first, last) that are among the
+ * \c k smallest (or largest) elements of the global range with \c nelem
+ * elements. Elements with the same key as the k-th element are selected
+ * in unit order.
+ */
+template <typename ValueType, typename KeyFn>
+inline std::vector<std::size_t> psort__select_local(
+    ValueType const* first,
+    ValueType const* last,
+    KeyFn            key_of,
+    std::size_t      k,
+    std::size_t      nelem,
+    bool             largest,
+    dash::Team&      team,
+    int              nthreads)
+{
+  DASH_LOG_TRACE("< psort__select_local");
+
+  auto const n_l_elem = static_cast<std::size_t>(std::distance(first, last));
+
+  std::vector<std::size_t> l_selected;
+  if (k == 0) {
+    return l_selected;
+  }
+  if (k >= nelem) {
+    l_selected.resize(n_l_elem);
+    std::iota(l_selected.begin(), l_selected.end(), 0);
+    return l_selected;
+  }
+
+  auto const rank  = largest ? nelem - k : k - 1;
+  auto const sel   = psort__radix_select(
+      first, last, key_of, std::vector<std::size_t>{rank}, team, nthreads);
+  auto const t_key = static_cast<decltype(sel.first)>(
+      sel.first + sel.second.front());
+
+  auto const precedes = [largest, t_key](decltype(t_key) key) {
+    return largest ? t_key < key : key < t_key;
+  };
+
+  // Number of local elements preceding the k-th element and with the same
+  // key as the k-th element
+  std::array<std::size_t, 2> l_count{0, 0};
+  for (auto const* it = first; it != last; ++it) {
+    auto const key = key_of(*it);
+    if (precedes(key)) {
+      ++l_count[0];
+    }
+    else if (key == t_key) {
+      ++l_count[1];
+    }
+  }
+
+  auto const nunits = team.size();
+  std::vector<std::size_t> g_count(2 * nunits);
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          l_count.data(),
+          g_count.data(),
+          2,
+          dash::dart_datatype<std::size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::size_t nprec       = 0;
+  std::size_t ntie_before = 0;
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    nprec += g_count[2 * unit];
+    if (unit < static_cast<std::size_t>(team.myid().id)) {
+      ntie_before += g_count[2 * unit + 1];
+    }
+  }
+  auto const ntie = k - nprec;
+  auto l_ntie     = ntie > ntie_before
+                    ? std::min(l_count[1], ntie - ntie_before)
+                    : std::size_t{0};
+
+  l_selected.reserve(l_count[0] + l_ntie);
+  for (std::size_t i = 0; i < n_l_elem; ++i) {
+    auto const key = key_of(first[i]);
+    if (precedes(key)) {
+      l_selected.push_back(i);
+    }
+    else if (key == t_key && l_ntie > 0) {
+      l_selected.push_back(i);
+      --l_ntie;
+    }
+  }
+
+  DASH_LOG_TRACE("psort__select_local >");
+  return l_selected;
+}
+
+/**
+ * Gathers the local values of all units in unit order at every unit,
+ * given the number of values of every unit.
+ */
+template <typename ValueType>
+inline std::vector<ValueType> psort__allgatherv(
+    std::vector<ValueType> const&   l_values,
+    std::vector<std::size_t> const& counts,
+    dash::Team&                     team)
+{
+  auto const nunits = team.size();
+
+  std::vector<std::size_t> nrecv(nunits);
+  std::vector<std::size_t> displs(nunits);
+  std::size_t              nvalues = 0;
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    nrecv[unit]  = dash::dart_storage<ValueType>(counts[unit]).nelem;
+    displs[unit] = dash::dart_storage<ValueType>(nvalues).nelem;
+    nvalues += counts[unit];
+  }
+
+  std::vector<ValueType> g_values(nvalues);
+  dash::dart_storage<ValueType> ds(l_values.size());
+  DASH_ASSERT_RETURNS(
+      dart_allgatherv(
+          l_values.data(),
+          ds.nelem,
+          ds.dtype,
+          g_values.data(),
+          nrecv.data(),
+          displs.data(),
+          team.dart_id()),
+      DART_OK);
+
+  return g_values;
+}
+
+/**
+ * Exchanges values ordered by a global rank between units: the local
+ * values have the consecutive ranks starting at \c src_offsets[myid] and
+ * are sent to the units whose range in \c dst_offsets contains their
+ * rank. Both offset vectors contain the exclusive prefix sums of the
+ * number of values at every unit followed by the total number of values.
+ *
+ * \returns The values with ranks in <tt>[dst_offsets[myid],
+ *          dst_offsets[myid + 1])</tt> in ascending order of ranks.
+ */
+template <typename ValueType>
+inline std::vector<ValueType> psort__exchange_ranked(
+    std::vector<ValueType> const&   l_values,
+    std::vector<std::size_t> const& src_offsets,
+    std::vector<std::size_t> const& dst_offsets,
+    dash::Team&                     team)
+{
+  auto const nunits = team.size();
+  auto const myid   = static_cast<std::size_t>(team.myid().id);
+
+  auto const overlap = [](std::size_t first_a, std::size_t last_a,
+                          std::size_t first_b, std::size_t last_b) {
+    auto const first = std::max(first_a, first_b);
+    auto const last  = std::min(last_a, last_b);
+    return last > first ? last - first : std::size_t{0};
+  };
+
+  std::vector<std::size_t> nsend(nunits);
+  std::vector<std::size_t> nrecv(nunits);
+  std::vector<std::size_t> sdispls(nunits);
+  std::vector<std::size_t> rdispls(nunits);
+  std::size_t              send_offset = 0;
+  std::size_t              recv_offset = 0;
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    auto const send_count = overlap(
+        src_offsets[myid], src_offsets[myid + 1],
+        dst_offsets[unit], dst_offsets[unit + 1]);
+    auto const recv_count = overlap(
+        src_offsets[unit], src_offsets[unit + 1],
+        dst_offsets[myid], dst_offsets[myid + 1]);
+    nsend[unit]   = dash::dart_storage<ValueType>(send_count).nelem;
+    nrecv[unit]   = dash::dart_storage<ValueType>(recv_count).nelem;
+    sdispls[unit] = dash::dart_storage<ValueType>(send_offset).nelem;
+    rdispls[unit] = dash::dart_storage<ValueType>(recv_offset).nelem;
+    send_offset += send_count;
+    recv_offset += recv_count;
+  }
+
+  std::vector<ValueType> r_values(recv_offset);
+  DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+          l_values.data(),
+          nsend.data(),
+          sdispls.data(),
+          r_values.data(),
+          nrecv.data(),
+          rdispls.data(),
+          dash::dart_storage<ValueType>::dtype,
+          team.dart_id()),
+      DART_OK);
+
+  return r_values;
+}
+
+}  // namespace detail
+
+template <class GlobRandomIt, class SortableHash>
+typename dash::iterator_traits<GlobRandomIt>::value_type nth_element(
+    GlobRandomIt first,
+    GlobRandomIt nth,
+    GlobRandomIt last,
+    SortableHash sortable_hash)
+{
+  using value_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value &&
+          !std::is_same<mapped_type, bool>::value,
+      "Only integral and floating point keys are supported");
+
+  using radix_traits = detail::psort__radix_traits<mapped_type>;
+
+  if (nth < first || nth >= last) {
+    DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::nth_element: nth is not in range [first, last)");
+  }
+
+  dash::util::Trace trace("NthElement");
+
+  auto const& pattern = first.pattern();
+  dash::Team& team    = pattern.team();
+
+  auto const l_range  = dash::local_index_range(first, last);
+  auto const n_l_elem = l_range.end - l_range.begin;
+  auto const* lbegin  = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(first), team.myid()) +
+      l_range.begin;
+  auto const* lend = lbegin + n_l_elem;
+
+  auto const nthreads = dash::internal::num_local_threads(n_l_elem, team);
+
+  auto const key_of = [&sortable_hash](value_type const& value) {
+    return radix_traits::key(sortable_hash(value));
+  };
+
+  trace.enter_state("select");
+  auto const sel = detail::psort__radix_select(
+      lbegin,
+      lend,
+      key_of,
+      std::vector<std::size_t>{static_cast<std::size_t>(nth - first)},
+      team,
+      nthreads);
+  auto const t_key = static_cast<decltype(sel.first)>(
+      sel.first + sel.second.front());
+  trace.exit_state("select");
+
+  // The element is broadcast by the first unit holding an element with
+  // the selected key
+  trace.enter_state("bcast");
+  auto const l_nth = std::find_if(
+      lbegin, lend, [&key_of, t_key](value_type const& value) {
+        return key_of(value) == t_key;
+      });
+  int32_t const l_owner = (l_nth != lend)
+                          ? static_cast<int32_t>(team.myid().id)
+                          : static_cast<int32_t>(team.size());
+  int32_t g_owner;
+  DASH_ASSERT_RETURNS(
+      dart_allreduce(
+          &l_owner,
+          &g_owner,
+          1,
+          dash::dart_datatype<int32_t>::value,
+          DART_OP_MIN,
+          team.dart_id()),
+      DART_OK);
+
+  value_type nth_value{};
+  if (l_nth != lend) {
+    nth_value = *l_nth;
+  }
+  dash::dart_storage<value_type> ds(1);
+  DASH_ASSERT_RETURNS(
+      dart_bcast(
+          &nth_value,
+          ds.nelem,
+          ds.dtype,
+          dash::team_unit_t{g_owner},
+          team.dart_id()),
+      DART_OK);
+  trace.exit_state("bcast");
+
+  return nth_value;
+}
+
+template <class GlobRandomIt>
+inline typename dash::iterator_traits<GlobRandomIt>::value_type nth_element(
+    GlobRandomIt first, GlobRandomIt nth, GlobRandomIt last)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::nth_element(
+      first, nth, last, detail::identity_t<value_t const&>());
+}
+
+template <class GlobRandomIt, class SortableHash>
+void partial_sort(
+    GlobRandomIt first,
+    GlobRandomIt middle,
+    GlobRandomIt last,
+    SortableHash sortable_hash)
+{
+  using value_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value &&
+          !std::is_same<mapped_type, bool>::value,
+      "Only integral and floating point keys are supported");
+  static_assert(
+      GlobRandomIt::pattern_type::ndim() == 1,
+      "dash::partial_sort: range must be one-dimensional");
+
+  using radix_traits = detail::psort__radix_traits<mapped_type>;
+
+  auto const& pattern = first.pattern();
+  dash::Team& team    = pattern.team();
+
+  if (middle <= first) {
+    team.barrier();
+    return;
+  }
+  if (middle >= last) {
+    dash::sort(first, last, sortable_hash);
+    return;
+  }
+
+  dash::util::Trace trace("PartialSort");
+
+  auto const nelem = static_cast<std::size_t>(last - first);
+  auto const k     = static_cast<std::size_t>(middle - first);
+
+  auto const l_range  = dash::local_index_range(first, last);
+  auto const n_l_elem = l_range.end - l_range.begin;
+  auto* lbegin        = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(first), team.myid()) +
+      l_range.begin;
+
+  auto const nthreads = dash::internal::num_local_threads(n_l_elem, team);
+
+  auto const key_of = [&sortable_hash](value_type const& value) {
+    return radix_traits::key(sortable_hash(value));
+  };
+
+  trace.enter_state("select");
+  auto const l_selected = detail::psort__select_local(
+      lbegin, lbegin + n_l_elem, key_of, k, nelem, false, team, nthreads);
+  trace.exit_state("select");
+
+  auto const g_first  = first.pos();
+  auto const g_middle = middle.pos();
+
+  // Selected elements outside of [first, middle) leave holes that are
+  // filled with the elements in [first, middle) that are not selected,
+  // matched by their global rank among the holes
+  std::vector<value_type>  l_values;
+  std::vector<value_type>  l_displaced;
+  std::vector<std::size_t> l_holes;
+  l_values.reserve(l_selected.size());
+  auto sel_it = l_selected.begin();
+  for (std::size_t i = 0; i < static_cast<std::size_t>(n_l_elem); ++i) {
+    auto const g_idx    = pattern.global(l_range.begin + i);
+    bool const selected = sel_it != l_selected.end() && *sel_it == i;
+    if (selected) {
+      ++sel_it;
+      l_values.push_back(lbegin[i]);
+      if (g_idx >= g_middle) {
+        l_holes.push_back(i);
+      }
+    }
+    else if (g_idx < g_middle) {
+      l_displaced.push_back(lbegin[i]);
+    }
+  }
+
+  // The selected elements are sorted in a blocked temporary array as
+  // dash::sort requires the local elements of every unit to be a
+  // contiguous global range
+  dash::Array<value_type> g_sorted(k, dash::BLOCKED, team);
+
+  trace.enter_state("exchange");
+  auto const nunits = team.size();
+  std::array<std::size_t, 3> l_count{
+      l_values.size(), l_displaced.size(), l_holes.size()};
+  std::vector<std::size_t> g_count(3 * nunits);
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          l_count.data(),
+          g_count.data(),
+          3,
+          dash::dart_datatype<std::size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::vector<std::size_t> values_offsets(nunits + 1, 0);
+  std::vector<std::size_t> sorted_offsets(nunits + 1, 0);
+  std::vector<std::size_t> displaced_offsets(nunits + 1, 0);
+  std::vector<std::size_t> hole_offsets(nunits + 1, 0);
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    values_offsets[unit + 1] = values_offsets[unit] + g_count[3 * unit];
+    sorted_offsets[unit + 1] =
+        sorted_offsets[unit] +
+        g_sorted.pattern().local_size(dash::team_unit_t(unit));
+    displaced_offsets[unit + 1] =
+        displaced_offsets[unit] + g_count[3 * unit + 1];
+    hole_offsets[unit + 1] = hole_offsets[unit] + g_count[3 * unit + 2];
+  }
+
+  auto const r_values = detail::psort__exchange_ranked(
+      l_values, values_offsets, sorted_offsets, team);
+  auto const r_displaced = detail::psort__exchange_ranked(
+      l_displaced, displaced_offsets, hole_offsets, team);
+  trace.exit_state("exchange");
+
+  std::copy(r_values.begin(), r_values.end(), g_sorted.lbegin());
+  for (std::size_t h = 0; h < l_holes.size(); ++h) {
+    lbegin[l_holes[h]] = r_displaced[h];
+  }
+
+  dash::sort(g_sorted.begin(), g_sorted.end(), sortable_hash);
+
+  // Copy the sorted elements to the local positions in [first, middle),
+  // one transfer per run of consecutive global indices
+  trace.enter_state("copy_sorted");
+  std::vector<dash::Future<value_type*>> copies;
+  std::size_t l_idx = 0;
+  while (l_idx < static_cast<std::size_t>(n_l_elem)) {
+    auto const g_idx = pattern.global(l_range.begin + l_idx);
+    if (g_idx >= g_middle) {
+      break;
+    }
+    std::size_t run = 1;
+    while (l_idx + run < static_cast<std::size_t>(n_l_elem) &&
+           g_idx + run < g_middle &&
+           pattern.global(l_range.begin + l_idx + run) == g_idx + run) {
+      ++run;
+    }
+    copies.push_back(dash::copy_async(
+        g_sorted.begin() + (g_idx - g_first),
+        g_sorted.begin() + (g_idx - g_first + run),
+        lbegin + l_idx));
+    l_idx += run;
+  }
+  for (auto& copy : copies) {
+    copy.wait();
+  }
+  trace.exit_state("copy_sorted");
+
+  trace.enter_state("final_barrier");
+  team.barrier();
+  trace.exit_state("final_barrier");
+}
+
+template <class GlobRandomIt>
+inline void partial_sort(
+    GlobRandomIt first, GlobRandomIt middle, GlobRandomIt last)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::partial_sort(
+      first, middle, last, detail::identity_t<value_t const&>());
+}
+
+template <class GlobRandomIt, class OutputIt, class SortableHash>
+OutputIt top_k(
+    GlobRandomIt first,
+    GlobRandomIt last,
+    std::size_t  k,
+    OutputIt     out,
+    SortableHash sortable_hash)
+{
+  using value_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value &&
+          !std::is_same<mapped_type, bool>::value,
+      "Only integral and floating point keys are supported");
+
+  using radix_traits = detail::psort__radix_traits<mapped_type>;
+
+  dash::util::Trace trace("TopK");
+
+  auto const& pattern = first.pattern();
+  dash::Team& team    = pattern.team();
+
+  auto const nelem = first < last ? static_cast<std::size_t>(last - first)
+                                  : std::size_t{0};
+
+  auto const l_range  = dash::local_index_range(first, last);
+  auto const n_l_elem = l_range.end - l_range.begin;
+  auto const* lbegin  = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(first), team.myid()) +
+      l_range.begin;
+
+  auto const nthreads = dash::internal::num_local_threads(n_l_elem, team);
+
+  auto const key_of = [&sortable_hash](value_type const& value) {
+    return radix_traits::key(sortable_hash(value));
+  };
+
+  trace.enter_state("select");
+  auto const l_selected = detail::psort__select_local(
+      lbegin, lbegin + n_l_elem, key_of, k, nelem, true, team, nthreads);
+  trace.exit_state("select");
+
+  auto const descending =
+      [&sortable_hash](value_type const& a, value_type const& b) {
+        return sortable_hash(b) < sortable_hash(a);
+      };
+
+  std::vector<value_type> l_values;
+  l_values.reserve(l_selected.size());
+  for (auto const i : l_selected) {
+    l_values.push_back(lbegin[i]);
+  }
+  std::sort(l_values.begin(), l_values.end(), descending);
+
+  trace.enter_state("exchange");
+  std::size_t const l_count = l_values.size();
+  std::vector<std::size_t> g_count(team.size());
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          &l_count,
+          g_count.data(),
+          1,
+          dash::dart_datatype<std::size_t>::value,
+          team.dart_id()),
+      DART_OK);
+  auto g_values = detail::psort__allgatherv(l_values, g_count, team);
+  trace.exit_state("exchange");
+
+  // Merge the sorted runs of all units pairwise
+  trace.enter_state("merge");
+  std::vector<std::size_t> run_offsets(team.size() + 1, 0);
+  for (std::size_t unit = 0; unit < team.size(); ++unit) {
+    run_offsets[unit + 1] = run_offsets[unit] + g_count[unit];
+  }
+  for (std::size_t width = 1; width < team.size(); width *= 2) {
+    for (std::size_t unit = 0; unit + width < team.size();
+         unit += 2 * width) {
+      auto const run_last = std::min(unit + 2 * width, team.size());
+      std::inplace_merge(
+          g_values.begin() + run_offsets[unit],
+          g_values.begin() + run_offsets[unit + width],
+          g_values.begin() + run_offsets[run_last],
+          descending);
+    }
+  }
+  trace.exit_state("merge");
+
+  return std::copy(g_values.begin(), g_values.end(), out);
+}
+
+template <class GlobRandomIt, class OutputIt>
+inline OutputIt top_k(
+    GlobRandomIt first,
+    GlobRandomIt last,
+    std::size_t  k,
+    OutputIt     out)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::top_k(
+      first, last, k, out, detail::identity_t<value_t const&>());
+}
+
+#endif  // DOXYGEN
+
+}  // namespace dash
+
+#endif  // DASH__ALGORITHM__SELECT_H
@@ -2,18 +2,22 @@
 #define DASH__ALGORITHM__SORT_H
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <iterator>
 #include <type_traits>
 #include <vector>
 
 #include <dash/Array.h>
+#include <dash/Collective.h>
 #include <dash/Exception.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 #include <dash/dart/if/dart.h>
 
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Threads.h>
 
 #include <dash/internal/Logging.h>
 #include <dash/util/Trace.h>
@@ -34,6 +38,12 @@ namespace dash {
  *
  * The operation is collective among the team of the owning dash container.
  *
+ * If DASH is built with OpenMP support, the local phases of the algorithm
+ * (initial local sort, splitter search and final merge) are executed by
+ * the threads available to the calling unit, see
+ * \c dash::util::UnitLocality::num_domain_threads. Threading is disabled
+ * by setting \c DASH_DISABLE_THREADS.
+ *
  * Example:
  *
  * \code
@@ -56,7 +66,8 @@ void sort(GlobRandomIt begin, GlobRandomIt end);
  * of the hash function are required to be sortable by operator<.
  *
  * This variant may be appropriate if the underlying container does not hold
- * arithmetic values (e.g. structs).
+ * arithmetic values (e.g. structs). As the local phases of the algorithm may
+ * be multi-threaded, the hash function must be safe to call concurrently.
  *
  * In terms of data distribution, source and destination ranges passed to
  * \c dash::sort must be global (\c GlobIter<ValueType>).
@@ -80,6 +91,54 @@ void sort(GlobRandomIt begin, GlobRandomIt end);
 template <class GlobRandomIt, class SortableHash>
 void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in ascending
+ * order using a distributed LSD radix sort. The order of equal elements is
+ * preserved.
+ *
+ * The elements must be integral or floating point values. Instead of
+ * comparing elements, every pass sorts the elements by the next 8 bits of
+ * their keys: the units count the digits of their local elements, exchange
+ * the digit counts in a single collective operation and scatter the elements
+ * to their target positions with non-blocking puts. The number of passes
+ * depends on the range of the keys, e.g. keys within [0, 2^20) are sorted
+ * in 3 passes.
+ *
+ * In terms of data distribution, source and destination ranges passed to
+ * \c dash::radix_sort must be global (\c GlobIter<ValueType>).
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<uint64_t> arr(100);
+ *       dash::generate(arr.begin(), arr.end(), random());
+ *       dash::radix_sort(arr.begin(), arr.end());
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end);
+
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in ascending
+ * order of the keys returned by a user-defined hash function using a
+ * distributed LSD radix sort. The order of elements with equal keys is
+ * preserved.
+ *
+ * Resulting values of the hash function must be integral or floating point
+ * values. As the local phases of the algorithm may be multi-threaded, the
+ * hash function must be safe to call concurrently.
+ *
+ * \see dash::radix_sort(GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
+
 #else
 
 #define __DASH_SORT__FINAL_STEP_BY_MERGE (0)
@@ -117,7 +176,11 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   if (pattern.team().size() == 1) {
     DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
     trace.enter_state("final_local_sort");
-    std::sort(begin.local(), end.local(), sort_comp);
+    auto* lbegin = begin.local();
+    auto* lend   = end.local();
+    auto const nthreads = dash::internal::num_local_threads(
+        std::distance(lbegin, lend), pattern.team());
+    detail::psort__local_sort(lbegin, lend, sort_comp, nthreads);
     trace.exit_state("final_local_sort");
     return;
   }
@@ -147,9 +210,12 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto * lbegin = l_mem_begin + l_range.begin;
   auto * lend   = l_mem_begin + l_range.end;
 
+  // threads used in the local phases
+  auto const nthreads = dash::internal::num_local_threads(n_l_elem, team);
+
   // initial local_sort
   trace.enter_state("1:initial_local_sort");
-  std::sort(lbegin, lend, sort_comp);
+  detail::psort__local_sort(lbegin, lend, sort_comp, nthreads);
   trace.exit_state("1:initial_local_sort");
 
   trace.enter_state("2:init_temporary_global_data");
@@ -262,7 +328,8 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         p_borders,
         std::begin(lcopy),
         std::end(lcopy),
-        sortable_hash);
+        sortable_hash,
+        nthreads);
 
     detail::trace_local_histo("local histogram", l_nlt_nle);
 
@@ -300,7 +367,8 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       p_borders,
       std::begin(lcopy),
       std::end(lcopy),
-      sortable_hash);
+      sortable_hash,
+      nthreads);
   trace.exit_state("6:final_local_histogram");
 
   DASH_LOG_TRACE_RANGE("final splitters", splitters.begin(), splitters.end());
@@ -503,6 +571,20 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       &(g_partition_data.local[IDX_TARGET_DISP(nunits)]),
       &(g_partition_data.local[IDX_TARGET_DISP(nunits) + nunits]));
 
+#if (__DASH_SORT__FINAL_STEP_STRATEGY != __DASH_SORT__FINAL_STEP_BY_SORT)
+  // the receive counts are only needed for merging, exchange them while
+  // the data exchange is in progress
+  std::vector<size_t> recv_count(nunits, 0);
+  auto fut_recv_count = dash::alltoall_async(
+      // send buffer
+      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
+      // receive buffer
+      recv_count.data(),
+      // we send / receive 1 element to / from each process
+      1,
+      team);
+#endif
+
   trace.enter_state("17:exchange_data (all-to-all)");
 
   std::vector<dash::Future<iter_type> > async_copies{};
@@ -587,25 +669,12 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   trace.exit_state("18:barrier");
 
   trace.enter_state("19:final_local_sort");
-  std::sort(lbegin, lend);
+  detail::psort__local_sort(lbegin, lend, sort_comp, nthreads);
   trace.exit_state("19:final_local_sort");
 #else
   trace.enter_state("18:calc_recv_count (all-to-all)");
 
-  std::vector<size_t> recv_count(nunits, 0);
-
-  DASH_ASSERT_RETURNS(
-  dart_alltoall(
-      // send buffer
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-      // receive buffer
-      recv_count.data(),
-      // we send / receive 1 element to / from each process
-      1,
-      // dtype
-      dash::dart_datatype<size_t>::value,
-      // teamid
-      team.dart_id()), DART_OK);
+  fut_recv_count.wait();
 
   DASH_LOG_TRACE_RANGE(
       "recv count", std::begin(recv_count), std::end(recv_count));
@@ -614,15 +683,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("19:merge_local_sequences");
 
-  // merging sorted sequences
-  auto nsequences = nunits;
-  // number of merge steps in the tree
-  auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
-
   // calculate the prefix sum among all receive counts to find the offsets for
   // merging
   std::vector<size_t> recv_count_psum;
-  recv_count_psum.reserve(nsequences + 1);
+  recv_count_psum.reserve(nunits + 1);
   recv_count_psum.emplace_back(0);
 
   std::partial_sum(
@@ -635,31 +699,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       std::begin(recv_count_psum),
       std::end(recv_count_psum));
 
-  for (std::size_t d = 0; d < depth; ++d) {
-    // distance between first and mid iterator while merging
-    auto const step = std::size_t(0x1) << d;
-    // distance between first and last iterator while merging
-    auto const dist = step << 1;
-    // number of merges
-    auto const nmerges = nsequences >> 1;
-
-    // These merges are independent from each other and are candidates for
-    // shared memory parallelism
-    for (std::size_t m = 0; m < nmerges; ++m) {
-      auto first = std::next(lbegin, recv_count_psum[m * dist]);
-      auto mid   = std::next(lbegin, recv_count_psum[m * dist + step]);
-      // sometimes we have a lonely merge in the end, so we have to guarantee
-      // that we do not access out of bounds
-      auto last = std::next(
-          lbegin,
-          recv_count_psum[std::min(
-              m * dist + dist, recv_count_psum.size() - 1)]);
-
-      std::inplace_merge(first, mid, last);
-    }
-
-    nsequences -= nmerges;
-  }
+  // merging sorted sequences
+  detail::psort__merge_sequences(
+      lbegin, std::move(recv_count_psum), sort_comp, nthreads);
 
   trace.exit_state("19:merge_local_sequences");
 #endif
@@ -691,6 +733,224 @@ inline void sort(GlobRandomIt begin, GlobRandomIt end)
   dash::sort(begin, end, detail::identity_t<value_t const&>());
 }
 
+template <class GlobRandomIt, class SortableHash>
+void radix_sort(
+    GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
+{
+  using iter_type   = GlobRandomIt;
+  using value_type  = typename iter_type::value_type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value &&
+          !std::is_same<mapped_type, bool>::value,
+      "Only integral and floating point keys are supported");
+
+  using radix_traits = detail::psort__radix_traits<mapped_type>;
+  using key_type     = typename radix_traits::key_type;
+
+  auto pattern = begin.pattern();
+
+  dash::util::Trace trace("RadixSort");
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::radix_sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+  if (begin >= end) {
+    DASH_LOG_TRACE("dash::radix_sort", "empty range");
+    trace.enter_state("final_barrier");
+    pattern.team().barrier();
+    trace.exit_state("final_barrier");
+    return;
+  }
+
+  dash::Team& team   = pattern.team();
+  auto const  nunits = team.size();
+  auto const  myid   = team.myid();
+
+  auto const unit_at_begin = pattern.unit_at(begin.pos());
+
+  // local distance
+  auto const l_range = dash::local_index_range(begin, end);
+
+  auto* l_mem_begin = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(begin), team.myid());
+
+  auto const n_l_elem = l_range.end - l_range.begin;
+
+  auto * lbegin = l_mem_begin + l_range.begin;
+  auto * lend   = l_mem_begin + l_range.end;
+
+  // threads used in the local phases
+  auto const nthreads = dash::internal::num_local_threads(n_l_elem, team);
+
+  auto const key_of = [&sortable_hash](value_type const& value) {
+    return radix_traits::key(sortable_hash(value));
+  };
+
+  trace.enter_state("1:find_global_key_range");
+
+  // Sorting the keys relative to the global minimum skips all passes over
+  // leading bits which are equal in all keys
+  auto const key_min_range =
+      detail::psort__radix_key_range(lbegin, lend, key_of, team);
+  auto const key_min = key_min_range.first;
+  auto const npasses = detail::psort__radix_npasses(key_min_range.second);
+
+  trace.exit_state("1:find_global_key_range");
+
+  DASH_LOG_TRACE_VAR("dash::radix_sort", npasses);
+
+  if (npasses == 0) {
+    // all keys are equal, so nothing to sort globally.
+    team.barrier();
+    return;
+  }
+
+  trace.enter_state("2:init_temporary_local_data");
+
+  auto const p_unit_info =
+      detail::psort__find_partition_borders(pattern, begin, end);
+
+  auto const& acc_partition_count = p_unit_info.acc_partition_count;
+
+  // Global iterators to the first element of every unit within the range
+  // to be sorted [begin, end)
+  std::vector<iter_type> unit_first(nunits, begin);
+  for (auto const& unit : p_unit_info.valid_remote_partitions) {
+    if (unit != unit_at_begin) {
+      unit_first[unit] = iter_type{
+          &(begin.globmem()),
+          pattern,
+          pattern.global_index(static_cast<dash::team_unit_t>(unit), {})};
+    }
+  }
+
+  std::vector<value_type>  lbuf(n_l_elem);
+  std::vector<std::size_t> l_histo(PSORT__RADIX);
+  std::vector<std::size_t> g_histo(PSORT__RADIX);
+  std::vector<std::size_t> l_prefix(PSORT__RADIX);
+  std::vector<std::size_t> l_target_disp(PSORT__RADIX);
+
+  auto const nelem = acc_partition_count.back();
+
+  trace.exit_state("2:init_temporary_local_data");
+
+  for (int pass = 0; pass < npasses; ++pass) {
+    auto const shift = pass * PSORT__RADIX_BITS;
+    auto const digit = [&key_of, key_min, shift](value_type const& value) {
+      return static_cast<std::size_t>(
+          static_cast<key_type>(key_of(value) - key_min) >> shift) &
+             (PSORT__RADIX - 1);
+    };
+
+    trace.enter_state("3:local_scatter");
+    detail::psort__radix_scatter(
+        lbegin, lend, lbuf.data(), digit, l_histo, nthreads);
+    trace.exit_state("3:local_scatter");
+
+    // Number of elements of every digit at all units and at the preceding
+    // units. The allreduce also guarantees that all units have copied their
+    // local elements before they are overwritten in the data exchange
+    trace.enter_state("4:exchange_histograms (exscan, allreduce)");
+    DASH_ASSERT_RETURNS(
+        dart_exscan(
+            l_histo.data(),
+            l_prefix.data(),
+            PSORT__RADIX,
+            dash::dart_datatype<std::size_t>::value,
+            DART_OP_SUM,
+            team.dart_id()),
+        DART_OK);
+    if (myid == 0) {
+      // The result of the exclusive scan is undefined on the first unit
+      std::fill(l_prefix.begin(), l_prefix.end(), 0);
+    }
+    detail::psort__global_histogram(
+        l_histo.begin(), l_histo.end(), g_histo.begin(), team.dart_id());
+    trace.exit_state("4:exchange_histograms (exscan, allreduce)");
+
+    // The elements of a digit are placed after the elements of all smaller
+    // digits and after the elements of the same digit at preceding units
+    bool        single_digit = false;
+    std::size_t g_offset     = 0;
+    for (std::size_t d = 0; d < PSORT__RADIX; ++d) {
+      l_target_disp[d] = g_offset + l_prefix[d];
+      single_digit     = single_digit || (g_histo[d] == nelem);
+      g_offset += g_histo[d];
+    }
+
+    if (single_digit) {
+      // All elements have the same digit in this pass, their order does
+      // not change
+      continue;
+    }
+
+    trace.enter_state("5:exchange_data (all-to-all)");
+
+    auto        group  = dash::internal::make_handle_group();
+    auto const* l_send = lbuf.data();
+
+    for (std::size_t d = 0; d < PSORT__RADIX; ++d) {
+      auto send_count  = l_histo[d];
+      auto target_disp = l_target_disp[d];
+
+      // The elements of a digit may be split across several units
+      while (send_count > 0) {
+        auto const unit =
+            std::distance(
+                std::begin(acc_partition_count),
+                std::upper_bound(
+                    std::begin(acc_partition_count),
+                    std::end(acc_partition_count),
+                    target_disp)) -
+            1;
+        auto const u_disp = target_disp - acc_partition_count[unit];
+        auto const u_count =
+            std::min(send_count, acc_partition_count[unit + 1] - target_disp);
+
+        if (unit == myid.id) {
+          std::copy(l_send, l_send + u_count, std::next(lbegin, u_disp));
+        }
+        else {
+          dash::internal::put_group(
+              (unit_first[unit] + u_disp).dart_gptr(),
+              l_send,
+              u_count,
+              group.get());
+        }
+
+        l_send += u_count;
+        target_disp += u_count;
+        send_count -= u_count;
+      }
+    }
+
+    DASH_ASSERT_RETURNS(dart_handle_group_wait(group.get()), DART_OK);
+
+    trace.exit_state("5:exchange_data (all-to-all)");
+
+    trace.enter_state("6:barrier");
+    team.barrier();
+    trace.exit_state("6:barrier");
+  }
+
+  DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
+}
+
+template <class GlobRandomIt>
+inline void radix_sort(GlobRandomIt begin, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::radix_sort(begin, end, detail::identity_t<value_t const&>());
+}
+
 #endif  // DOXYGEN
 
 }  // namespace dash
@@ -3,9 +3,13 @@
 
 #include <dash/GlobAsyncRef.h>
 #include <dash/GlobRef.h>
+#include <dash/Onesided.h>
 
+#include <dash/algorithm/Copy.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/BlockRange.h>
+#include <dash/algorithm/internal/Threads.h>
 
 #include <dash/Iterator.h>
 
@@ -14,10 +18,19 @@
 
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
 #endif
 
+// Maximum number of elements fetched at once in the out-of-place transform
+#define DASH__TRANSFORM__CHUNK_ELEM (1 << 14)
+
 namespace dash {
 
 #ifdef DOXYGEN
@@ -60,8 +73,17 @@ OutputIt transform(
  * Apply a given function to pairs of elements from two ranges and store the
  * result in another range, beginning at \c out_first.
  *
- * Corresponding to \c MPI_Accumulate, the binary operation is executed
- * atomically on single elements.
+ * If the output range is the second input range, corresponding to
+ * \c MPI_Accumulate, the binary operation is executed atomically on single
+ * elements.
+ *
+ * If the output range differs from the second input range and all ranges
+ * are global, every unit computes the output elements in its local memory
+ * and the patterns of the three ranges may differ. Input elements that are
+ * not aligned with the local output elements are fetched in bulk, overlapped
+ * with the computation. Like \c dash::copy, the operation does not
+ * synchronize the units, a barrier is required before output elements
+ * written by other units can be read.
  *
  * Precondition: All elements in the input range are contained in a single
  * block so that
@@ -254,6 +276,237 @@ GlobOutputIt transform_local(
   return out_first + num_gvalues;
 }
 
+/**
+ * DART operation of a binary operation used to accumulate values in the
+ * output range, \c DART_OP_UNDEFINED for operations without a DART
+ * equivalent.
+ */
+template <typename BinaryOperation, typename = void>
+struct transform_accumulate_operation
+: public std::integral_constant<dart_operation_t, DART_OP_UNDEFINED>
+{ };
+
+template <typename BinaryOperation>
+struct transform_accumulate_operation<
+  BinaryOperation,
+  typename std::enable_if<
+    std::is_same<
+      decltype(BinaryOperation::dart_operation()),
+      dart_operation_t>::value>::type>
+: public std::integral_constant<
+    dart_operation_t, BinaryOperation::dart_operation()>
+{ };
+
+template <class PatternType>
+bool transform_patterns_equal(
+  const PatternType & pattern_a,
+  const PatternType & pattern_b)
+{
+  return pattern_a == pattern_b;
+}
+
+template <class PatternTypeA, class PatternTypeB>
+bool transform_patterns_equal(
+  const PatternTypeA &,
+  const PatternTypeB &)
+{
+  return false;
+}
+
+/**
+ * Whether the elements of the global range starting at \c in_first are
+ * stored at the same local offsets as the elements of the global range
+ * starting at \c out_first.
+ */
+template <class GlobInputIt, class GlobOutputIt>
+bool transform_aligned(
+  const GlobInputIt  & in_first,
+  const GlobOutputIt & out_first)
+{
+  return transform_patterns_equal(in_first.pattern(), out_first.pattern()) &&
+         in_first.pos() == out_first.pos();
+}
+
+/**
+ * Reads the global range \c [in_first, in_first + nelem) into the local
+ * buffer \c dst, split into one transfer per block of the input pattern.
+ */
+template <
+  typename ValueType,
+  class    GlobInputIt >
+void transform_get(
+  GlobInputIt           in_first,
+  size_t                nelem,
+  ValueType           * dst,
+  dart_handle_group_t   group)
+{
+  dash::internal::for_each_block_range(
+    in_first, nelem,
+    [&](GlobInputIt block_first, size_t nblock) {
+      dash::internal::get_group(block_first.dart_gptr(), dst, nblock, group);
+      dst += nblock;
+    });
+}
+
+/**
+ * Out-of-place transform <tt>C = op(A, B)</tt> of three global ranges
+ * with arbitrary patterns.
+ *
+ * Every unit computes the elements of the output range in its local
+ * memory. Input elements that are not stored at the same local offsets
+ * as the output elements are fetched in chunks of contiguous global
+ * elements, the fetch of the next chunk is overlapped with the
+ * computation of the current chunk.
+ */
+template <
+    class GlobInputIt1,
+    class GlobInputIt2,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_out_of_place(
+    GlobInputIt1    in_a_first,
+    GlobInputIt1    in_a_last,
+    GlobInputIt2    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op)
+{
+  typedef typename dash::iterator_traits<GlobInputIt1>::value_type value_a_t;
+  typedef typename dash::iterator_traits<GlobInputIt2>::value_type value_b_t;
+  typedef typename std::decay<value_a_t>::type                      a_t;
+  typedef typename std::decay<value_b_t>::type                      b_t;
+
+  dash::util::Trace trace("transform");
+
+  auto const   nelem       = dash::distance(in_a_first, in_a_last);
+  auto         out_last    = out_first + nelem;
+  auto const & pattern_out = out_first.pattern();
+
+  auto const l_idx_range = dash::local_index_range(out_first, out_last);
+  auto const l_out_range = dash::local_range(out_first, out_last);
+  size_t const n_l_elem  = l_idx_range.end - l_idx_range.begin;
+  DASH_LOG_TRACE_VAR("dash::transform", n_l_elem);
+  if (n_l_elem == 0) {
+    return out_last;
+  }
+  auto * l_out = l_out_range.begin;
+
+  // Inputs aligned with the output range are read from local memory:
+  bool const aligned_a = transform_aligned(in_a_first, out_first);
+  bool const aligned_b = transform_aligned(in_b_first, out_first);
+  const a_t * l_a = aligned_a
+                    ? dash::local_range(in_a_first, in_a_last).begin
+                    : nullptr;
+  const b_t * l_b = aligned_b
+                    ? dash::local_range(in_b_first, in_b_first + nelem).begin
+                    : nullptr;
+
+  if (aligned_a && aligned_b) {
+    trace.enter_state("local");
+    // All units operate on local ranges that have identical distribution:
+#ifdef DASH_ENABLE_OPENMP
+    int n_threads = dash::internal::num_local_threads(
+                      n_l_elem, pattern_out.team());
+    #pragma omp parallel for num_threads(n_threads) schedule(static) \
+      if (n_threads > 1)
+#endif
+    for (size_t i = 0; i < n_l_elem; ++i) {
+      l_out[i] = binary_op(l_a[i], l_b[i]);
+    }
+    trace.exit_state("local");
+    return out_last;
+  }
+
+  if (in_a_first.pattern().ndim() > 1 || in_b_first.pattern().ndim() > 1) {
+    DASH_THROW(
+      dash::exception::NotImplemented,
+      "dash::transform: input ranges with more than one dimension must "
+      "be aligned with the output range");
+  }
+
+  // Split the local output range in chunks of elements that are
+  // contiguous in the global range:
+  typedef std::pair<size_t, size_t> chunk_t;
+  std::vector<chunk_t> chunks;
+  auto const g_out_begin = out_first.pos();
+  auto const g_out_end   = g_out_begin + nelem;
+  for (size_t l = 0; l < n_l_elem; ) {
+    auto const g_first = pattern_out.global(l_idx_range.begin + l);
+    size_t     len     = 1;
+    while (l + len < n_l_elem && len < DASH__TRANSFORM__CHUNK_ELEM &&
+           pattern_out.global(l_idx_range.begin + l + len)
+             == g_first + static_cast<decltype(g_first)>(len)) {
+      ++len;
+    }
+    if (g_first >= g_out_begin && g_first < g_out_end) {
+      chunks.push_back(chunk_t(l, len));
+    }
+    l += len;
+  }
+  DASH_LOG_TRACE("dash::transform", "chunks:", chunks.size());
+
+  std::vector<a_t> buf_a[2];
+  std::vector<b_t> buf_b[2];
+  // One handle group per buffer slot, groups are reset by a local wait:
+  std::shared_ptr<dart_handle_group_struct> group[2] = {
+    dash::internal::make_handle_group(),
+    dash::internal::make_handle_group()
+  };
+  auto const max_chunk_size = std::max_element(
+                                chunks.begin(), chunks.end(),
+                                [](const chunk_t & lhs, const chunk_t & rhs) {
+                                  return lhs.second < rhs.second;
+                                })->second;
+  for (int s = 0; s < 2; ++s) {
+    if (!aligned_a) {
+      buf_a[s].resize(max_chunk_size);
+    }
+    if (!aligned_b) {
+      buf_b[s].resize(max_chunk_size);
+    }
+  }
+
+  // Start fetching the input elements of the chunk into the buffers of the
+  // given slot
+  auto fetch = [&](size_t c, int s) {
+    auto const offset = pattern_out.global(
+                          l_idx_range.begin + chunks[c].first)
+                        - g_out_begin;
+    auto const len    = chunks[c].second;
+    if (!aligned_a) {
+      transform_get(in_a_first + offset, len, buf_a[s].data(),
+                    group[s].get());
+    }
+    if (!aligned_b) {
+      transform_get(in_b_first + offset, len, buf_b[s].data(),
+                    group[s].get());
+    }
+  };
+
+  trace.enter_state("pipeline");
+  fetch(0, 0);
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    int const slot = c % 2;
+    if (c + 1 < chunks.size()) {
+      fetch(c + 1, (c + 1) % 2);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_handle_group_wait_local(group[slot].get()),
+      DART_OK);
+
+    auto const   l_first = chunks[c].first;
+    auto const   len     = chunks[c].second;
+    const a_t  * a       = aligned_a ? l_a + l_first : buf_a[slot].data();
+    const b_t  * b       = aligned_b ? l_b + l_first : buf_b[slot].data();
+    auto       * out     = l_out + l_first;
+    for (size_t i = 0; i < len; ++i) {
+      out[i] = binary_op(a[i], b[i]);
+    }
+  }
+  trace.exit_state("pipeline");
+
+  return out_last;
+}
+
 /**
  * Specialization of \c dash::transform for global lhs input range.
  */
@@ -278,23 +531,24 @@ GlobOutputIt transform(
 {
   using iterator_traits = dash::iterator_traits<InputIt>;
   DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
-  auto in_first = in_a_first;
-  auto in_last  = in_a_last;
 
-  if (in_b_first == out_first) {
-    // Output range is rhs input range: C += A
-    // Input is (in_a_first, in_a_last).
-  } else {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::transform is only implemented for out = op(in,out)");
+  // Iterators only compare their positions, the output range is the rhs
+  // input range if both reference the same global memory
+  if (!(in_b_first == out_first) ||
+      !DART_GPTR_EQUAL(in_b_first.dart_gptr(), out_first.dart_gptr())) {
     // Output range different from rhs input range: C = A+B
-    // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
-
-    // TODO:
-    // in_range.allocate(...);
-    // in_first = in_range.begin();
-    // in_last  = in_range.end();
+    return transform_out_of_place(
+             in_a_first, in_a_last, in_b_first, out_first, binary_op);
+  }
+  // Output range is rhs input range: C += A
+  // Input is (in_a_first, in_a_last).
+  dart_operation_t dop =
+                 transform_accumulate_operation<BinaryOperation>::value;
+  if (dop == DART_OP_UNDEFINED) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::transform: out = op(in,out) requires an operation with "
+      "DART equivalent");
   }
 
   dash::util::Trace trace("transform");
@@ -354,7 +608,7 @@ GlobOutputIt transform(
       dest_gptr,
       l_values,
       num_local_elements,
-      binary_op.dart_operation());
+      dop);
   trace.exit_state("transform_blocking");
 
   return out_first + global_offset + num_local_elements;
@@ -0,0 +1,615 @@
+#ifndef DASH__ALGORITHM__TRANSFORM_REDUCE_H__
+#define DASH__ALGORITHM__TRANSFORM_REDUCE_H__
+
+#include <dash/Exception.h>
+#include <dash/Future.h>
+#include <dash/Iterator.h>
+#include <dash/Types.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Transform.h>
+#include <dash/algorithm/internal/Threads.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Reduces the results of \c transform_op applied to the elements in the
+ * global range \c [in_first, in_last) using the associative and
+ * commutative binary operation \c reduce_op, starting from \c init:
+ *
+ * <tt>
+ *   init op transform_op(in[0]) op ... op transform_op(in[n-1])
+ * </tt>
+ *
+ * Every unit transforms and reduces its local portion of the range in a
+ * single pass without intermediate storage, the local results are
+ * combined in a single allreduce.
+ *
+ * Collective operation.
+ *
+ * \returns  The reduced value on all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOp,
+  class UnaryTransformOp >
+ValueType transform_reduce(
+  GlobInputIt      in_first,
+  GlobInputIt      in_last,
+  ValueType        init,
+  BinaryReduceOp   reduce_op,
+  UnaryTransformOp transform_op);
+
+/**
+ * Reduces the results of \c transform_op applied to pairs of elements of
+ * the global ranges \c [in_a_first, in_a_last) and \c in_b_first using
+ * the associative and commutative binary operation \c reduce_op, starting
+ * from \c init:
+ *
+ * <tt>
+ *   init op transform_op(a[0], b[0]) op ... op transform_op(a[n-1], b[n-1])
+ * </tt>
+ *
+ * Precondition: Both ranges have the same pattern and start at the same
+ * global position so that their local portions are aligned.
+ *
+ * Collective operation.
+ *
+ * \returns  The reduced value on all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryReduceOp,
+  class BinaryTransformOp >
+ValueType transform_reduce(
+  GlobInputIt1      in_a_first,
+  GlobInputIt1      in_a_last,
+  GlobInputIt2      in_b_first,
+  ValueType         init,
+  BinaryReduceOp    reduce_op,
+  BinaryTransformOp transform_op);
+
+/**
+ * Computes the inner product of the global ranges \c [in_a_first,
+ * in_a_last) and \c in_b_first, starting from \c init.
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType >
+ValueType inner_product(
+  GlobInputIt1 in_a_first,
+  GlobInputIt1 in_a_last,
+  GlobInputIt2 in_b_first,
+  ValueType    init);
+
+/**
+ * Computes the generalized inner product of the global ranges
+ * \c [in_a_first, in_a_last) and \c in_b_first with \c op1 in place of
+ * the sum and \c op2 in place of the product, starting from \c init.
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryOperation1,
+  class BinaryOperation2 >
+ValueType inner_product(
+  GlobInputIt1     in_a_first,
+  GlobInputIt1     in_a_last,
+  GlobInputIt2     in_b_first,
+  ValueType        init,
+  BinaryOperation1 op1,
+  BinaryOperation2 op2);
+
+/**
+ * Asynchronous variant of \c dash::transform_reduce. The local portion of
+ * the range is reduced before the function returns, the global reduction
+ * is performed in a non-blocking allreduce.
+ *
+ * Collective operation.
+ *
+ * \returns  A future returning the reduced value.
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOp,
+  class UnaryTransformOp >
+dash::Future<ValueType> transform_reduce_async(
+  GlobInputIt      in_first,
+  GlobInputIt      in_last,
+  ValueType        init,
+  BinaryReduceOp   reduce_op,
+  UnaryTransformOp transform_op);
+
+/**
+ * Asynchronous variant of \c dash::transform_reduce on two global ranges.
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryReduceOp,
+  class BinaryTransformOp >
+dash::Future<ValueType> transform_reduce_async(
+  GlobInputIt1      in_a_first,
+  GlobInputIt1      in_a_last,
+  GlobInputIt2      in_b_first,
+  ValueType         init,
+  BinaryReduceOp    reduce_op,
+  BinaryTransformOp transform_op);
+
+/**
+ * Asynchronous variant of \c dash::inner_product.
+ *
+ * \see dash::inner_product
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType >
+dash::Future<ValueType> inner_product_async(
+  GlobInputIt1 in_a_first,
+  GlobInputIt1 in_a_last,
+  GlobInputIt2 in_b_first,
+  ValueType    init);
+
+#else
+
+namespace internal {
+
+/**
+ * Reduces the results of \c transform_op applied to the local indices
+ * \c [0, nelem). The index range is split in one chunk per thread, the
+ * results of the chunks are combined in the order of the chunks.
+ */
+template <
+  typename ValueType,
+  typename BinaryReduceOp,
+  typename IndexTransformOp >
+local_result<ValueType> transform_reduce_local(
+  size_t           nelem,
+  dash::Team     & team,
+  BinaryReduceOp   reduce_op,
+  IndexTransformOp transform_op)
+{
+  using local_result_t = struct dash::internal::local_result<ValueType>;
+
+  int n_threads = dash::internal::num_local_threads(nelem, team);
+  DASH_LOG_TRACE_VAR("dash::internal::transform_reduce_local", n_threads);
+
+  std::vector<local_result_t> t_results(n_threads);
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static, 1) \
+    if (n_threads > 1)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    auto const t_first = nelem * t / n_threads;
+    auto const t_last  = nelem * (t + 1) / n_threads;
+    if (t_first == t_last) {
+      continue;
+    }
+    ValueType value = transform_op(t_first);
+    for (auto i = t_first + 1; i < t_last; ++i) {
+      value = reduce_op(value, transform_op(i));
+    }
+    t_results[t].value = value;
+    t_results[t].valid = true;
+  }
+
+  local_result_t l_result;
+  for (auto const & t_result : t_results) {
+    if (!t_result.valid) {
+      continue;
+    }
+    l_result.value = l_result.valid
+                     ? reduce_op(l_result.value, t_result.value)
+                     : t_result.value;
+    l_result.valid = true;
+  }
+  return l_result;
+}
+
+/**
+ * State of the global reduction of the local results, owns the custom
+ * reduction operation required if \c BinaryReduceOp has no predefined
+ * DART equivalent.
+ */
+template <
+  typename ValueType,
+  typename BinaryReduceOp >
+class transform_reduce_state
+{
+  using local_result_t = struct dash::internal::local_result<ValueType>;
+
+public:
+  transform_reduce_state(
+    const local_result_t & l_result,
+    ValueType              init,
+    BinaryReduceOp         reduce_op,
+    dash::Team           & team)
+  : _l_result(l_result)
+  , _init(init)
+  , _reduce_op(reduce_op)
+  , _team(team)
+  {
+    _dop   = dash::internal::dart_reduce_operation<BinaryReduceOp>::value;
+    _dtype = dash::dart_datatype<ValueType>::value;
+    // units with an empty local range contribute the neutral element of
+    // the sum, other operations need a custom reduction operation to
+    // ignore them
+    _predefined = (_dop == DART_OP_SUM && _dtype != DART_TYPE_UNDEFINED);
+    if (_predefined) {
+      if (!_l_result.valid) {
+        _l_result.value = ValueType();
+      }
+    } else {
+      dart_type_create_custom(sizeof(local_result_t), &_dtype);
+      dart_op_create(
+        &dash::internal::reduce_custom_fn<ValueType, BinaryReduceOp>,
+        &_reduce_op, true, _dtype, true, &_dop);
+    }
+  }
+
+  transform_reduce_state(const transform_reduce_state &) = delete;
+  transform_reduce_state & operator=(const transform_reduce_state &) = delete;
+
+  ~transform_reduce_state()
+  {
+    if (_handle != DART_HANDLE_NULL) {
+      dart_wait_local(&_handle);
+    }
+    if (!_predefined) {
+      dart_op_destroy(&_dop);
+      dart_type_destroy(&_dtype);
+    }
+  }
+
+  void allreduce()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(send_buffer(), recv_buffer(), 1, _dtype, _dop,
+                     _team.dart_id()),
+      DART_OK);
+  }
+
+  void iallreduce()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(send_buffer(), recv_buffer(), 1, _dtype, _dop,
+                      _team.dart_id(), &_handle),
+      DART_OK);
+  }
+
+  void wait()
+  {
+    DASH_ASSERT_RETURNS(
+      dart_wait_local(&_handle),
+      DART_OK);
+  }
+
+  bool test()
+  {
+    int32_t flag;
+    DASH_ASSERT_RETURNS(
+      dart_test_local(&_handle, &flag),
+      DART_OK);
+    return (flag != 0);
+  }
+
+  ValueType result()
+  {
+    if (_predefined) {
+      _g_result.valid = true;
+    }
+    return _g_result.valid
+           ? _reduce_op(_init, _g_result.value)
+           : _init;
+  }
+
+private:
+  const void * send_buffer() const
+  {
+    return _predefined
+           ? static_cast<const void *>(&_l_result.value)
+           : static_cast<const void *>(&_l_result);
+  }
+
+  void * recv_buffer()
+  {
+    return _predefined
+           ? static_cast<void *>(&_g_result.value)
+           : static_cast<void *>(&_g_result);
+  }
+
+private:
+  local_result_t     _l_result;
+  local_result_t     _g_result;
+  ValueType          _init;
+  BinaryReduceOp     _reduce_op;
+  dash::Team       & _team;
+  dart_operation_t   _dop;
+  dart_datatype_t    _dtype;
+  bool               _predefined;
+  dart_handle_t      _handle = DART_HANDLE_NULL;
+};
+
+/**
+ * Pointers to the local portions of two global ranges which are required
+ * to be aligned.
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2 >
+std::pair<
+  dash::LocalRange<const typename GlobInputIt1::value_type>,
+  dash::LocalRange<const typename GlobInputIt2::value_type> >
+transform_reduce_local_ranges(
+  GlobInputIt1 in_a_first,
+  GlobInputIt1 in_a_last,
+  GlobInputIt2 in_b_first)
+{
+  auto const nelem     = dash::distance(in_a_first, in_a_last);
+  auto const in_b_last = in_b_first + nelem;
+  if (!dash::internal::transform_aligned(in_a_first, in_b_first)) {
+    DASH_THROW(
+      dash::exception::NotImplemented,
+      "dash::transform_reduce is only implemented for aligned ranges");
+  }
+  auto const l_range_a = dash::local_range(in_a_first, in_a_last);
+  auto const l_range_b = dash::local_range(in_b_first, in_b_last);
+  DASH_ASSERT_EQ(l_range_a.end - l_range_a.begin,
+                 l_range_b.end - l_range_b.begin,
+                 "dash::transform_reduce: local ranges differ in size");
+  return std::make_pair(
+           dash::LocalRange<const typename GlobInputIt1::value_type> {
+             l_range_a.begin, l_range_a.end },
+           dash::LocalRange<const typename GlobInputIt2::value_type> {
+             l_range_b.begin, l_range_b.end });
+}
+
+template <
+  typename ValueType,
+  typename BinaryReduceOp >
+dash::Future<ValueType> transform_reduce_future(
+  std::shared_ptr<transform_reduce_state<ValueType, BinaryReduceOp>> state)
+{
+  state->iallreduce();
+  return dash::Future<ValueType>(
+    // get
+    [state]() {
+      state->wait();
+      return state->result();
+    },
+    // test
+    [state](ValueType * result) {
+      if (!state->test()) {
+        return false;
+      }
+      *result = state->result();
+      return true;
+    });
+}
+
+} // namespace internal
+
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOp,
+  class UnaryTransformOp >
+ValueType transform_reduce(
+  GlobInputIt      in_first,
+  GlobInputIt      in_last,
+  ValueType        init,
+  BinaryReduceOp   reduce_op,
+  UnaryTransformOp transform_op)
+{
+  DASH_LOG_DEBUG("dash::transform_reduce()");
+  auto       & team    = in_first.team();
+  auto const   l_range = dash::local_range(in_first, in_last);
+  auto const   l_in    = l_range.begin;
+
+  dash::internal::transform_reduce_state<ValueType, BinaryReduceOp> state(
+    dash::internal::transform_reduce_local<ValueType>(
+      l_range.end - l_range.begin,
+      team,
+      reduce_op,
+      [&](size_t i) { return transform_op(l_in[i]); }),
+    init, reduce_op, team);
+  state.allreduce();
+  return state.result();
+}
+
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryReduceOp,
+  class BinaryTransformOp >
+ValueType transform_reduce(
+  GlobInputIt1      in_a_first,
+  GlobInputIt1      in_a_last,
+  GlobInputIt2      in_b_first,
+  ValueType         init,
+  BinaryReduceOp    reduce_op,
+  BinaryTransformOp transform_op)
+{
+  DASH_LOG_DEBUG("dash::transform_reduce()");
+  auto       & team     = in_a_first.team();
+  auto const   l_ranges = dash::internal::transform_reduce_local_ranges(
+                            in_a_first, in_a_last, in_b_first);
+  auto const   l_in_a   = l_ranges.first.begin;
+  auto const   l_in_b   = l_ranges.second.begin;
+
+  dash::internal::transform_reduce_state<ValueType, BinaryReduceOp> state(
+    dash::internal::transform_reduce_local<ValueType>(
+      l_ranges.first.end - l_ranges.first.begin,
+      team,
+      reduce_op,
+      [&](size_t i) { return transform_op(l_in_a[i], l_in_b[i]); }),
+    init, reduce_op, team);
+  state.allreduce();
+  return state.result();
+}
+
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType >
+ValueType inner_product(
+  GlobInputIt1 in_a_first,
+  GlobInputIt1 in_a_last,
+  GlobInputIt2 in_b_first,
+  ValueType    init)
+{
+  return dash::transform_reduce(
+           in_a_first, in_a_last, in_b_first, init,
+           dash::plus<ValueType>(), dash::multiply<ValueType>());
+}
+
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryOperation1,
+  class BinaryOperation2 >
+ValueType inner_product(
+  GlobInputIt1     in_a_first,
+  GlobInputIt1     in_a_last,
+  GlobInputIt2     in_b_first,
+  ValueType        init,
+  BinaryOperation1 op1,
+  BinaryOperation2 op2)
+{
+  return dash::transform_reduce(
+           in_a_first, in_a_last, in_b_first, init, op1, op2);
+}
+
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOp,
+  class UnaryTransformOp >
+dash::Future<ValueType> transform_reduce_async(
+  GlobInputIt      in_first,
+  GlobInputIt      in_last,
+  ValueType        init,
+  BinaryReduceOp   reduce_op,
+  UnaryTransformOp transform_op)
+{
+  DASH_LOG_DEBUG("dash::transform_reduce_async()");
+  using state_t = dash::internal::transform_reduce_state<
+                    ValueType, BinaryReduceOp>;
+  auto       & team    = in_first.team();
+  auto const   l_range = dash::local_range(in_first, in_last);
+  auto const   l_in    = l_range.begin;
+
+  return dash::internal::transform_reduce_future(
+           std::make_shared<state_t>(
+             dash::internal::transform_reduce_local<ValueType>(
+               l_range.end - l_range.begin,
+               team,
+               reduce_op,
+               [&](size_t i) { return transform_op(l_in[i]); }),
+             init, reduce_op, team));
+}
+
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class BinaryReduceOp,
+  class BinaryTransformOp >
+dash::Future<ValueType> transform_reduce_async(
+  GlobInputIt1      in_a_first,
+  GlobInputIt1      in_a_last,
+  GlobInputIt2      in_b_first,
+  ValueType         init,
+  BinaryReduceOp    reduce_op,
+  BinaryTransformOp transform_op)
+{
+  DASH_LOG_DEBUG("dash::transform_reduce_async()");
+  using state_t = dash::internal::transform_reduce_state<
+                    ValueType, BinaryReduceOp>;
+  auto       & team     = in_a_first.team();
+  auto const   l_ranges = dash::internal::transform_reduce_local_ranges(
+                            in_a_first, in_a_last, in_b_first);
+  auto const   l_in_a   = l_ranges.first.begin;
+  auto const   l_in_b   = l_ranges.second.begin;
+
+  return dash::internal::transform_reduce_future(
+           std::make_shared<state_t>(
+             dash::internal::transform_reduce_local<ValueType>(
+               l_ranges.first.end - l_ranges.first.begin,
+               team,
+               reduce_op,
+               [&](size_t i) { return transform_op(l_in_a[i], l_in_b[i]); }),
+             init, reduce_op, team));
+}
+
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType >
+dash::Future<ValueType> inner_product_async(
+  GlobInputIt1 in_a_first,
+  GlobInputIt1 in_a_last,
+  GlobInputIt2 in_b_first,
+  ValueType    init)
+{
+  return dash::transform_reduce_async(
+           in_a_first, in_a_last, in_b_first, init,
+           dash::plus<ValueType>(), dash::multiply<ValueType>());
+}
+
+#endif // DOXYGEN
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSFORM_REDUCE_H__
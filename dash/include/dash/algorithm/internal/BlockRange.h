@@ -0,0 +1,42 @@
+#ifndef DASH__ALGORITHM__INTERNAL__BLOCK_RANGE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__BLOCK_RANGE_H__INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+
+namespace dash {
+namespace internal {
+
+/**
+ * Invokes \c func(block_first, nblock) on the consecutive subranges of
+ * the one-dimensional global range \c [first, first + nelem) that do not
+ * cross a block boundary of the range's pattern, so every subrange is
+ * contiguous in the memory of a single unit.
+ */
+template <
+  class GlobIter,
+  class BlockFunction >
+void for_each_block_range(
+  GlobIter      first,
+  std::size_t   nelem,
+  BlockFunction func)
+{
+  const auto & pattern = first.pattern();
+  using index_type = typename GlobIter::index_type;
+
+  while (nelem > 0) {
+    index_type const  g_idx  = first.pos();
+    auto const        block  = pattern.block(pattern.block_at({{ g_idx }}));
+    std::size_t const nblock = std::min<std::size_t>(
+                                 nelem,
+                                 block.offset(0) + block.extent(0) - g_idx);
+    func(first, nblock);
+    first += nblock;
+    nelem -= nblock;
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__BLOCK_RANGE_H__INCLUDED
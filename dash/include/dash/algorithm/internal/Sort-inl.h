@@ -10,17 +10,34 @@
 
 #define NLT_NLE_BLOCK 2
 
+// Number of key bits sorted in one pass of the radix sort
+#define PSORT__RADIX_BITS 8
+#define PSORT__RADIX (1 << PSORT__RADIX_BITS)
+
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <dash/Array.h>
 #include <dash/Types.h>
 
+#include <dash/algorithm/internal/Threads.h>
+
 #include <dash/internal/Logging.h>
 
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 namespace detail {
 
 struct UnitInfo {
@@ -67,6 +84,205 @@ public:
   }
 };
 
+/**
+ * Returns the number of elements from the sequence \c [a, a+na) among the
+ * first \c k elements of the stable merge of \c [a, a+na) and
+ * \c [b, b+nb).
+ */
+template <typename ValueType, typename Compare>
+inline std::size_t psort__merge_corank(
+    std::size_t      k,
+    ValueType const* a,
+    std::size_t      na,
+    ValueType const* b,
+    std::size_t      nb,
+    Compare          comp)
+{
+  std::size_t lo = (k > nb) ? k - nb : 0;
+  std::size_t hi = std::min(k, na);
+
+  while (lo < hi) {
+    auto const i = lo + (hi - lo) / 2;
+    auto const j = k - i;
+    // a[i] precedes b[j-1] in the stable merge if it is not greater
+    if (!comp(b[j - 1], a[i])) {
+      lo = i + 1;
+    }
+    else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Merges the consecutive sorted sequences in \c first with offsets
+ * \c seq_offsets (\c nseq + 1 offsets, starting with 0) in a binary merge
+ * tree.
+ *
+ * With more than one thread, the merges of a level of the tree are split
+ * into equally sized parts along the merge path so that all threads are
+ * busy even in the upper levels where only a few merges remain. The
+ * sequences are merged into a temporary buffer of the same size as the
+ * range, alternating between range and buffer.
+ */
+template <typename ValueType, typename Compare>
+inline void psort__merge_sequences(
+    ValueType*               first,
+    std::vector<std::size_t> seq_offsets,
+    Compare                  comp,
+    int                      nthreads)
+{
+  DASH_LOG_TRACE("< psort__merge_sequences");
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+
+  auto nsequences = seq_offsets.size() - 1;
+
+  if (nsequences < 2) {
+    return;
+  }
+
+  if (nthreads < 2) {
+    // number of merge steps in the tree
+    auto const depth =
+        static_cast<std::size_t>(std::ceil(std::log2(nsequences)));
+
+    for (std::size_t d = 0; d < depth; ++d) {
+      // distance between first and mid iterator while merging
+      auto const step = std::size_t(0x1) << d;
+      // distance between first and last iterator while merging
+      auto const dist = step << 1;
+      // number of merges
+      auto const nmerges = nsequences >> 1;
+
+      for (std::size_t m = 0; m < nmerges; ++m) {
+        auto first_it = std::next(first, seq_offsets[m * dist]);
+        auto mid_it   = std::next(first, seq_offsets[m * dist + step]);
+        // sometimes we have a lonely merge in the end, so we have to
+        // guarantee that we do not access out of bounds
+        auto last_it = std::next(
+            first,
+            seq_offsets[std::min(m * dist + dist, seq_offsets.size() - 1)]);
+
+        std::inplace_merge(first_it, mid_it, last_it, comp);
+      }
+
+      nsequences -= nmerges;
+    }
+    DASH_LOG_TRACE("psort__merge_sequences >");
+    return;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  auto const nelem = seq_offsets.back();
+
+  std::unique_ptr<ValueType[]> buffer(new ValueType[nelem]);
+
+  ValueType* src = first;
+  ValueType* dst = buffer.get();
+
+  while (nsequences > 1) {
+    // number of pairs to merge, a lonely sequence at the end is copied
+    auto const nmerges = (nsequences + 1) / 2;
+    // split every merge into parts to keep all threads busy
+    auto const nparts = std::max<std::size_t>(nthreads / nmerges, 1);
+    auto const ntasks = static_cast<long>(nmerges * nparts);
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (long task = 0; task < ntasks; ++task) {
+      auto const m    = static_cast<std::size_t>(task) / nparts;
+      auto const part = static_cast<std::size_t>(task) % nparts;
+
+      auto const a_begin = seq_offsets[2 * m];
+      auto const b_begin = seq_offsets[std::min(2 * m + 1, nsequences)];
+      auto const b_end   = seq_offsets[std::min(2 * m + 2, nsequences)];
+
+      auto const* a  = src + a_begin;
+      auto const* b  = src + b_begin;
+      auto const  na = b_begin - a_begin;
+      auto const  nb = b_end - b_begin;
+
+      auto const k_first = (na + nb) * part / nparts;
+      auto const k_last  = (na + nb) * (part + 1) / nparts;
+
+      auto const i_first = psort__merge_corank(k_first, a, na, b, nb, comp);
+      auto const i_last  = psort__merge_corank(k_last, a, na, b, nb, comp);
+
+      std::merge(
+          a + i_first,
+          a + i_last,
+          b + (k_first - i_first),
+          b + (k_last - i_last),
+          dst + a_begin + k_first,
+          comp);
+    }
+
+    // offsets of the merged sequences
+    for (std::size_t m = 0; m < nmerges; ++m) {
+      seq_offsets[m] = seq_offsets[2 * m];
+    }
+    seq_offsets[nmerges] = nelem;
+    seq_offsets.resize(nmerges + 1);
+
+    std::swap(src, dst);
+    nsequences = nmerges;
+  }
+
+  if (src != first) {
+    auto const nelem_l = static_cast<long>(nelem);
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (long i = 0; i < nelem_l; ++i) {
+      first[i] = src[i];
+    }
+  }
+#endif
+
+  DASH_LOG_TRACE("psort__merge_sequences >");
+}
+
+/**
+ * Sorts the local range \c [first, last) using \c nthreads threads: every
+ * thread sorts a contiguous chunk of the range, the sorted chunks are then
+ * merged using \c psort__merge_sequences.
+ */
+template <typename ValueType, typename Compare>
+inline void psort__local_sort(
+    ValueType* first, ValueType* last, Compare comp, int nthreads)
+{
+  DASH_LOG_TRACE("< psort__local_sort");
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+
+  auto const nelem = static_cast<std::size_t>(std::distance(first, last));
+
+  if (nthreads < 2 || nelem < static_cast<std::size_t>(nthreads)) {
+    std::sort(first, last, comp);
+    DASH_LOG_TRACE("psort__local_sort >");
+    return;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  std::vector<std::size_t> chunk_offsets(nthreads + 1);
+  for (int t = 0; t <= nthreads; ++t) {
+    chunk_offsets[t] = nelem * t / nthreads;
+  }
+
+  #pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+  for (int t = 0; t < nthreads; ++t) {
+    std::sort(first + chunk_offsets[t], first + chunk_offsets[t + 1], comp);
+  }
+
+  psort__merge_sequences(first, std::move(chunk_offsets), comp, nthreads);
+#endif
+
+  DASH_LOG_TRACE("psort__local_sort >");
+}
+
 template <typename T>
 inline void psort__calc_boundaries(
     PartitionBorder<T>& p_borders, std::vector<T>& splitters)
@@ -114,7 +330,8 @@ inline const std::vector<std::size_t> psort__local_histogram(
     PartitionBorder<MappedType> const& p_borders,
     Iter                               data_lbegin,
     Iter                               data_lend,
-    SortableHash                       sortable_hash)
+    SortableHash                       sortable_hash,
+    int                                nthreads = 1)
 {
   DASH_LOG_TRACE("< psort__local_histogram");
 
@@ -133,7 +350,15 @@ inline const std::vector<std::size_t> psort__local_histogram(
   using reference = typename std::iterator_traits<Iter>::reference;
 
   if (n_l_elem > 0) {
-    for (auto const& idx : valid_partitions) {
+    auto const nvalid = static_cast<long>(valid_partitions.size());
+    // The splitter searches are independent from each other, use threads
+    // if there are enough of them to amortize the parallel region
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+      if (nthreads > 1 && nvalid >= 64 * nthreads)
+#endif
+    for (long v = 0; v < nvalid; ++v) {
+      auto const idx = valid_partitions[v];
       // search lower bound of partition value
       auto lb_it = std::lower_bound(
           data_lbegin,
@@ -634,28 +859,343 @@ inline auto find_global_min_max(
       typename std::decay<typename dash::functional::closure_traits<
           SortableHash>::result_type>::type;
 
+  // Integral keys are reduced as 64 bit values as DART_OP_MINMAX is not
+  // defined for all small and unsigned integral types
+  using reduce_type = typename std::conditional<
+      std::is_floating_point<mapped_type>::value,
+      mapped_type,
+      typename std::conditional<
+          std::is_signed<mapped_type>::value,
+          long long,
+          unsigned long long>::type>::type;
+
   auto const n_l_elem = std::distance(lbegin, lend);
 
-  std::array<mapped_type, 2> min_max_in{
+  std::array<reduce_type, 2> min_max_in{
       // local minimum
       (n_l_elem > 0) ? sortable_hash(*lbegin)
                      : std::numeric_limits<mapped_type>::max(),
       (n_l_elem > 0) ? sortable_hash(*(std::prev(lend)))
-                     : std::numeric_limits<mapped_type>::min()};
-  std::array<mapped_type, 2> min_max_out{};
+                     : std::numeric_limits<mapped_type>::lowest()};
+  std::array<reduce_type, 2> min_max_out{};
 
   DASH_ASSERT_RETURNS(
       dart_allreduce(
           &min_max_in,                              // send buffer
           &min_max_out,                             // receive buffer
           2,                                        // buffer size
-          dash::dart_datatype<mapped_type>::value,  // data type
+          dash::dart_datatype<reduce_type>::value,  // data type
           DART_OP_MINMAX,                           // operation
           teamid                                    // team
           ),
       DART_OK);
 
-  return std::make_pair(std::get<0>(min_max_out), std::get<1>(min_max_out));
+  return std::make_pair(
+      static_cast<mapped_type>(std::get<0>(min_max_out)),
+      static_cast<mapped_type>(std::get<1>(min_max_out)));
+}
+
+/**
+ * Maps the keys of the radix sort to unsigned integers of the same width
+ * preserving their order: the sign bit of signed integers is flipped,
+ * negative floating point values are inverted bitwise.
+ */
+template <typename T, typename Enable = void>
+struct psort__radix_traits;
+
+template <typename T>
+struct psort__radix_traits<
+    T,
+    typename std::enable_if<std::is_integral<T>::value>::type> {
+  using key_type = typename std::make_unsigned<T>::type;
+
+  static constexpr key_type sign_bit() noexcept
+  {
+    return static_cast<key_type>(
+        key_type{1} << (std::numeric_limits<key_type>::digits - 1));
+  }
+
+  static key_type key(T const value) noexcept
+  {
+    return std::is_signed<T>::value
+               ? static_cast<key_type>(
+                     static_cast<key_type>(value) ^ sign_bit())
+               : static_cast<key_type>(value);
+  }
+};
+
+template <typename T>
+struct psort__radix_traits<
+    T,
+    typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static_assert(
+      sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(uint64_t),
+      "Only 32 and 64 bit floating point keys are supported");
+
+  using key_type = typename std::
+      conditional<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>::type;
+
+  static constexpr key_type sign_bit() noexcept
+  {
+    return static_cast<key_type>(
+        key_type{1} << (std::numeric_limits<key_type>::digits - 1));
+  }
+
+  static key_type key(T const value) noexcept
+  {
+    key_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & sign_bit()) ? static_cast<key_type>(~bits)
+                               : static_cast<key_type>(bits | sign_bit());
+  }
+};
+
+/**
+ * Determines the global minimum key and the range of the keys of the
+ * elements in \c [first, last) at all units of the team.
+ *
+ * The keys are reduced as <tt>unsigned long long</tt> as \c DART_OP_MINMAX
+ * compares 8 and 16 bit keys as signed values.
+ *
+ * \returns The minimum key and the difference of the maximum and minimum
+ *          key.
+ */
+template <typename ValueType, typename KeyFn>
+inline auto psort__radix_key_range(
+    ValueType const* first,
+    ValueType const* last,
+    KeyFn            key_of,
+    dash::Team&      team)
+    -> std::pair<decltype(key_of(*first)), decltype(key_of(*first))>
+{
+  using key_type  = decltype(key_of(*first));
+  using wide_type = unsigned long long;
+
+  static_assert(
+      std::is_unsigned<key_type>::value &&
+          sizeof(key_type) <= sizeof(wide_type),
+      "Radix keys must be unsigned integers of at most 64 bit");
+
+  std::array<wide_type, 2> min_max_in{std::numeric_limits<key_type>::max(),
+                                      std::numeric_limits<key_type>::min()};
+  std::array<wide_type, 2> min_max_out{};
+
+  for (auto const* it = first; it != last; ++it) {
+    wide_type const key = key_of(*it);
+    min_max_in[0]       = std::min(min_max_in[0], key);
+    min_max_in[1]       = std::max(min_max_in[1], key);
+  }
+
+  DASH_ASSERT_RETURNS(
+      dart_allreduce(
+          &min_max_in,
+          &min_max_out,
+          2,
+          DART_TYPE_ULONGLONG,
+          DART_OP_MINMAX,
+          team.dart_id()),
+      DART_OK);
+
+  auto const key_min = static_cast<key_type>(min_max_out[0]);
+  auto const key_max = static_cast<key_type>(min_max_out[1]);
+
+  return std::make_pair(key_min, static_cast<key_type>(key_max - key_min));
+}
+
+/**
+ * Number of digit passes needed to sort keys relative to the minimum key,
+ * i.e. with values in <tt>[0, key_range]</tt>.
+ */
+template <typename KeyType>
+inline int psort__radix_npasses(KeyType const key_range) noexcept
+{
+  int npasses = 0;
+  while (npasses * PSORT__RADIX_BITS < std::numeric_limits<KeyType>::digits &&
+         (key_range >> (npasses * PSORT__RADIX_BITS)) != 0) {
+    ++npasses;
+  }
+  return npasses;
+}
+
+/**
+ * One pass of the local counting sort of the radix sort: counts the digits
+ * of the elements in \c [first, last) in \c histogram and scatters the
+ * elements to \c out, ordered by digit and stable otherwise.
+ *
+ * The range is split into one contiguous chunk per thread. Each thread
+ * counts the digits of its chunk, the offsets are obtained by an exclusive
+ * scan over the counts in (digit, thread) order.
+ */
+template <typename ValueType, typename DigitFn>
+inline void psort__radix_scatter(
+    ValueType const*          first,
+    ValueType const*          last,
+    ValueType*                out,
+    DigitFn                   digit,
+    std::vector<std::size_t>& histogram,
+    int                       nthreads)
+{
+  DASH_LOG_TRACE("< psort__radix_scatter");
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+
+  auto const nelem = static_cast<std::size_t>(std::distance(first, last));
+
+  if (nelem < static_cast<std::size_t>(nthreads)) {
+    nthreads = 1;
+  }
+
+  std::vector<std::size_t> offsets(nthreads * PSORT__RADIX, 0);
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static, 1) \
+    if (nthreads > 1)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    auto* t_counts = &offsets[t * PSORT__RADIX];
+    auto const t_last = nelem * (t + 1) / nthreads;
+    for (auto i = nelem * t / nthreads; i < t_last; ++i) {
+      ++t_counts[digit(first[i])];
+    }
+  }
+
+  histogram.assign(PSORT__RADIX, 0);
+
+  std::size_t offset = 0;
+  for (std::size_t d = 0; d < PSORT__RADIX; ++d) {
+    for (int t = 0; t < nthreads; ++t) {
+      auto const count = offsets[t * PSORT__RADIX + d];
+      offsets[t * PSORT__RADIX + d] = offset;
+      offset += count;
+      histogram[d] += count;
+    }
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static, 1) \
+    if (nthreads > 1)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    auto* t_offsets = &offsets[t * PSORT__RADIX];
+    auto const t_last = nelem * (t + 1) / nthreads;
+    for (auto i = nelem * t / nthreads; i < t_last; ++i) {
+      out[t_offsets[digit(first[i])]++] = first[i];
+    }
+  }
+
+  DASH_LOG_TRACE("psort__radix_scatter >");
+}
+
+/**
+ * Finds the keys of the elements at the given global ranks in ascending
+ * order of keys, without moving elements.
+ *
+ * The keys are determined digit by digit starting at the most significant
+ * one: in every pass, the units count the digits of their local elements
+ * matching the key prefix found so far for every rank and the counts are
+ * summed up in a single allreduce. The number of passes depends on the
+ * range of the keys.
+ *
+ * \returns The keys at the given ranks relative to the global minimum key
+ *          \c key_min, i.e. \c key_min + result[r] is the key at rank
+ *          \c ranks[r].
+ */
+template <typename ValueType, typename KeyFn>
+inline auto psort__radix_select(
+    ValueType const*                first,
+    ValueType const*                last,
+    KeyFn                           key_of,
+    std::vector<std::size_t> const& ranks,
+    dash::Team&                     team,
+    int                             nthreads)
+    -> std::pair<
+        decltype(key_of(*first)),
+        std::vector<decltype(key_of(*first))>>
+{
+  using key_type = decltype(key_of(*first));
+
+  DASH_LOG_TRACE("< psort__radix_select");
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+
+  auto const nelem  = static_cast<std::size_t>(std::distance(first, last));
+  auto const nranks = ranks.size();
+
+  auto const key_min_range = psort__radix_key_range(first, last, key_of, team);
+  auto const key_min       = key_min_range.first;
+  auto const npasses       = psort__radix_npasses(key_min_range.second);
+
+  DASH_LOG_TRACE_VAR("psort__radix_select", npasses);
+
+  // Key prefix and remaining rank within the elements matching the prefix
+  std::vector<key_type>    prefix(nranks, 0);
+  std::vector<std::size_t> rank(ranks);
+
+  if (nelem < static_cast<std::size_t>(nthreads)) {
+    nthreads = 1;
+  }
+
+  std::vector<std::size_t> l_histo(nthreads * nranks * PSORT__RADIX);
+  std::vector<std::size_t> g_histo(nranks * PSORT__RADIX);
+
+  for (int pass = npasses - 1; pass >= 0; --pass) {
+    auto const shift = pass * PSORT__RADIX_BITS;
+
+    std::fill(l_histo.begin(), l_histo.end(), 0);
+
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(nthreads) schedule(static, 1) \
+      if (nthreads > 1)
+#endif
+    for (int t = 0; t < nthreads; ++t) {
+      auto* t_histo = &l_histo[t * nranks * PSORT__RADIX];
+      auto const t_last = nelem * (t + 1) / nthreads;
+      for (auto i = nelem * t / nthreads; i < t_last; ++i) {
+        auto const rel   = static_cast<key_type>(key_of(first[i]) - key_min);
+        auto const upper = static_cast<key_type>(
+            (rel >> shift) >> PSORT__RADIX_BITS);
+        auto const digit =
+            static_cast<std::size_t>(rel >> shift) & (PSORT__RADIX - 1);
+        for (std::size_t r = 0; r < nranks; ++r) {
+          if (upper == prefix[r]) {
+            ++t_histo[r * PSORT__RADIX + digit];
+          }
+        }
+      }
+    }
+
+    for (int t = 1; t < nthreads; ++t) {
+      std::transform(
+          l_histo.begin(),
+          std::next(l_histo.begin(), nranks * PSORT__RADIX),
+          std::next(l_histo.begin(), t * nranks * PSORT__RADIX),
+          l_histo.begin(),
+          std::plus<std::size_t>());
+    }
+
+    psort__global_histogram(
+        l_histo.begin(),
+        std::next(l_histo.begin(), nranks * PSORT__RADIX),
+        g_histo.begin(),
+        team.dart_id());
+
+    for (std::size_t r = 0; r < nranks; ++r) {
+      auto const* r_histo = &g_histo[r * PSORT__RADIX];
+      std::size_t d       = 0;
+      while (d < PSORT__RADIX - 1 && rank[r] >= r_histo[d]) {
+        rank[r] -= r_histo[d];
+        ++d;
+      }
+      prefix[r] = static_cast<key_type>((prefix[r] << PSORT__RADIX_BITS) | d);
+    }
+  }
+
+  DASH_LOG_TRACE("psort__radix_select >");
+  return std::make_pair(key_min, std::move(prefix));
 }
 
 #ifdef DASH_ENABLE_TRACE_LOGGING
@@ -0,0 +1,53 @@
+#ifndef DASH__ALGORITHM__INTERNAL__THREADS_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__THREADS_H__INCLUDED
+
+#include <dash/Team.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <cstddef>
+
+// Minimum number of local elements per thread in the local phases of
+// algorithms
+#define DASH__ALGORITHM__MIN_ELEM_PER_THREAD (1 << 14)
+
+namespace dash {
+namespace internal {
+
+/**
+ * Number of threads used by the calling unit to process \c n_l_elem local
+ * elements, determined from the unit's locality domain in \c team.
+ * Threads are not used for less than \c min_elem_per_thread elements per
+ * thread.
+ *
+ * \see dash::util::UnitLocality::num_domain_threads
+ */
+inline int num_local_threads(
+  std::size_t   n_l_elem,
+  dash::Team  & team                = dash::Team::All(),
+  std::size_t   min_elem_per_thread = DASH__ALGORITHM__MIN_ELEM_PER_THREAD)
+{
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc(team, team.myid());
+  auto const n_threads   = static_cast<std::size_t>(
+                             std::max(uloc.num_domain_threads(), 1));
+  auto const max_threads = std::max<std::size_t>(
+                             n_l_elem / min_elem_per_thread, 1);
+  DASH_LOG_TRACE("dash::internal::num_local_threads",
+                 "thread capacity:", n_threads,
+                 "local elements:",  n_l_elem);
+  return static_cast<int>(std::min(n_threads, max_threads));
+#else
+  (void)n_l_elem;
+  (void)team;
+  (void)min_elem_per_thread;
+  return 1;
+#endif
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__THREADS_H__INCLUDED
@@ -3,6 +3,8 @@
 
 #include <dash/atomic/GlobAtomicRef.h>
 
+#include <vector>
+
 namespace dash {
 
 // forward decls
@@ -183,6 +185,207 @@ fetch_sub(
   return ref.fetch_sub(value);
 }
 
+/*
+ * Bulk operations on multiple atomics in a global range, e.g. on elements
+ * of a \c dash::Array<dash::Atomic<T>>, addressed by a list of indices
+ * relative to the beginning of the range:
+ *
+ * \code
+ *  dash::Array<dash::Atomic<int>> hist(nbins);
+ *  std::vector<int> bins = ...;
+ *  dash::atomic::add(hist.begin(), bins.data(), bins.size(), 1);
+ * \endcode
+ *
+ * The operations are issued in one batch and completed with a single flush
+ * per target unit instead of one flush per element.
+ */
+
+namespace internal {
+
+/// Value type of the atomics referenced by a global iterator
+template<typename GlobIterType>
+using atomic_value_t = typename GlobIterType::value_type::value_type;
+
+template<
+  typename GlobIterType,
+  typename IndexType >
+std::vector<dart_gptr_t> atomic_bulk_gptrs(
+  GlobIterType       first,
+  const IndexType  * indices,
+  size_t             count)
+{
+  std::vector<dart_gptr_t> gptrs;
+  gptrs.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    gptrs.push_back((first + indices[i]).dart_gptr());
+  }
+  return gptrs;
+}
+
+} // namespace internal
+
+/**
+ * Atomic fetch-and-op operation on the \c count atomics at the positions
+ * \c indices relative to \c first, applying \c binary_op with the value
+ * at the same position in \c values.
+ *
+ * The values of the atomics before the operations are stored in
+ * \c results, which may be \c nullptr if they are not needed.
+ */
+template<
+  typename GlobIterType,
+  typename IndexType,
+  typename BinaryOp,
+  typename T = internal::atomic_value_t<GlobIterType> >
+void fetch_op(
+  GlobIterType                                   first,
+  const IndexType                              * indices,
+  size_t                                         count,
+  const BinaryOp                                 binary_op,
+  const internal::atomic_value_t<GlobIterType> * values,
+  internal::atomic_value_t<GlobIterType>       * results)
+{
+  static_assert(
+      dash::dart_punned_datatype<T>::value != DART_TYPE_UNDEFINED,
+      "Basic type or type smaller than 64bit required for "
+      "atomic fetch_op!");
+  static_assert(
+      dash::dart_datatype<T>::value != DART_TYPE_UNDEFINED ||
+          binary_op.op_kind() != dash::internal::OpKind::ARITHMETIC,
+      "Atomic arithmetic operations only valid on basic types!");
+  auto gptrs = internal::atomic_bulk_gptrs(
+                 first, indices, count);
+  dart_ret_t ret = dart_fetch_and_op_bulk(
+                     gptrs.data(),
+                     values,
+                     results,
+                     count,
+                     dash::dart_punned_datatype<T>::value,
+                     binary_op.dart_operation());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_fetch_and_op_bulk failed");
+}
+
+/**
+ * Atomic fetch-and-add operation on the \c count atomics at the positions
+ * \c indices relative to \c first.
+ *
+ * \see dash::atomic::fetch_op
+ */
+template<
+  typename GlobIterType,
+  typename IndexType,
+  typename T = internal::atomic_value_t<GlobIterType> >
+typename std::enable_if<
+  std::is_integral<T>::value,
+  void>::type
+fetch_add(
+  GlobIterType                                   first,
+  const IndexType                              * indices,
+  size_t                                         count,
+  /// Values to be added to the global atomic variables.
+  const internal::atomic_value_t<GlobIterType> * values,
+  internal::atomic_value_t<GlobIterType>       * results)
+{
+  dash::atomic::fetch_op(
+    first, indices, count, dash::plus<T>(), values, results);
+}
+
+/**
+ * Atomic add operation on the \c count atomics at the positions
+ * \c indices relative to \c first.
+ */
+template<
+  typename GlobIterType,
+  typename IndexType,
+  typename T = internal::atomic_value_t<GlobIterType> >
+typename std::enable_if<
+  std::is_integral<T>::value,
+  void>::type
+add(
+  GlobIterType                                   first,
+  const IndexType                              * indices,
+  size_t                                         count,
+  /// Values to be added to the global atomic variables.
+  const internal::atomic_value_t<GlobIterType> * values)
+{
+  dash::atomic::fetch_op(
+    first, indices, count, dash::plus<T>(), values, nullptr);
+}
+
+/**
+ * Atomically add \c value to each of the \c count atomics at the positions
+ * \c indices relative to \c first. An index may occur multiple times.
+ */
+template<
+  typename GlobIterType,
+  typename IndexType,
+  typename T = internal::atomic_value_t<GlobIterType> >
+typename std::enable_if<
+  std::is_integral<T>::value,
+  void>::type
+add(
+  GlobIterType                                   first,
+  const IndexType                              * indices,
+  size_t                                         count,
+  /// Value to be added to the global atomic variables.
+  const internal::atomic_value_t<GlobIterType> & value)
+{
+  std::vector<T> values(count, value);
+  dash::atomic::add(first, indices, count, values.data());
+}
+
+/**
+ * Atomic compare-and-exchange operation on the \c count atomics at the
+ * positions \c indices relative to \c first. The atomic at position
+ * \c indices[i] is replaced by \c desired[i] if it equals \c expected[i].
+ *
+ * \return  The number of exchanged values. The values of the atomics before
+ *          the operation are stored in \c results if it is not
+ *          \c nullptr.
+ */
+template<
+  typename GlobIterType,
+  typename IndexType,
+  typename T = internal::atomic_value_t<GlobIterType> >
+size_t compare_exchange(
+  GlobIterType                                   first,
+  const IndexType                              * indices,
+  size_t                                         count,
+  const internal::atomic_value_t<GlobIterType> * expected,
+  const internal::atomic_value_t<GlobIterType> * desired,
+  internal::atomic_value_t<GlobIterType>       * results = nullptr)
+{
+  static_assert(
+      dash::dart_punned_datatype<T>::value != DART_TYPE_UNDEFINED,
+      "Integral type or type smaller than 64bit required for "
+      "compare_exchange!");
+  static_assert(
+      !std::is_floating_point<T>::value,
+      "compare_exchange not available for floating point!");
+  auto gptrs = internal::atomic_bulk_gptrs(
+                 first, indices, count);
+  std::vector<T> old_values;
+  if (results == nullptr) {
+    old_values.resize(count);
+    results = old_values.data();
+  }
+  dart_ret_t ret = dart_compare_and_swap_bulk(
+                     gptrs.data(),
+                     desired,
+                     expected,
+                     results,
+                     count,
+                     dash::dart_punned_datatype<T>::value);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_compare_and_swap_bulk failed");
+  size_t num_exchanged = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (results[i] == expected[i]) {
+      ++num_exchanged;
+    }
+  }
+  return num_exchanged;
+}
+
 } // namespace atomic
 } // namespace dash
 
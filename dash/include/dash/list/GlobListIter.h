@@ -3,10 +3,12 @@
 
 #include <dash/GlobPtr.h>
 #include <dash/GlobRef.h>
+#include <dash/Onesided.h>
 
 #include <dash/list/internal/ListTypes.h>
 
 #include <iterator>
+#include <type_traits>
 
 
 namespace dash {
@@ -14,6 +16,9 @@ namespace dash {
 /**
  * Bi-directional global iterator on elements of a \c dash::List instance.
  *
+ * Global links between list nodes are updated in \c dash::List::barrier,
+ * the iterator traverses the list as of the last barrier.
+ *
  * \concept{DashListConcept}
  * \concept{DashGlobalIteratorConcept}
  */
@@ -47,7 +52,9 @@ public:
 
   typedef typename GlobMemType::local_pointer  local_pointer;
 
-  typedef internal::ListNode<value_type>           node_type;
+  typedef internal::ListNode<
+            typename std::remove_const<value_type>::type>
+    node_type;
 
 public:
   typedef std::integral_constant<bool, false>       has_view;
@@ -62,15 +69,35 @@ public:
    * Constructor, creates a global iterator on a \c dash::List instance.
    */
   GlobListIter(
+    /// Global memory of the list nodes.
     GlobMemType  * gmem,
-    node_type    & node)
+    /// Global pointer to the node at the iterator's position,
+    /// \c DART_GPTR_NULL for the end of the list.
+    dart_gptr_t    gnode,
+    /// Global pointer to the node preceding the iterator's position.
+    dart_gptr_t    gprev)
   : _globmem(gmem),
-    _node(&node),
-    _myid(dash::Team::GlobalUnitID())
+    _gnode(gnode),
+    _gprev(gprev)
   {
-    DASH_LOG_TRACE("GlobListIter(gmem,node,pat)");
+    DASH_LOG_TRACE("GlobListIter(gmem,gnode,gprev)", gnode);
   }
 
+  /**
+   * Conversion from an iterator on non-const elements.
+   */
+  template<
+    typename E_,
+    typename = typename std::enable_if<
+                 std::is_convertible<E_ *, ElementType *>::value
+               >::type >
+  GlobListIter(
+    const GlobListIter<E_, GlobMemType> & other)
+  : _globmem(const_cast<GlobMemType *>(&other.globmem())),
+    _gnode(other.dart_gptr()),
+    _gprev(other.dart_gptr_prev())
+  { }
+
   /**
    * Copy constructor.
    */
@@ -90,29 +117,36 @@ public:
    */
   operator pointer() const
   {
-    pointer ptr;
-    // TODO
-    return ptr;
+    return pointer(dart_gptr());
   }
 
   /**
-   * Dereference operator.
+   * Explicit conversion to \c dart_gptr_t.
    *
-   * \return  A global reference to the element at the iterator's position.
+   * \return  A DART global pointer to the element at the iterator's
+   *          position, the element is the first member of its list node
    */
-  reference operator*()
+  constexpr dart_gptr_t dart_gptr() const noexcept
   {
-    return reference(this);
+    return _gnode;
+  }
+
+  /**
+   * Global pointer to the node preceding the iterator's position.
+   */
+  constexpr dart_gptr_t dart_gptr_prev() const noexcept
+  {
+    return _gprev;
   }
 
   /**
    * Dereference operator.
    *
-   * \return  A global const reference to the element at the iterator's
-   *          position.
+   * \return  A global reference to the element at the iterator's position.
    */
-  const_reference operator*() const
+  reference operator*() const
   {
+    return reference(_gnode);
   }
 
   /**
@@ -196,7 +230,7 @@ public:
    */
   inline bool operator==(const self_t & other) const
   {
-    return _node == other._node;
+    return DART_GPTR_EQUAL(_gnode, other._gnode);
   }
 
   /**
@@ -204,26 +238,34 @@ public:
    */
   inline bool operator!=(const self_t & other) const
   {
-    return _node != other._node;
+    return !(*this == other);
   }
 
 private:
 
   void increment()
   {
+    node_type node;
+    dash::internal::get_blocking(_gnode, &node, 1);
+    _gprev = _gnode;
+    _gnode = node.gnext;
   }
 
   void decrement()
   {
+    node_type node;
+    dash::internal::get_blocking(_gprev, &node, 1);
+    _gnode = _gprev;
+    _gprev = node.gprev;
   }
 
 private:
   /// Global memory used to dereference iterated values.
   GlobMemType          * _globmem{};
-  /// The node element referenced at the iterator's position.
-  node_type            * _node     = nullptr;
-  /// Unit id of the active unit
-  team_unit_t            _myid;
+  /// The node referenced at the iterator's position.
+  dart_gptr_t            _gnode    = DART_GPTR_NULL;
+  /// The node preceding the iterator's position.
+  dart_gptr_t            _gprev    = DART_GPTR_NULL;
 
 }; // class GlobListIter
 
@@ -93,8 +93,7 @@ public:
    */
   inline void push_back(const value_type & value)
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.push_back is not implemented");
+    _list->push_back(value);
   }
 
   /**
@@ -103,8 +102,7 @@ public:
    */
   void pop_back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.pop_back is not implemented");
+    _list->pop_back();
   }
 
   /**
@@ -112,8 +110,7 @@ public:
    */
   reference back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.back is not implemented");
+    return _list->back();
   }
 
   /**
@@ -124,8 +121,7 @@ public:
    */
   inline void push_front(const value_type & value)
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.push_front is not implemented");
+    _list->push_front(value);
   }
 
   /**
@@ -134,8 +130,7 @@ public:
    */
   void pop_front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.pop_front is not implemented");
+    _list->pop_front();
   }
 
   /**
@@ -143,8 +138,7 @@ public:
    */
   reference front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.front is not implemented");
+    return _list->front();
   }
 
   inline Team              & team()             const noexcept;
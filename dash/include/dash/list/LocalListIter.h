@@ -0,0 +1,162 @@
+#ifndef DASH__LIST__LOCAL_LIST_ITER_H__INCLUDED
+#define DASH__LIST__LOCAL_LIST_ITER_H__INCLUDED
+
+#include <dash/Types.h>
+
+#include <dash/list/internal/ListTypes.h>
+
+#include <iterator>
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Bi-directional iterator on the elements of a \c dash::List instance
+ * that are local to the calling unit.
+ * Traverses local list nodes in their logical order.
+ *
+ * \concept{DashListConcept}
+ */
+template<
+  typename ElementType,
+  class    NodeType >
+class LocalListIter
+: public std::iterator<
+           std::bidirectional_iterator_tag,
+           ElementType,
+           dash::default_index_t,
+           ElementType *,
+           ElementType & >
+{
+private:
+  typedef LocalListIter<ElementType, NodeType> self_t;
+
+public:
+  typedef ElementType                             value_type;
+  typedef ElementType &                            reference;
+  typedef ElementType *                              pointer;
+
+  typedef NodeType                                 node_type;
+
+public:
+  /**
+   * Default constructor.
+   */
+  LocalListIter() = default;
+
+  /**
+   * Constructor, creates an iterator referencing the given list node.
+   */
+  explicit LocalListIter(
+    node_type * node)
+  : _node(node)
+  { }
+
+  /**
+   * Conversion from an iterator on non-const elements.
+   */
+  template<
+    typename E_,
+    typename = typename std::enable_if<
+                 std::is_convertible<E_ *, ElementType *>::value
+               >::type >
+  LocalListIter(
+    const LocalListIter<E_, NodeType> & other)
+  : _node(other.node())
+  { }
+
+  LocalListIter(const self_t & other)            = default;
+  self_t & operator=(const self_t & other)       = default;
+
+  /**
+   * Dereference operator.
+   *
+   * \return  A reference to the element at the iterator's position.
+   */
+  reference operator*() const
+  {
+    return _node->value;
+  }
+
+  /**
+   * Member access operator.
+   */
+  pointer operator->() const
+  {
+    return &(_node->value);
+  }
+
+  /**
+   * Prefix increment operator.
+   */
+  inline self_t & operator++()
+  {
+    _node = _node->lnext;
+    return *this;
+  }
+
+  /**
+   * Postfix increment operator.
+   */
+  inline self_t operator++(int)
+  {
+    self_t result = *this;
+    _node = _node->lnext;
+    return result;
+  }
+
+  /**
+   * Prefix decrement operator.
+   */
+  inline self_t & operator--()
+  {
+    _node = _node->lprev;
+    return *this;
+  }
+
+  /**
+   * Postfix decrement operator.
+   */
+  inline self_t operator--(int)
+  {
+    self_t result = *this;
+    _node = _node->lprev;
+    return result;
+  }
+
+  /**
+   * Equality comparison operator.
+   */
+  template<typename E_>
+  inline bool operator==(const LocalListIter<E_, NodeType> & other) const
+  {
+    return _node == other.node();
+  }
+
+  /**
+   * Inequality comparison operator.
+   */
+  template<typename E_>
+  inline bool operator!=(const LocalListIter<E_, NodeType> & other) const
+  {
+    return _node != other.node();
+  }
+
+  /**
+   * The list node referenced at the iterator's position.
+   */
+  constexpr node_type * node() const noexcept
+  {
+    return _node;
+  }
+
+private:
+  /// The list node referenced at the iterator's position.
+  node_type * _node = nullptr;
+
+}; // class LocalListIter
+
+} // namespace dash
+
+#endif // DASH__LIST__LOCAL_LIST_ITER_H__INCLUDED
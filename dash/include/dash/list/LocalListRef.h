@@ -3,6 +3,8 @@
 
 #include <iterator>
 #include <limits>
+#include <mutex>
+#include <utility>
 
 #include <dash/Types.h>
 #include <dash/GlobRef.h>
@@ -28,6 +30,14 @@ class List;
 /**
  * Proxy type representing a local view on a referenced \c dash::List.
  *
+ * Local updates take constant time and need no communication.
+ * Insertion, removal and splicing of elements may be called concurrently
+ * by threads of the unit, they are serialized by a lock of the list that
+ * is held for a constant number of node updates.
+ * Iterating the local list and accessing its elements is not synchronized
+ * with concurrent updates, \c try_pop_front and \c try_pop_back remove
+ * and return an element in a single synchronized operation.
+ *
  * \concept{DashListConcept}
  */
 template<
@@ -50,6 +60,8 @@ private:
 
   typedef typename list_type::node_type ListNode_t;
 
+  typedef typename list_type::local_lock_type local_lock_type;
+
   typedef typename list_type::glob_mem_type
     glob_mem_type;
 
@@ -94,21 +106,30 @@ public:
   { }
 
   /**
-   * Pointer to initial local element in the list.
+   * Iterator to initial local element in the list.
    */
   inline iterator begin() const noexcept
   {
-    return _list->_lbegin;
+    return _list->lbegin();
   }
 
   /**
-   * Pointer past final local element in the list.
+   * Iterator past final local element in the list.
    */
   inline iterator end() const noexcept
   {
-    return _list->_lend;
+    return _list->lend();
   }
 
+  /**
+   * Inserts a new element before the given position in the local list.
+   * The node of the new element is acquired from the local node pool which
+   * is only grown by the list's local buffer size if it is exhausted.
+   *
+   * Constant complexity.
+   *
+   * \return  Iterator to the inserted element.
+   */
   inline iterator insert(
     /// Position in the list where the new element is inserted.
     const_iterator     position,
@@ -116,18 +137,56 @@ public:
     const value_type & value)
   {
     DASH_LOG_TRACE("LocalListRef.insert()");
-    // New element node:
-    ListNode_t node;
-    node.lprev = nullptr;
-    node.lnext = nullptr;
-    node.gprev = _gprev;
-    node.gnext = _gnext;
-    iterator it_insert_end = _list->_end;
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.pop_back is not implemented");
-
-    DASH_LOG_TRACE("LocalListRef.insert >");
-    return it_insert_end;
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    return iterator(_list->_insert_local(position.node(), value));
+  }
+
+  /**
+   * Inserts the elements in the range \c [first, last) before the given
+   * position in the local list, growing the local node pool at most once
+   * for forward iterators.
+   *
+   * \return  Iterator to the first inserted element, or \c position if
+   *          no element has been inserted.
+   */
+  template <class InputIterator>
+  iterator insert(
+    /// Position in the list where the new elements are inserted.
+    const_iterator position,
+    /// Iterator to the first element to insert.
+    InputIterator  first,
+    /// Iterator past the last element to insert.
+    InputIterator  last)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _reserve(first, last,
+             typename std::iterator_traits<InputIterator>::iterator_category());
+    iterator it_first(position.node());
+    if (first != last) {
+      it_first = iterator(_list->_insert_local(position.node(), *first));
+      while (++first != last) {
+        _list->_insert_local(position.node(), *first);
+      }
+    }
+    return it_first;
+  }
+
+  /**
+   * Constructs a new element in place before the given position in the
+   * local list.
+   *
+   * Constant complexity.
+   *
+   * \return  Iterator to the inserted element.
+   */
+  template <class... Args>
+  inline iterator emplace(
+    /// Position in the list where the new element is inserted.
+    const_iterator   position,
+    /// Arguments forwarded to the constructor of the new element.
+    Args &&...       args)
+  {
+    return insert(position, value_type(std::forward<Args>(args)...));
   }
 
   /**
@@ -139,60 +198,8 @@ public:
   inline void push_back(const value_type & value)
   {
     DASH_LOG_TRACE("LocalListRef.push_back()");
-    // Pointer to new node element:
-    ListNode_t * node_lptr = nullptr;
-    // New element node:
-    ListNode_t   node;
-    node.value = value;
-    node.lprev = nullptr;
-    node.lnext = nullptr;
-    node.gprev = _gprev;
-    node.gnext = _gnext;
-    // Local capacity before operation:
-    auto l_cap_old  = _list->_globmem->local_size();
-    // Number of local elements before operation:
-    auto l_size_old = _list->_local_sizes.local[0];
-    // Update local size:
-    _list->_local_sizes.local[0]++;
-    // Number of local elements after operation:
-    auto l_size_new = _list->_local_sizes.local[0];
-
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", l_cap_old);
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", l_size_old);
-    if (l_size_new > l_cap_old) {
-      DASH_LOG_TRACE("LocalListRef.push_back",
-                     "globmem.grow(", _list->_local_buffer_size, ")");
-      // Acquire local memory for new node:
-      node_lptr = static_cast<ListNode_t *>(
-                    _list->_globmem->grow(_list->_local_buffer_size));
-      DASH_ASSERT_GT(_list->_globmem->local_size(), l_cap_old,
-                     "local capacity not increased after globmem.grow()");
-    } else {
-      // No allocation required (cast from LocalBucketIter<T> to T *):
-      node_lptr = static_cast<ListNode_t *>(
-                    _list->_globmem->lbegin() + l_size_old);
-    }
-    // Local capacity before operation:
-    auto l_cap_new = _list->_globmem->local_size();
-    DASH_LOG_TRACE("LocalListRef.push_back",
-                   "node target address:", node_lptr);
-    if (l_size_old > 0) {
-      // Set node predecessor (cast from LocalBucketIter<T> to T *):
-      node.lprev = static_cast<ListNode_t *>(
-                     _list->_globmem->lbegin() + (l_size_old - 1));
-      // Set successor of node predecessor to new node:
-      DASH_ASSERT(node.lprev->lnext == nullptr);
-      node.lprev->lnext = node_lptr;
-      DASH_LOG_TRACE_VAR("LocalListRef.push_back", node.lprev->lnext);
-    }
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", node.lprev);
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", node.value);
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", node.lnext);
-    // Copy new node to target address:
-    *node_lptr = node;
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", l_cap_new);
-    DASH_LOG_TRACE_VAR("LocalListRef.push_back", l_size_new);
-    DASH_LOG_TRACE("LocalListRef.push_back >");
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_insert_local(&(_list->_nil_node), value);
   }
 
   /**
@@ -201,8 +208,21 @@ public:
    */
   void pop_back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.pop_back is not implemented");
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_erase_local(_list->_nil_node.lprev);
+  }
+
+  /**
+   * Removes the last element in the list if the list is not empty.
+   *
+   * \return  True if an element has been removed and copied to \c value.
+   */
+  bool try_pop_back(
+    /// Value of the removed element.
+    value_type & value)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    return _list->_pop_local(_list->_nil_node.lprev, value);
   }
 
   /**
@@ -210,8 +230,8 @@ public:
    */
   reference back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef._back is not implemented");
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    return _list->_nil_node.lprev->value;
   }
 
   /**
@@ -222,8 +242,8 @@ public:
    */
   inline void push_front(const value_type & value)
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListLocalRef.push_front is not implemented");
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_insert_local(_list->_nil_node.lnext, value);
   }
 
   /**
@@ -232,8 +252,21 @@ public:
    */
   void pop_front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.pop_front is not implemented");
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_erase_local(_list->_nil_node.lnext);
+  }
+
+  /**
+   * Removes the first element in the list if the list is not empty.
+   *
+   * \return  True if an element has been removed and copied to \c value.
+   */
+  bool try_pop_front(
+    /// Value of the removed element.
+    value_type & value)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    return _list->_pop_local(_list->_nil_node.lnext, value);
   }
 
   /**
@@ -241,8 +274,95 @@ public:
    */
   reference front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.front is not implemented");
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    return _list->_nil_node.lnext->value;
+  }
+
+  /**
+   * Removes the element at the given position from the local list and
+   * returns its node to the local node pool.
+   *
+   * Constant complexity.
+   *
+   * \return  Iterator to the element that followed the removed element.
+   */
+  inline iterator erase(const_iterator position)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    return iterator(_list->_erase_local(position.node()));
+  }
+
+  /**
+   * Removes the elements in the range \c [first, last) from the local list.
+   *
+   * \return  Iterator to the element that followed the last removed
+   *          element.
+   */
+  iterator erase(const_iterator first, const_iterator last)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    iterator it(first.node());
+    while (it != last) {
+      it = iterator(_list->_erase_local(it.node()));
+    }
+    return it;
+  }
+
+  /**
+   * Removes all elements from the local list and returns their nodes to
+   * the local node pool.
+   *
+   * Constant complexity.
+   */
+  void clear()
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_clear_local();
+  }
+
+  /**
+   * Moves the element at position \c it before the given position in the
+   * local list.
+   * No elements are copied and no iterators are invalidated.
+   *
+   * Constant complexity.
+   */
+  void splice(
+    /// Position in the list where the element is moved to.
+    const_iterator position,
+    /// Position of the element to move.
+    const_iterator it)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_splice_local(position.node(), it.node(), it.node()->lnext);
+  }
+
+  /**
+   * Moves the elements in the range \c [first, last) before the given
+   * position in the local list.
+   * The position must not be in the range \c [first, last).
+   * No elements are copied and no iterators are invalidated.
+   *
+   * Constant complexity.
+   */
+  void splice(
+    /// Position in the list where the elements are moved to.
+    const_iterator position,
+    /// Iterator to the first element to move.
+    const_iterator first,
+    /// Iterator past the last element to move.
+    const_iterator last)
+  {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
+    _list->_splice_local(position.node(), first.node(), last.node());
+  }
+
+  /**
+   * Whether the local list is empty.
+   */
+  inline bool empty() const noexcept
+  {
+    return size() == 0;
   }
 
   /**
@@ -250,6 +370,7 @@ public:
    */
   inline size_type size() const noexcept
   {
+    std::lock_guard<local_lock_type> lock(_list->_llock);
     return _list->lsize();
   }
 
@@ -265,14 +386,28 @@ public:
     return true;
   }
 
+private:
+  template <class InputIterator>
+  void _reserve(
+    InputIterator first,
+    InputIterator last,
+    std::forward_iterator_tag)
+  {
+    _list->_reserve_nodes(std::distance(first, last));
+  }
+
+  template <class InputIterator>
+  void _reserve(
+    InputIterator,
+    InputIterator,
+    std::input_iterator_tag)
+  { }
+
 private:
   /// Pointer to list instance referenced by this view.
   list_type * const _list;
   /// The view's offset and extent within the referenced list.
   ViewSpec_t        _viewspec;
-
-  dart_gptr_t       _gprev{};
-  dart_gptr_t       _gnext{};
 };
 
 } // namespace dash
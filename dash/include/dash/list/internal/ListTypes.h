@@ -4,6 +4,9 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
 
+#include <atomic>
+#include <thread>
+
 namespace dash {
 namespace internal {
 
@@ -15,13 +18,51 @@ private:
 
 public:
   ElementType  value{};
-  //TODO: this should be a global node pointer
+  /// Neighbor nodes in the local list of the unit owning the node.
   self_t     * lprev = nullptr;
   self_t     * lnext = nullptr;
+  /// Neighbor nodes in the global list, updated in \c List::barrier.
   dart_gptr_t  gprev = DART_GPTR_NULL;
   dart_gptr_t  gnext = DART_GPTR_NULL;
 };
 
+/**
+ * Spin lock serializing updates of the local list of a unit between
+ * threads. It is held for a constant number of node link and node pool
+ * updates, so waiting threads spin instead of being suspended.
+ *
+ * Satisfies the \c Lockable concept and can be used with
+ * \c std::lock_guard.
+ */
+class ListLock
+{
+public:
+  ListLock() = default;
+
+  ListLock(const ListLock &)             = delete;
+  ListLock & operator=(const ListLock &) = delete;
+
+  void lock() noexcept
+  {
+    while (_locked.test_and_set(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+
+  bool try_lock() noexcept
+  {
+    return !_locked.test_and_set(std::memory_order_acquire);
+  }
+
+  void unlock() noexcept
+  {
+    _locked.clear(std::memory_order_release);
+  }
+
+private:
+  std::atomic_flag _locked = ATOMIC_FLAG_INIT;
+};
+
 } // namespace internal
 } // namespace dash
 
@@ -2,9 +2,25 @@
 #define DASH__MAP__HASH_POLICY_H__INCLUDED
 
 #include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
 
 namespace dash {
-template <typename Key>
+
+/**
+ * Hash policy mapping every key to the calling unit.
+ *
+ * Elements are stored at the unit that inserted them, so lookups of keys
+ * inserted by other units have to query all units.
+ * Keys are hashed with \c KeyHash in the local hash indices of the units.
+ */
+template <
+  typename Key,
+  typename KeyHash = std::hash<Key> >
 class HashLocal {
  private:
   typedef dash::default_size_t size_type;
@@ -12,6 +28,7 @@ class HashLocal {
  public:
   typedef Key argument_type;
   typedef team_unit_t result_type;
+  typedef KeyHash key_hasher;
 
  public:
   /**
@@ -41,6 +58,91 @@ class HashLocal {
   team_unit_t _myid;
 };  // class HashLocal
 
+/**
+ * Hash policy partitioning the key space: every key is mapped to an
+ * owning unit by its hash value.
+ *
+ * All units agree on the owner of a key, so lookups only have to query
+ * the owning unit.
+ */
+template <
+  typename Key,
+  typename KeyHash = std::hash<Key> >
+class HashGlobal {
+ private:
+  typedef dash::default_size_t size_type;
+
+ public:
+  typedef Key argument_type;
+  typedef team_unit_t result_type;
+  typedef KeyHash key_hasher;
+
+ public:
+  /**
+   * Default constructor.
+   */
+  HashGlobal()
+    : _nunits(0)
+  {
+  }
+
+  /**
+   * Constructor.
+   */
+  HashGlobal(dash::Team& team)
+    : _nunits(team.size())
+  {
+  }
+
+  result_type operator()(const argument_type& key) const
+  {
+    DASH_ASSERT_GT(_nunits, 0, "hash policy is not bound to a team");
+    // Scramble the hash value so the owner does not correlate with the
+    // slot of the key in the owner's local index which is derived from the
+    // hash value modulo a prime number:
+    uint64_t hash = static_cast<uint64_t>(_key_hash(key));
+    hash = (hash * 11400714819323198485llu) >> 17;
+    return result_type(static_cast<dart_unit_t>(hash % _nunits));
+  }
+
+ private:
+  size_type _nunits = 0;
+  KeyHash _key_hash;
+};  // class HashGlobal
+
+namespace detail {
+
+/**
+ * Type trait indicating whether a hash policy maps keys to the calling
+ * unit instead of a unique owning unit.
+ */
+template <typename Hash>
+struct is_local_hash : std::false_type {
+};
+
+template <typename Key, typename KeyHash>
+struct is_local_hash<dash::HashLocal<Key, KeyHash>> : std::true_type {
+};
+
+/**
+ * Type trait resolving the hash function of keys used in the local hash
+ * indices of a map, \c Hash::key_hasher if the hash policy defines it and
+ * \c std::hash<Key> otherwise.
+ */
+template <typename Hash, typename Key>
+struct key_hasher_of {
+ private:
+  template <typename H>
+  static typename H::key_hasher test(typename H::key_hasher *);
+  template <typename H>
+  static std::hash<Key> test(...);
+
+ public:
+  typedef decltype(test<Hash>(nullptr)) type;
+};
+
+}  // namespace detail
+
 namespace detail {
 
 struct HashNodeBase {
@@ -449,6 +551,14 @@ struct prime_number_hash_policy {
         return hash;
     }
   }
+  void commit(uint8_t new_prime_index)
+  {
+    prime_index = new_prime_index;
+  }
+  void reset()
+  {
+    prime_index = 0;
+  }
   uint8_t next_size_over(size_t& size) const
   {
     // prime numbers generated by the following method:
@@ -10,6 +10,7 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Future.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -19,6 +20,7 @@
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
 #include <dash/map/HashPolicy.h>
+#include <dash/map/UnorderedMapIndex.h>
 
 #include <iterator>
 #include <utility>
@@ -27,10 +29,39 @@
 #include <functional>
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
 
 
 namespace dash {
 
+/**
+ * Combine function for \c dash::UnorderedMap::insert_bulk, keeps the
+ * mapped value of the element inserted first.
+ */
+template <typename Mapped>
+struct keep_mapped {
+  const Mapped & operator()(
+    const Mapped & existing,
+    const Mapped & /* inserted */) const {
+    return existing;
+  }
+};
+
+/**
+ * Combine function for \c dash::UnorderedMap::insert_bulk, keeps the
+ * mapped value of the element inserted last.
+ */
+template <typename Mapped>
+struct overwrite_mapped {
+  const Mapped & operator()(
+    const Mapped & /* existing */,
+    const Mapped & inserted) const {
+    return inserted;
+  }
+};
+
 #ifndef DOXYGEN
 
 template <
@@ -138,6 +169,48 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  typedef typename detail::key_hasher_of<hasher, key_type>::type
+    key_hasher;
+  typedef detail::UnorderedMapIndex<
+            key_type, index_type, key_hasher, key_equal>
+    local_index_type;
+  typedef typename local_index_type::descriptor_type
+    index_descriptor;
+
+private:
+  /**
+   * State of an asynchronous lookup, insertion or access of a mapped
+   * value, shared by the future returned to the caller and the map.
+   */
+  struct async_request {
+    enum class kind_t  { find, insert, at };
+    enum class state_t { probe, value, done };
+
+    async_request(kind_t k, const key_type & key, const mapped_type & m)
+    : kind(k), key(key), mapped(m)
+    { }
+
+    kind_t        kind;
+    state_t       state        = state_t::probe;
+    key_type      key;
+    /// Mapped value to insert, or mapped value read.
+    mapped_type   mapped;
+    /// Unit holding the element, or the unit currently probed.
+    team_unit_t   unit{DART_UNDEFINED_UNIT_ID};
+    /// Next and last unit to probe.
+    int           next_unit    = 0;
+    int           last_unit    = 0;
+    /// Local offset of the element at its unit.
+    index_type    lidx         = local_index_type::npos;
+    /// Whether the element has been inserted by the request.
+    bool          inserted     = false;
+    /// Lookup in the hash index of a remote unit.
+    typename local_index_type::probe_type probe;
+    /// Handle of the transfer of a remote mapped value.
+    dart_handle_t value_handle = DART_HANDLE_NULL;
+  };
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -159,9 +232,19 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
+  /// Offsets of elements in local memory space that are marked for move
+  /// to their remote owning unit in next commit.
+  std::vector<index_type> _move_elements;
+  /// Hash index of the elements in local memory space.
+  std::unique_ptr<local_index_type> _local_index;
+  /// Descriptors of the hash indices of all units at the last commit.
+  std::vector<index_descriptor>     _index_descs;
+  /// Keys of elements at remote units to be erased in next commit, with
+  /// the unit holding the element.
+  std::vector<std::pair<team_unit_t, key_type>> _erase_keys;
+  /// Asynchronous operations started at the local unit that have not been
+  /// completed by flush().
+  std::vector<std::shared_ptr<async_request>> _async_requests;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
@@ -246,6 +329,9 @@ public:
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
     // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
+      flush();
+      _move_to_owners();
+      _erase_at_owners();
       _globmem->commit();
     }
     // Accumulate local sizes of remote units:
@@ -273,9 +359,79 @@ public:
                    "invalid size after global commit");
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
+    _lend  = _lbegin + lsize();
+    if (_local_index != nullptr) {
+      _publish_index();
+    }
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
+  /**
+   * Completes all asynchronous operations on the map started at the
+   * calling unit, the futures returned by \c find_async, \c at_async and
+   * \c insert_async are ready afterwards.
+   *
+   * The round trips of pending operations are overlapped.
+   * Called in \c barrier(), operations must not be pending across
+   * commits.
+   */
+  void flush()
+  {
+    DASH_LOG_TRACE("UnorderedMap.flush()",
+                   "requests:", _async_requests.size());
+    bool pending = true;
+    while (pending) {
+      pending = false;
+      for (auto & req : _async_requests) {
+        if (!_async_progress(*req, false)) {
+          pending = true;
+        }
+      }
+    }
+    _async_requests.clear();
+    DASH_LOG_TRACE("UnorderedMap.flush >");
+  }
+
+  /**
+   * Releases memory of erased elements.
+   *
+   * Commits all changes like \c barrier(), then reduces the local
+   * capacity of every unit to its number of elements and drops the
+   * tombstones of erased keys from the hash index.
+   * Iterators and references to elements are invalidated.
+   *
+   * Collective operation.
+   */
+  void compact()
+  {
+    DASH_LOG_TRACE("UnorderedMap.compact()");
+    barrier();
+    if (_globmem == nullptr) {
+      return;
+    }
+    // Buckets in global memory are attached collectively, every unit
+    // has to attach the same number of buckets, so a unit cannot release
+    // a bucket on its own. The local elements are moved to a new global
+    // memory space with one bucket per unit instead:
+    size_type lsize   = _local_sizes.local[0];
+    auto    * globmem = new glob_mem_type(
+                          std::max<size_type>(lsize, 1), *_team);
+    auto      l_dst   = globmem->lbegin();
+    for (size_type lidx = 0; lidx < lsize; ++lidx, ++l_dst) {
+      new (static_cast<value_type *>(l_dst)) value_type(*_local_value(lidx));
+    }
+    delete _globmem;
+    _globmem = globmem;
+    _local_index->compact();
+    _publish_index();
+    _begin   = iterator(this, 0);
+    _end     = iterator(this, size());
+    _lbegin  = local_iterator(this, 0);
+    _lend    = _lbegin + lsize;
+    DASH_LOG_TRACE("UnorderedMap.compact >",
+                   "local size:", lsize, "local capacity:", lcapacity());
+  }
+
   bool allocate(
     /// Initial global capacity of the container.
     size_type    nelem = 0,
@@ -317,6 +473,12 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Initialize hash index of local elements:
+    _local_index.reset(
+      new local_index_type(lcap, key_hasher(), _key_equal));
+    _index_descs = std::vector<index_descriptor>(
+                     _team->size(), _local_index->descriptor());
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -337,7 +499,7 @@ public:
     if (dash::is_initialized()) {
       DASH_LOG_TRACE("UnorderedMap.allocate",
                      "waiting for allocation of all units");
-      _team->barrier();
+      _publish_index();
     }
     DASH_LOG_TRACE("UnorderedMap.allocate >", "finished");
     return true;
@@ -361,6 +523,9 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    _local_index.reset();
+    _move_elements.clear();
+    _erase_keys.clear();
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
@@ -535,6 +700,32 @@ public:
     return mapped;
   }
 
+  /**
+   * Starts reading the mapped value of the element with the given key.
+   *
+   * The returned future is ready after \c flush(), its \c get() throws
+   * \c dash::exception::InvalidArgument if there is no such element.
+   *
+   * \see  find_async
+   */
+  dash::Future<mapped_type> at_async(const key_type & key)
+  {
+    DASH_LOG_TRACE("UnorderedMap.at_async()", "key:", key);
+    auto req = _async_start(async_request::kind_t::at, key, mapped_type());
+    return dash::Future<mapped_type>(
+      [this, req]() {
+        _async_wait(*req);
+        return _async_mapped(*req);
+      },
+      [this, req](mapped_type * mapped) {
+        if (!_async_progress(*req, false)) {
+          return false;
+        }
+        *mapped = _async_mapped(*req);
+        return true;
+      });
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Element Lookup
   //////////////////////////////////////////////////////////////////////////
@@ -550,14 +741,23 @@ public:
     return nelem;
   }
 
+  /**
+   * Iterator to the element with the given key, \c end() if there is no
+   * such element.
+   *
+   * Only queries the hash index of the unit owning the key, or of the
+   * calling unit if the key has been inserted at the calling unit but not
+   * committed yet.
+   * If the hash function maps keys to the calling unit (\c HashLocal),
+   * the indices of all units are queried.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    auto     lpos  = _find_lpos(key);
+    iterator found = (lpos.index == local_index_type::npos)
+                     ? _end
+                     : iterator(this, lpos.unit, lpos.index);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -565,15 +765,52 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = const_cast<self_t *>(this)->find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
 
+  /**
+   * Starts a lookup of the element with the given key, the returned
+   * future is ready after \c flush() and yields the iterator returned by
+   * \c find(key).
+   *
+   * Lookups in the hash indices of remote units are issued as
+   * non-blocking transfers, the round trips of many lookups started
+   * before \c flush() are overlapped.
+   * Keys found at the calling unit are resolved immediately.
+   *
+   * Example:
+   *
+   * \code
+   *   std::vector<dash::Future<map_t::iterator>> found;
+   *   for (auto key : keys) {
+   *     found.push_back(map.find_async(key));
+   *   }
+   *   map.flush();
+   *   for (auto & f : found) {
+   *     if (f.get() != map.end()) { ... }
+   *   }
+   * \endcode
+   */
+  dash::Future<iterator> find_async(const key_type & key)
+  {
+    DASH_LOG_TRACE_VAR("UnorderedMap.find_async()", key);
+    auto req = _async_start(async_request::kind_t::find, key, mapped_type());
+    return dash::Future<iterator>(
+      [this, req]() {
+        _async_wait(*req);
+        return _async_found(*req);
+      },
+      [this, req](iterator * found) {
+        if (!_async_progress(*req, false)) {
+          return false;
+        }
+        *found = _async_found(*req);
+        return true;
+      });
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
@@ -612,55 +849,44 @@ public:
     return result;
   }
 
+  /**
+   * Starts inserting an element, the returned future is ready after
+   * \c flush() and yields the result of \c insert(value).
+   *
+   * The element is stored at the calling unit once the lookup of its key
+   * completed and there is no element with the same key.
+   *
+   * \see  find_async
+   */
+  dash::Future<std::pair<iterator, bool>> insert_async(
+    /// The element to insert.
+    const value_type & value)
+  {
+    DASH_LOG_TRACE("UnorderedMap.insert_async()", "key:", value.first);
+    auto req = _async_start(
+                 async_request::kind_t::insert, value.first, value.second);
+    return dash::Future<std::pair<iterator, bool>>(
+      [this, req]() {
+        _async_wait(*req);
+        return std::make_pair(_async_found(*req), req->inserted);
+      },
+      [this, req](std::pair<iterator, bool> * result) {
+        if (!_async_progress(*req, false)) {
+          return false;
+        }
+        *result = std::make_pair(_async_found(*req), req->inserted);
+        return true;
+      });
+  }
+
   iterator insert(
     const_iterator hint,
     const value_type & value)
   {
-    auto key = value.first;
-    auto mapped = value.second;
-
-    DASH_ASSERT(_globmem != nullptr);
-    DASH_LOG_DEBUG("UnorderedMap.insert()", "key:", key, "mapped:", mapped);
-
-    auto unit = _key_hash(key);
-
-    iterator found = _end;
-
-    if (_myid == unit) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "local element key lookup");
-
-      auto lbegin = static_cast<value_type *>(_lbegin);
-      auto lend = static_cast<value_type *>(_lend);
-      const_local_iterator liter = std::find_if(
-                  _lbegin, _lend,
-                   [&](const value_type & v) {
-                     return _key_equal(v.first, key);
-                   });
-
-      if (liter != _lend) {
-        found = iterator(this, _myid, liter.pos());
-      }
-
-    } else  {
-      DASH_LOG_TRACE("UnorderedMap.insert", "element key lookup");
-      iterator found = find(key);
-    }
-    DASH_LOG_TRACE_VAR("UnorderedMap.insert", found);
-
-    iterator res;
-    if (found != _end) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "key found");
-      // Existing element found, no insertion:
-      res = found;
-    } else {
-      DASH_LOG_TRACE("UnorderedMap.insert", "key not found");
-      // Unit mapped to the new element's key by the hash function:
-      DASH_LOG_TRACE("UnorderedMap.insert", "target unit:", unit);
-      // No element with specified key exists, insert new value.
-      auto result = _insert_at(unit, value);
-      res = result.first;
-    }
-
+    DASH_LOG_DEBUG("UnorderedMap.insert()", "key:", value.first);
+    // Lookups are resolved by the hash index, the hint is not needed:
+    auto res = insert(value).first;
+    DASH_LOG_DEBUG("UnorderedMap.insert >", res);
     return res;
   }
 
@@ -671,41 +897,153 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    // New elements are stored in local memory until the next commit,
+    // allocate memory for all of them in a single call of globmem.grow:
+    _reserve_local(first, last,
+                   typename std::iterator_traits<InputIterator>
+                              ::iterator_category());
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Inserts the elements in the local range \c [first, last) of every
+   * unit.
+   *
+   * Elements are sent to the units owning their keys in a single
+   * all-to-all exchange and every unit allocates memory for the elements
+   * it receives in a single allocation.
+   * If the map already contains an element with the key of an inserted
+   * element, or an element with the same key has been inserted before,
+   * its mapped value is replaced by \c combine(existing, inserted).
+   * Inserted elements are combined in the order of the units inserting
+   * them and their order in the units' ranges.
+   * If the hash function maps keys to the calling unit (\c HashLocal),
+   * elements are sent to the unit already holding their key, or to a
+   * unit determined by the hash of the key if no unit holds it.
+   *
+   * Collective operation, commits all changes like \c barrier().
+   *
+   * Example:
+   *
+   * \code
+   *   // Count occurrences of words:
+   *   std::vector<std::pair<const word_t, int>> l_words = ...;
+   *   map.insert_bulk(l_words.begin(), l_words.end(), dash::plus<int>());
+   * \endcode
+   *
+   * \see dash::keep_mapped
+   * \see dash::overwrite_mapped
+   */
+  template<
+    class InputIterator,
+    class BinaryFunction = dash::keep_mapped<mapped_type> >
+  void insert_bulk(
+    // Iterator at first value in the local range to insert.
+    InputIterator  first,
+    // Iterator past the last value in the local range to insert.
+    InputIterator  last,
+    // Combines mapped values of elements with identical keys.
+    BinaryFunction combine = BinaryFunction())
+  {
+    DASH_LOG_DEBUG("UnorderedMap.insert_bulk()");
+    DASH_ASSERT(_globmem != nullptr);
+    std::vector<value_type> values(first, last);
+    auto recvbuf = detail::is_local_hash<hasher>::value
+                   ? _exchange_to_holders(values)
+                   : _exchange(
+                       values.size(),
+                       [&](size_type i) { return &values[i]; });
+    _merge_local(
+      recvbuf,
+      [&](value_type & existing, const value_type & inserted) {
+        existing.second = combine(existing.second, inserted.second);
+      });
+    barrier();
+    DASH_LOG_DEBUG("UnorderedMap.insert_bulk >", "size:", size());
+  }
+
+  /**
+   * Removes the element at the given position.
+   *
+   * \returns  Iterator at the position of the removed element.
+   *
+   * \see  erase(const key_type &)
+   */
   iterator erase(
     const_iterator position)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase()", "position:", position);
+    auto lpos = position.lpos();
+    if (lpos.unit == _myid) {
+      _erase_local(lpos.index);
+    } else {
+      value_type value = *position;
+      _erase_keys.push_back(std::make_pair(lpos.unit, value.first));
+    }
+    iterator res(this, position.pos());
+    DASH_LOG_DEBUG("UnorderedMap.erase >", res);
+    return res;
   }
 
+  /**
+   * Removes the element with the given key.
+   *
+   * Elements in the local memory space of the calling unit are removed
+   * immediately: the last local element takes the place of the removed
+   * element and the key is marked as erased in the hash index.
+   * Elements at remote units are removed by their unit in the next
+   * commit.
+   * Memory of removed elements is released in \c compact().
+   *
+   * \returns  The number of elements removed, 0 or 1.
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase()", "key:", key);
+    size_type nerased = 0;
+    auto      lpos    = _find_lpos(key);
+    if (lpos.index != local_index_type::npos) {
+      if (lpos.unit == _myid) {
+        _erase_local(lpos.index);
+      } else {
+        _erase_keys.push_back(std::make_pair(lpos.unit, key));
+      }
+      nerased = 1;
+    }
+    DASH_LOG_DEBUG("UnorderedMap.erase >", nerased);
+    return nerased;
   }
 
+  /**
+   * Removes the elements in the range \c [first, last).
+   *
+   * \returns  Iterator at the position of the first removed element.
+   *
+   * \see  erase(const key_type &)
+   */
   iterator erase(
     /// Iterator at first element to remove.
     const_iterator first,
     /// Iterator past the last element to remove.
     const_iterator last)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase(first,last)");
+    // Positions of elements change when local elements are removed:
+    std::vector<key_type> keys;
+    for (auto it = first; it != last; ++it) {
+      value_type value = *it;
+      keys.push_back(value.first);
+    }
+    for (auto & key : keys) {
+      erase(key);
+    }
+    iterator res(this, first.pos());
+    DASH_LOG_DEBUG("UnorderedMap.erase(first,last) >", res);
+    return res;
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -801,6 +1139,582 @@ private:
                    "lptr to mapped:", lptr_mapped);
   }
 
+  /**
+   * Native pointer to the element at the given offset in local memory
+   * space.
+   */
+  value_type * _local_value(index_type lidx)
+  {
+    return static_cast<value_type *>(_globmem->lbegin() + lidx);
+  }
+
+  /**
+   * Unit and local offset of the element with the given key, local offset
+   * is \c npos if there is no such element.
+   */
+  typename iterator::local_index _find_lpos(const key_type & key)
+  {
+    typename iterator::local_index lpos;
+    lpos.unit  = _myid;
+    lpos.index = local_index_type::npos;
+    if (_local_index == nullptr) {
+      return lpos;
+    }
+    auto unit = _key_hash(key);
+    // Elements owned by the local unit and elements inserted at the local
+    // unit that have not been moved to their owner yet:
+    if (unit == _myid || !_move_elements.empty()) {
+      lpos.index = _local_index->find(key);
+      if (lpos.index != local_index_type::npos) {
+        return lpos;
+      }
+    }
+    if (!detail::is_local_hash<hasher>::value) {
+      if (unit != _myid) {
+        lpos.unit  = unit;
+        lpos.index = _find_at(unit, key);
+      }
+      return lpos;
+    }
+    // Hash function does not determine an owner, query all units:
+    for (size_type u = 0; u < _team->size(); ++u) {
+      if (team_unit_t(u) != _myid) {
+        lpos.unit  = team_unit_t(u);
+        lpos.index = _find_at(lpos.unit, key);
+        if (lpos.index != local_index_type::npos) {
+          break;
+        }
+      }
+    }
+    return lpos;
+  }
+
+  /**
+   * Local offset of the element with the given key in the hash index of
+   * a remote unit at the last commit, \c npos if there is no such element.
+   */
+  index_type _find_at(team_unit_t unit, const key_type & key) const
+  {
+    auto lidx = local_index_type::find(
+                  _index_descs[unit.id], key, key_hasher(), _key_equal);
+    lidx = _committed_at(unit, lidx);
+    DASH_LOG_TRACE("UnorderedMap._find_at >",
+                   "unit:", unit, "key:", key, "lidx:", lidx);
+    return lidx;
+  }
+
+  /**
+   * The given local offset of an element at a remote unit if the element
+   * has been committed, \c npos otherwise.
+   */
+  index_type _committed_at(team_unit_t unit, index_type lidx) const
+  {
+    // Elements inserted at the remote unit since the last commit are not
+    // accessible yet:
+    size_type lsize_unit = _local_cumul_sizes[unit.id];
+    if (unit.id > 0) {
+      lsize_unit -= _local_cumul_sizes[unit.id - 1];
+    }
+    if (lidx != local_index_type::npos &&
+        static_cast<size_type>(lidx) >= lsize_unit) {
+      return local_index_type::npos;
+    }
+    return lidx;
+  }
+
+  /**
+   * Creates the state of an asynchronous operation on the element with
+   * the given key and starts the lookup of the key.
+   */
+  std::shared_ptr<async_request> _async_start(
+    typename async_request::kind_t kind,
+    const key_type               & key,
+    const mapped_type            & mapped)
+  {
+    DASH_ASSERT(_globmem != nullptr);
+    auto req  = std::make_shared<async_request>(kind, key, mapped);
+    auto unit = _key_hash(key);
+    req->unit = _myid;
+    // Elements owned by the local unit and elements inserted at the local
+    // unit that have not been moved to their owner yet:
+    if (unit == _myid || !_move_elements.empty()) {
+      req->lidx = _local_index->find(key);
+    }
+    if (req->lidx == local_index_type::npos) {
+      if (detail::is_local_hash<hasher>::value) {
+        // Hash function does not determine an owner, probe all units:
+        req->next_unit = 0;
+        req->last_unit = _team->size();
+      } else {
+        req->next_unit = unit.id;
+        req->last_unit = unit.id + 1;
+      }
+      if (_async_probe_next(*req)) {
+        _async_requests.push_back(req);
+        return req;
+      }
+    }
+    _async_resolved(*req);
+    return req;
+  }
+
+  /**
+   * Starts the lookup of a request's key at the next remote unit, returns
+   * \c false if there is no unit left to probe.
+   */
+  bool _async_probe_next(async_request & req)
+  {
+    while (req.next_unit < req.last_unit) {
+      team_unit_t unit(req.next_unit++);
+      if (unit == _myid) {
+        continue;
+      }
+      req.unit = unit;
+      if (local_index_type::probe_start(
+            _index_descs[unit.id], req.key, key_hasher(),
+            req.probe)) {
+        return true;
+      }
+    }
+    req.unit = _myid;
+    return false;
+  }
+
+  /**
+   * Advances an asynchronous operation, returns \c true if the operation
+   * has completed.
+   * If \c blocking is set, waits for pending transfers to complete.
+   */
+  bool _async_progress(async_request & req, bool blocking)
+  {
+    typedef typename async_request::state_t state_t;
+    while (req.state != state_t::done) {
+      dart_handle_t & handle = (req.state == state_t::probe)
+                               ? req.probe.handle()
+                               : req.value_handle;
+      if (blocking) {
+        DASH_ASSERT_RETURNS(dart_wait_local(&handle), DART_OK);
+      } else {
+        int32_t flag = 0;
+        DASH_ASSERT_RETURNS(dart_test_local(&handle, &flag), DART_OK);
+        if (!flag) {
+          return false;
+        }
+      }
+      if (req.state == state_t::value) {
+        req.state = state_t::done;
+        break;
+      }
+      if (!local_index_type::probe_complete(
+             _index_descs[req.unit.id], req.key, _key_equal, req.probe,
+             req.lidx)) {
+        // Next window of index slots requested:
+        continue;
+      }
+      req.lidx = _committed_at(req.unit, req.lidx);
+      if (req.lidx == local_index_type::npos && _async_probe_next(req)) {
+        continue;
+      }
+      _async_resolved(req);
+    }
+    return true;
+  }
+
+  /**
+   * Completes an asynchronous operation once the lookup of its key has
+   * been resolved.
+   */
+  void _async_resolved(async_request & req)
+  {
+    typedef typename async_request::kind_t  kind_t;
+    typedef typename async_request::state_t state_t;
+    req.state = state_t::done;
+    if (req.kind == kind_t::insert && req.lidx == local_index_type::npos) {
+      // The key might have been inserted since the lookup started:
+      req.unit = _myid;
+      req.lidx = _local_index->find(req.key);
+      if (req.lidx == local_index_type::npos) {
+        auto res     = _insert_at(_key_hash(req.key),
+                                  value_type(req.key, req.mapped));
+        req.lidx     = res.first.lpos().index;
+        req.inserted = true;
+      }
+    } else if (req.kind == kind_t::at &&
+               req.lidx != local_index_type::npos) {
+      if (req.unit == _myid) {
+        req.mapped = _local_value(req.lidx)->second;
+        return;
+      }
+      dart_gptr_t   gptr_mapped = iterator(this, req.unit, req.lidx)
+                                    .dart_gptr();
+      mapped_type * lptr_mapped = nullptr;
+      _lptr_value_to_mapped(nullptr, gptr_mapped, lptr_mapped);
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          &req.mapped, gptr_mapped, sizeof(mapped_type),
+          DART_TYPE_BYTE, DART_TYPE_BYTE, &req.value_handle),
+        DART_OK);
+      req.state = state_t::value;
+    }
+  }
+
+  /**
+   * Waits for the completion of an asynchronous operation.
+   */
+  void _async_wait(async_request & req)
+  {
+    _async_progress(req, true);
+  }
+
+  /**
+   * Iterator to the element resolved by an asynchronous operation.
+   */
+  iterator _async_found(const async_request & req)
+  {
+    return (req.lidx == local_index_type::npos)
+           ? _end
+           : iterator(this, req.unit, req.lidx);
+  }
+
+  /**
+   * Mapped value read by an asynchronous operation.
+   */
+  mapped_type _async_mapped(const async_request & req) const
+  {
+    if (req.lidx == local_index_type::npos) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "No element in map for key " << req.key);
+    }
+    return req.mapped;
+  }
+
+  /**
+   * Moves elements inserted at the local unit to their owning units and
+   * adds elements received from remote units to local memory space.
+   * Elements with a key that already exists at the owning unit are
+   * discarded.
+   *
+   * Collective operation.
+   */
+  void _move_to_owners()
+  {
+    if (detail::is_local_hash<hasher>::value || _team->size() < 2) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMap._move_to_owners()",
+                   "elements to move:", _move_elements.size());
+    auto recvbuf = _exchange(
+                     _move_elements.size(),
+                     [&](size_type m) {
+                       return _local_value(_move_elements[m]);
+                     });
+    if (!_move_elements.empty()) {
+      // Remove moved elements from local memory space:
+      size_type         lsize = _local_sizes.local[0];
+      std::vector<bool> moved(lsize, false);
+      for (auto lidx : _move_elements) {
+        moved[lidx] = true;
+      }
+      size_type nkeep = 0;
+      auto      l_src = _globmem->lbegin();
+      auto      l_dst = l_src;
+      for (size_type lidx = 0; lidx < lsize; ++lidx, ++l_src) {
+        if (!moved[lidx]) {
+          if (nkeep != lidx) {
+            new (static_cast<value_type *>(l_dst))
+              value_type(*static_cast<value_type *>(l_src));
+          }
+          ++nkeep;
+          ++l_dst;
+        }
+      }
+      _local_sizes.local[0] = nkeep;
+      _move_elements.clear();
+      // Local offsets of elements changed:
+      _local_index->clear();
+      l_src = _globmem->lbegin();
+      for (size_type lidx = 0; lidx < nkeep; ++lidx, ++l_src) {
+        _local_index->insert(static_cast<value_type *>(l_src)->first, lidx);
+      }
+    }
+    _merge_local(recvbuf, [](value_type &, const value_type &) { });
+    DASH_LOG_TRACE("UnorderedMap._move_to_owners >",
+                   "local size:", _local_sizes.local[0]);
+  }
+
+  /**
+   * Removes elements erased at remote units from local memory space.
+   *
+   * Collective operation.
+   */
+  void _erase_at_owners()
+  {
+    if (_team->size() < 2) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMap._erase_at_owners()",
+                   "keys to erase:", _erase_keys.size());
+    auto recvbuf = _exchange<key_type>(
+                     _erase_keys.size(),
+                     [&](size_type e) { return &_erase_keys[e].second; },
+                     [&](size_type e) { return _erase_keys[e].first; });
+    _erase_keys.clear();
+    size_type nkeys = recvbuf.size() / sizeof(key_type);
+    for (size_type k = 0; k < nkeys; ++k) {
+      auto * key  = reinterpret_cast<const key_type *>(
+                      recvbuf.data() + k * sizeof(key_type));
+      auto   lidx = _local_index->find(*key);
+      // Elements might have been erased by multiple units:
+      if (lidx != local_index_type::npos) {
+        _erase_local(lidx);
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap._erase_at_owners >",
+                   "local size:", _local_sizes.local[0]);
+  }
+
+  /**
+   * Removes the element at the given offset from local memory space,
+   * the last local element is moved to the offset.
+   */
+  void _erase_local(index_type lidx)
+  {
+    size_type    llast  = _local_sizes.local[0] - 1;
+    value_type * erased = _local_value(lidx);
+    DASH_LOG_TRACE("UnorderedMap._erase_local()",
+                   "lidx:", lidx, "key:", erased->first);
+    _local_index->erase(erased->first);
+    _move_elements.erase(
+      std::remove(_move_elements.begin(), _move_elements.end(), lidx),
+      _move_elements.end());
+    if (static_cast<size_type>(lidx) != llast) {
+      value_type * moved = _local_value(llast);
+      new (erased) value_type(*moved);
+      _local_index->update(moved->first, lidx);
+      std::replace(_move_elements.begin(), _move_elements.end(),
+                   static_cast<index_type>(llast), lidx);
+    }
+    _local_sizes.local[0] = llast;
+    for (size_type u = _myid.id; u < _team->size(); ++u) {
+      _local_cumul_sizes[u] -= 1;
+    }
+    _lend = _lbegin + llast;
+    _end  = iterator(this, size());
+  }
+
+  /**
+   * Sends values to the units owning their keys in a single all-to-all
+   * exchange, returns the values received from all units ordered by
+   * their source unit.
+   *
+   * Collective operation.
+   */
+  template <class ValueAt>
+  std::vector<char> _exchange(
+    /// Number of values to send.
+    size_type nvalues,
+    /// Returns a pointer to the value at the given offset.
+    ValueAt   value_at)
+  {
+    return _exchange<value_type>(
+             nvalues, value_at,
+             [&](size_type i) { return _key_hash(value_at(i)->first); });
+  }
+
+  /**
+   * Sends values of type \c T to the specified units in a single
+   * all-to-all exchange, returns the values received from all units
+   * ordered by their source unit.
+   *
+   * Collective operation.
+   */
+  template <class T, class ValueAt, class OwnerOf>
+  std::vector<char> _exchange(
+    /// Number of values to send.
+    size_type nvalues,
+    /// Returns a pointer to the value at the given offset.
+    ValueAt   value_at,
+    /// Returns the unit to send the value at the given offset to.
+    OwnerOf   owner_of)
+  {
+    auto nunits = _team->size();
+    constexpr size_type elem_bytes = sizeof(T);
+
+    // Pack values in the order of their owning units:
+    std::vector<size_type>   nsend(nunits, 0);
+    std::vector<size_type>   nrecv(nunits, 0);
+    std::vector<size_type>   sdispls(nunits, 0);
+    std::vector<size_type>   rdispls(nunits, 0);
+    std::vector<team_unit_t> owners;
+    owners.reserve(nvalues);
+    for (size_type i = 0; i < nvalues; ++i) {
+      owners.push_back(owner_of(i));
+      nsend[owners.back().id] += elem_bytes;
+    }
+    for (size_type u = 1; u < nunits; ++u) {
+      sdispls[u] = sdispls[u - 1] + nsend[u - 1];
+    }
+    std::vector<char> sendbuf(nvalues * elem_bytes);
+    {
+      auto offsets = sdispls;
+      for (size_type i = 0; i < nvalues; ++i) {
+        std::memcpy(sendbuf.data() + offsets[owners[i].id],
+                    value_at(i), elem_bytes);
+        offsets[owners[i].id] += elem_bytes;
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(nsend.data(), nrecv.data(), 1,
+                    dash::dart_datatype<size_type>::value,
+                    _team->dart_id()),
+      DART_OK);
+    for (size_type u = 1; u < nunits; ++u) {
+      rdispls[u] = rdispls[u - 1] + nrecv[u - 1];
+    }
+    std::vector<char> recvbuf(rdispls[nunits - 1] + nrecv[nunits - 1]);
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(sendbuf.data(), nsend.data(), sdispls.data(),
+                     recvbuf.data(), nrecv.data(), rdispls.data(),
+                     DART_TYPE_BYTE, _team->dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE("UnorderedMap._exchange >",
+                   "sent:",     nvalues,
+                   "received:", recvbuf.size() / elem_bytes);
+    return recvbuf;
+  }
+
+  /**
+   * Sends values to the units holding an element with their key if the
+   * hash function does not determine an owner. Values with identical keys
+   * are collected at a unit determined by the hash of their key first,
+   * which looks up the unit holding the key and keeps values with keys
+   * not contained in the map. Returns the values received from all units
+   * ordered by their source unit.
+   *
+   * Collective operation, commits all changes like \c barrier().
+   */
+  std::vector<char> _exchange_to_holders(
+    const std::vector<value_type> & values)
+  {
+    auto nunits = _team->size();
+    if (nunits < 2) {
+      return _exchange(
+               values.size(),
+               [&](size_type i) { return &values[i]; });
+    }
+    // Keys inserted at other units are only visible after a commit:
+    barrier();
+    auto collected = _exchange<value_type>(
+                       values.size(),
+                       [&](size_type i) { return &values[i]; },
+                       [&](size_type i) {
+                         return team_unit_t(
+                           key_hasher()(values[i].first) % nunits);
+                       });
+    size_type ncollected = collected.size() / sizeof(value_type);
+    auto collected_at = [&](size_type i) {
+      return reinterpret_cast<const value_type *>(
+               collected.data() + i * sizeof(value_type));
+    };
+    std::unordered_map<key_type, team_unit_t, key_hasher, key_equal>
+      holders(ncollected, key_hasher(), _key_equal);
+    std::vector<team_unit_t> targets;
+    targets.reserve(ncollected);
+    for (size_type i = 0; i < ncollected; ++i) {
+      const key_type & key    = collected_at(i)->first;
+      auto             holder = holders.find(key);
+      if (holder == holders.end()) {
+        auto lpos = _find_lpos(key);
+        holder    = holders.emplace(
+                      key,
+                      lpos.index == local_index_type::npos
+                      ? _myid : lpos.unit).first;
+      }
+      targets.push_back(holder->second);
+    }
+    return _exchange<value_type>(
+             ncollected, collected_at,
+             [&](size_type i) { return targets[i]; });
+  }
+
+  /**
+   * Adds values received in \c _exchange to local memory space, growing
+   * local memory at most once.
+   * For values with a key that already exists in local memory space,
+   * \c on_duplicate(existing, value) is called instead.
+   */
+  template <class DuplicateFunction>
+  void _merge_local(
+    const std::vector<char> & values,
+    DuplicateFunction         on_duplicate)
+  {
+    size_type nvalues = values.size() / sizeof(value_type);
+    if (nvalues == 0) {
+      return;
+    }
+    size_type lsize = _local_sizes.local[0];
+    size_type lcap  = _globmem->local_size();
+    if (lsize + nvalues > lcap) {
+      _globmem->grow(std::max(lsize + nvalues - lcap, _local_buffer_size));
+    }
+    _local_index->rehash(lsize + nvalues);
+    for (size_type i = 0; i < nvalues; ++i) {
+      auto * value = reinterpret_cast<const value_type *>(
+                       values.data() + i * sizeof(value_type));
+      auto   lidx  = _local_index->find(value->first);
+      if (lidx == local_index_type::npos) {
+        new (_local_value(lsize)) value_type(*value);
+        _local_index->insert(value->first, lsize);
+        ++lsize;
+      } else {
+        on_duplicate(*_local_value(lidx), *value);
+      }
+    }
+    _local_sizes.local[0] = lsize;
+  }
+
+  /**
+   * Allocates local memory and index capacity for the elements in the
+   * range \c [first, last).
+   */
+  template <class InputIterator>
+  void _reserve_local(
+    InputIterator first,
+    InputIterator last,
+    std::forward_iterator_tag)
+  {
+    size_type nvalues = std::distance(first, last);
+    size_type lsize   = _local_sizes.local[0];
+    size_type lcap    = _globmem->local_size();
+    if (lsize + nvalues > lcap) {
+      _globmem->grow(std::max(lsize + nvalues - lcap, _local_buffer_size));
+    }
+    _local_index->rehash(lsize + nvalues);
+  }
+
+  template <class InputIterator>
+  void _reserve_local(
+    InputIterator,
+    InputIterator,
+    std::input_iterator_tag)
+  { }
+
+  /**
+   * Exchanges the descriptors of the hash indices of all units.
+   *
+   * Collective operation.
+   */
+  void _publish_index()
+  {
+    auto desc = _local_index->descriptor();
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&desc, _index_descs.data(), sizeof(index_descriptor),
+                     DART_TYPE_BYTE, _team->dart_id()),
+      DART_OK);
+    _local_index->publish();
+  }
+
   /**
    * Insert value at specified unit.
    */
@@ -823,7 +1737,12 @@ private:
 
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    // The element is stored in local memory until it is moved to its
+    // owning unit in the next commit, shift global positions of elements
+    // of subsequent units:
+    for (size_type u = _myid.id; u < _team->size(); ++u) {
+      _local_cumul_sizes[u] += 1;
+    }
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -849,19 +1768,19 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
+    _local_index->insert(value.first, old_local_size);
     // Convert local iterator to global iterator:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
 
     if (unit != _myid) {
       DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
       // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
-    } else {
-      ++_lend;
+      _move_elements.push_back(old_local_size);
     }
+    ++_lend;
 
     // Update iterators as global memory space has been changed for the
     // active unit:
@@ -0,0 +1,485 @@
+#ifndef DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
+#define DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/Init.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/map/HashPolicy.h>
+
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// Number of index slots fetched in a single remote probe
+#define DASH__MAP__INDEX_PROBE_WINDOW 8
+
+namespace dash {
+namespace detail {
+
+/**
+ * Open-addressing hash index over the elements in a unit's local memory
+ * space of a \c dash::UnorderedMap, mapping keys to local element offsets.
+ *
+ * Slots are allocated in global memory so the index can be probed by
+ * remote units: the descriptor of a unit's index is exchanged in
+ * collective operations and a remote lookup fetches a window of
+ * \c DASH__MAP__INDEX_PROBE_WINDOW slots per round trip. Remote lookups
+ * can be started asynchronously to overlap the round trips of many
+ * lookups, see \c probe_start.
+ * Collisions are resolved by linear probing, the load factor is kept at
+ * or below 1/2 so lookups usually complete in a single probe.
+ * Slots of erased keys are marked as tombstones that are skipped by
+ * lookups and dropped when the index is rehashed or compacted.
+ *
+ * Memory of an index that has been replaced on rehash stays allocated
+ * until the next call of \c publish() as remote units might still probe
+ * it.
+ */
+template <
+  typename Key,
+  typename IndexType,
+  typename KeyHash,
+  typename KeyEqual >
+class UnorderedMapIndex
+{
+private:
+  typedef UnorderedMapIndex<Key, IndexType, KeyHash, KeyEqual> self_t;
+
+  struct slot_type {
+    Key       key;
+    IndexType lidx;
+  };
+
+public:
+  typedef Key                  key_type;
+  typedef IndexType            index_type;
+  typedef dash::default_size_t size_type;
+
+  /**
+   * Location and size of a unit's index in global memory.
+   */
+  struct descriptor_type {
+    dart_gptr_t gptr;
+    uint64_t    nslots;
+    uint8_t     prime_index;
+  };
+
+  /// Offset returned by lookups of keys that are not in the index.
+  static constexpr index_type npos      = -1;
+  /// Offset in slots of erased keys.
+  static constexpr index_type tombstone = -2;
+
+public:
+  UnorderedMapIndex(
+    size_type        capacity  = 0,
+    const KeyHash  & key_hash  = KeyHash(),
+    const KeyEqual & key_equal = KeyEqual())
+  : _key_hash(key_hash),
+    _key_equal(key_equal)
+  {
+    rehash(capacity);
+  }
+
+  ~UnorderedMapIndex()
+  {
+    if (dash::is_initialized()) {
+      if (!DART_GPTR_EQUAL(_gptr_published, _gptr)) {
+        _free(_gptr_published);
+      }
+      _free(_gptr);
+    }
+  }
+
+  UnorderedMapIndex(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)           = delete;
+
+  /**
+   * Number of keys in the index.
+   */
+  inline size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  /**
+   * Descriptor of the index to be exchanged with remote units.
+   */
+  descriptor_type descriptor() const noexcept
+  {
+    descriptor_type desc;
+    desc.gptr        = _gptr;
+    desc.nslots      = _nslots;
+    desc.prime_index = _prime_index;
+    return desc;
+  }
+
+  /**
+   * Local offset of the element with the given key, \c npos if the key
+   * is not in the index.
+   */
+  index_type find(const key_type & key) const
+  {
+    auto s = _find_slot(key);
+    return (s == _nslots) ? npos : _slots[s].lidx;
+  }
+
+  /**
+   * Adds a key to the index, the key must not be in the index already.
+   */
+  void insert(const key_type & key, index_type lidx)
+  {
+    // Tombstones are counted as occupied slots as they do not terminate
+    // probe sequences:
+    if (2 * (_size + _ntombstones + 1) > _nslots) {
+      rehash(2 * (_size + 1));
+    }
+    _insert_slot(key, lidx);
+  }
+
+  /**
+   * Removes a key from the index, returns the local offset that had been
+   * assigned to the key or \c npos if the key is not in the index.
+   */
+  index_type erase(const key_type & key)
+  {
+    auto s = _find_slot(key);
+    if (s == _nslots) {
+      return npos;
+    }
+    auto lidx      = _slots[s].lidx;
+    _slots[s].lidx = tombstone;
+    --_size;
+    ++_ntombstones;
+    return lidx;
+  }
+
+  /**
+   * Assigns a new local offset to a key in the index, e.g. after its
+   * element has been relocated in local memory.
+   */
+  void update(const key_type & key, index_type lidx)
+  {
+    auto s = _find_slot(key);
+    DASH_ASSERT_MSG(s != _nslots, "key to update is not in the index");
+    _slots[s].lidx = lidx;
+  }
+
+  /**
+   * Removes all keys from the index.
+   */
+  void clear()
+  {
+    for (size_type s = 0; s < _nslots; ++s) {
+      _slots[s].lidx = npos;
+    }
+    _size        = 0;
+    _ntombstones = 0;
+  }
+
+  /**
+   * Grows the index to hold at least the given number of keys without
+   * exceeding a load factor of 1/2.
+   *
+   * Local operation.
+   */
+  void rehash(size_type capacity)
+  {
+    size_type nslots = std::max<size_type>(2 * capacity, 16);
+    if (nslots <= _nslots) {
+      if (_ntombstones == 0) {
+        return;
+      }
+      // Drop tombstones:
+      nslots = _nslots;
+    }
+    _rebuild(nslots);
+  }
+
+  /**
+   * Shrinks the index to the number of slots required for its keys and
+   * drops tombstones.
+   *
+   * Local operation.
+   */
+  void compact()
+  {
+    _rebuild(std::max<size_type>(2 * _size, 16));
+  }
+
+  /**
+   * Releases the index memory that has been replaced since the last call,
+   * to be called once the current descriptor has been exchanged with all
+   * units.
+   */
+  void publish()
+  {
+    if (!DART_GPTR_EQUAL(_gptr_published, _gptr)) {
+      _free(_gptr_published);
+      _gptr_published = _gptr;
+    }
+  }
+
+  /**
+   * State of a lookup in the index of a remote unit, probing a window of
+   * \c DASH__MAP__INDEX_PROBE_WINDOW slots per round trip.
+   */
+  class probe_type
+  {
+    friend class UnorderedMapIndex;
+
+  private:
+    /// Probed slots, trivially copyable and not necessarily
+    /// default-constructible.
+    typename std::aligned_storage<
+      sizeof(slot_type), alignof(slot_type)>::type
+                  _window[DASH__MAP__INDEX_PROBE_WINDOW];
+    /// Index of the first slot in the window.
+    size_type     _slot    = 0;
+    /// Number of slots in the window.
+    size_type     _nwindow = 0;
+    /// Number of slots probed including the window.
+    size_type     _nprobed = 0;
+    /// Handle of the transfer of the window.
+    dart_handle_t _handle  = DART_HANDLE_NULL;
+
+  public:
+    /**
+     * Handle of the pending transfer of the current window.
+     */
+    dart_handle_t & handle() noexcept
+    {
+      return _handle;
+    }
+  };
+
+  /**
+   * Starts a lookup of a key in the index of a remote unit by fetching
+   * the first window of slots, returns \c false if the index is empty.
+   *
+   * The slots are transferred asynchronously, \c probe_complete has to
+   * be called once the transfer referenced by \c probe.handle() has
+   * completed.
+   */
+  static bool probe_start(
+    const descriptor_type & desc,
+    const key_type        & key,
+    const KeyHash         & key_hash,
+    probe_type            & probe)
+  {
+    if (desc.nslots == 0) {
+      return false;
+    }
+    hash_policy policy;
+    policy.commit(desc.prime_index);
+    probe._slot    = policy.index_for_hash(key_hash(key), desc.nslots - 1);
+    probe._nprobed = 0;
+    _probe_window(desc, probe);
+    return true;
+  }
+
+  /**
+   * Scans the window of slots fetched in a probe.
+   * Returns \c true and sets \c lidx to the local offset of the key, or
+   * to \c npos if the key is not in the index.
+   * Returns \c false if the window does not decide the lookup, the next
+   * window has been requested in this case.
+   */
+  static bool probe_complete(
+    const descriptor_type & desc,
+    const key_type        & key,
+    const KeyEqual        & key_equal,
+    probe_type            & probe,
+    index_type            & lidx)
+  {
+    auto * window = reinterpret_cast<slot_type *>(probe._window);
+    for (size_type w = 0; w < probe._nwindow; ++w) {
+      if (window[w].lidx == npos) {
+        lidx = npos;
+        return true;
+      }
+      if (window[w].lidx != tombstone && key_equal(window[w].key, key)) {
+        lidx = window[w].lidx;
+        return true;
+      }
+    }
+    if (probe._nprobed >= desc.nslots) {
+      lidx = npos;
+      return true;
+    }
+    probe._slot = (probe._slot + probe._nwindow) % desc.nslots;
+    _probe_window(desc, probe);
+    return false;
+  }
+
+  /**
+   * Local offset of the element with the given key in the index of a
+   * remote unit, \c npos if the key is not in the index.
+   */
+  static index_type find(
+    const descriptor_type & desc,
+    const key_type        & key,
+    const KeyHash         & key_hash,
+    const KeyEqual        & key_equal)
+  {
+    probe_type probe;
+    index_type lidx = npos;
+    if (!probe_start(desc, key, key_hash, probe)) {
+      return npos;
+    }
+    do {
+      DASH_ASSERT_RETURNS(dart_wait_local(&probe.handle()), DART_OK);
+    } while (!probe_complete(desc, key, key_equal, probe, lidx));
+    return lidx;
+  }
+
+private:
+  typedef prime_number_hash_policy hash_policy;
+
+  /**
+   * Moves the keys in the index to newly allocated slots.
+   */
+  void _rebuild(size_type nslots)
+  {
+    hash_policy policy;
+    auto prime_index = policy.next_size_over(nslots);
+    DASH_LOG_TRACE("UnorderedMapIndex._rebuild()",
+                   "slots:", _nslots, "->", nslots);
+
+    dart_gptr_t gptr = DART_GPTR_NULL;
+    DASH_ASSERT_RETURNS(
+      dart_memalloc(nslots * sizeof(slot_type), DART_TYPE_BYTE, &gptr),
+      DART_OK);
+    void * addr = nullptr;
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr, &addr), DART_OK);
+
+    auto         * old_slots  = _slots;
+    auto           old_nslots = _nslots;
+    dart_gptr_t    old_gptr   = _gptr;
+    _gptr        = gptr;
+    _slots       = static_cast<slot_type *>(addr);
+    _nslots      = nslots;
+    _prime_index = prime_index;
+    _size        = 0;
+    _ntombstones = 0;
+    for (size_type s = 0; s < _nslots; ++s) {
+      _slots[s].lidx = npos;
+    }
+    for (size_type s = 0; s < old_nslots; ++s) {
+      if (old_slots[s].lidx != npos && old_slots[s].lidx != tombstone) {
+        _insert_slot(old_slots[s].key, old_slots[s].lidx);
+      }
+    }
+    // Remote units might still probe the index known to them:
+    if (!DART_GPTR_EQUAL(old_gptr, _gptr_published)) {
+      _free(old_gptr);
+    }
+  }
+
+
+  /**
+   * Slot containing the given key, number of slots if the key is not in
+   * the index.
+   */
+  size_type _find_slot(const key_type & key) const
+  {
+    hash_policy policy;
+    policy.commit(_prime_index);
+    for (auto s = policy.index_for_hash(_key_hash(key), _nslots - 1);
+         _slots[s].lidx != npos;
+         s = (s + 1 < _nslots) ? s + 1 : 0) {
+      if (_slots[s].lidx != tombstone && _key_equal(_slots[s].key, key)) {
+        return s;
+      }
+    }
+    return _nslots;
+  }
+
+  void _insert_slot(const key_type & key, index_type lidx)
+  {
+    hash_policy policy;
+    policy.commit(_prime_index);
+    auto s = policy.index_for_hash(_key_hash(key), _nslots - 1);
+    while (_slots[s].lidx != npos && _slots[s].lidx != tombstone) {
+      s = (s + 1 < _nslots) ? s + 1 : 0;
+    }
+    if (_slots[s].lidx == tombstone) {
+      --_ntombstones;
+    }
+    // Key is trivially copyable, placement new avoids requiring it to be
+    // assignable:
+    new (&(_slots[s].key)) key_type(key);
+    _slots[s].lidx = lidx;
+    ++_size;
+  }
+
+  /**
+   * Requests the window of slots beginning at the probe's current slot.
+   */
+  static void _probe_window(
+    const descriptor_type & desc,
+    probe_type            & probe)
+  {
+    probe._nwindow = std::min<size_type>(
+                       { DASH__MAP__INDEX_PROBE_WINDOW,
+                         desc.nslots - probe._slot,
+                         desc.nslots - probe._nprobed });
+    probe._nprobed += probe._nwindow;
+    dart_gptr_t gptr = desc.gptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, probe._slot * sizeof(slot_type)),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(
+        probe._window, gptr, probe._nwindow * sizeof(slot_type),
+        DART_TYPE_BYTE, DART_TYPE_BYTE, &probe._handle),
+      DART_OK);
+  }
+
+  static void _free(dart_gptr_t & gptr)
+  {
+    if (!DART_GPTR_ISNULL(gptr)) {
+      DASH_ASSERT_RETURNS(dart_memfree(gptr), DART_OK);
+      gptr = DART_GPTR_NULL;
+    }
+  }
+
+private:
+  /// Global pointer to the slots of the index.
+  dart_gptr_t  _gptr           = DART_GPTR_NULL;
+  /// Global pointer to the slots last exchanged with remote units.
+  dart_gptr_t  _gptr_published = DART_GPTR_NULL;
+  /// Native pointer to the slots of the index.
+  slot_type  * _slots          = nullptr;
+  /// Number of slots, a prime number.
+  size_type    _nslots         = 0;
+  /// Index of the number of slots in the prime list of the hash policy.
+  uint8_t      _prime_index    = 0;
+  /// Number of keys in the index.
+  size_type    _size           = 0;
+  /// Number of slots of erased keys.
+  size_type    _ntombstones    = 0;
+  /// Hash function of keys.
+  KeyHash      _key_hash;
+  /// Predicate for key comparison.
+  KeyEqual     _key_equal;
+};
+
+template <typename K, typename I, typename H, typename E>
+constexpr typename UnorderedMapIndex<K, I, H, E>::index_type
+UnorderedMapIndex<K, I, H, E>::npos;
+
+template <typename K, typename I, typename H, typename E>
+constexpr typename UnorderedMapIndex<K, I, H, E>::index_type
+UnorderedMapIndex<K, I, H, E>::tombstone;
+
+} // namespace detail
+} // namespace dash
+
+#endif // DASH__MAP__UNORDERED_MAP_INDEX_H__INCLUDED
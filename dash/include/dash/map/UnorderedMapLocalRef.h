@@ -3,6 +3,9 @@
 
 #include <dash/Team.h>
 
+#include <iterator>
+#include <vector>
+
 namespace dash {
 
 #ifdef DOXYGEN
@@ -270,18 +273,13 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    iterator found = end();
+    if (_map->_local_index != nullptr) {
+      auto lidx = _map->_local_index->find(key);
+      if (lidx != map_type::local_index_type::npos) {
+        found = begin() + lidx;
+      }
+    }
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -289,18 +287,7 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    const_iterator found = const_cast<self_t *>(this)->find(key);
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
@@ -364,40 +351,62 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    // Allocate memory for all new elements in a single call of
+    // globmem.grow:
+    _map->_reserve_local(first, last,
+                         typename std::iterator_traits<InputIterator>
+                                    ::iterator_category());
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Removes the element at the given position, the last local element
+   * takes its place.
+   *
+   * \returns  Iterator at the position of the removed element.
+   */
   iterator erase(
     const_iterator it)
   {
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "iterator:", it);
-    erase(*it.first);
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    auto lidx = it.lpos().index;
+    _map->_erase_local(lidx);
+    iterator res = begin() + lidx;
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", res);
+    return res;
   }
 
+  /**
+   * Removes the element with the given key from local memory space.
+   *
+   * \returns  The number of elements removed, 0 or 1.
+   *
+   * \see  UnorderedMap::erase(const key_type &)
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "key:", key);
-    auto b_idx  = bucket(key);
-    auto b_size = bucket_size(b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_size);
-
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMapLocalRef.erase is not implemented.");
-
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    size_type nerased = 0;
+    if (_map->_local_index != nullptr) {
+      auto lidx = _map->_local_index->find(key);
+      if (lidx != map_type::local_index_type::npos) {
+        _map->_erase_local(lidx);
+        nerased = 1;
+      }
+    }
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", nerased);
+    return nerased;
   }
 
+  /**
+   * Removes the elements in the local range \c [first, last).
+   *
+   * \returns  Iterator at the position of the first removed element.
+   */
   iterator erase(
     /// Iterator at first element to remove.
     const_iterator first,
@@ -407,10 +416,17 @@ public:
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last)");
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", first);
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", last);
+    // Positions of elements change when elements are removed:
+    std::vector<key_type> keys;
     for (auto it = first; it != last; ++it) {
-      erase(*it.first);
+      keys.push_back((*it).first);
+    }
+    for (auto & key : keys) {
+      erase(key);
     }
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last) >");
+    iterator res = begin() + first.lpos().index;
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last) >", res);
+    return res;
   }
 
   //////////////////////////////////////////////////////////////////////////
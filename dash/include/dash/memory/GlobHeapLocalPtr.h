@@ -393,7 +393,9 @@ private:
       // element is in bucket currently referenced by this iterator:
       _bucket_phase += offset;
     } else {
-      // find bucket containing element at given offset:
+      // find bucket containing element at given offset, relative to the
+      // beginning of the current bucket:
+      offset += _bucket_phase;
       for (; _bucket_it != _bucket_last; ++_bucket_it) {
         if (offset >= _bucket_it->size) {
           offset -= _bucket_it->size;
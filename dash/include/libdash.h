@@ -39,6 +39,7 @@ namespace dash {
 #include <dash/GlobAsyncRef.h>
 
 #include <dash/Onesided.h>
+#include <dash/Collective.h>
 
 #include <dash/LaunchPolicy.h>
 
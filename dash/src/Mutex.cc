@@ -9,6 +9,13 @@ Mutex::Mutex(Team& team)
   init();
 }
 
+Mutex::Mutex(Team& team, bool shared)
+  : _team(&team)
+  , _shared(shared)
+{
+  init();
+}
+
 bool Mutex::init() {
   if (dart_lock_initialized(_mutex.get())) {
     DASH_LOG_ERROR("DART lock is already initialized");
@@ -16,7 +23,9 @@ bool Mutex::init() {
   }
   if (*_team != dash::Team::Null() && dash::is_initialized()) {
     dart_lock_t m;
-    dart_ret_t ret = dart_team_lock_init(_team->dart_id(), &m);
+    dart_ret_t ret = _shared
+                     ? dart_team_rwlock_init(_team->dart_id(), &m)
+                     : dart_team_lock_init(_team->dart_id(), &m);
 
     if (ret != DART_OK) {
         DASH_LOG_ERROR(
@@ -50,7 +59,28 @@ bool Mutex::try_lock(){
 void Mutex::unlock(){
   DASH_ASSERT(dart_lock_initialized(_mutex.get()));
   dart_ret_t ret = dart_lock_release(_mutex.get());
-  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire failed");
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_release failed");
+}
+
+void SharedMutex::lock_shared(){
+  DASH_ASSERT(dart_lock_initialized(dart_lock()));
+  dart_ret_t ret = dart_lock_acquire_shared(dart_lock());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire_shared failed");
+}
+
+bool SharedMutex::try_lock_shared(){
+  int32_t result;
+
+  DASH_ASSERT(dart_lock_initialized(dart_lock()));
+  dart_ret_t ret = dart_lock_try_acquire_shared(dart_lock(), &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire_shared failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock_shared(){
+  DASH_ASSERT(dart_lock_initialized(dart_lock()));
+  dart_ret_t ret = dart_lock_release_shared(dart_lock());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_release_shared failed");
 }
 
 } // namespace dash
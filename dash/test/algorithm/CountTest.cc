@@ -0,0 +1,123 @@
+#include "CountTest.h"
+
+#include <dash/algorithm/Count.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Histogram.h>
+
+#include <dash/Array.h>
+
+#include <vector>
+
+
+TEST_F(CountTest, CountAndCountIf)
+{
+  const size_t num_elem_total = dash::size() * 100 + 3;
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(7));
+
+  dash::generate_with_index(array.begin(), array.end(),
+                            [](size_t gidx) { return gidx % 13; });
+  array.barrier();
+
+  auto num_fives = dash::count(array.begin(), array.end(), 5);
+  auto num_odd   = dash::count_if(array.begin(), array.end(),
+                                  [](int value) { return value % 2 != 0; });
+
+  long expected_fives = 0;
+  long expected_odd   = 0;
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    expected_fives += (i % 13 == 5);
+    expected_odd   += (i % 13) % 2;
+  }
+  ASSERT_EQ_U(expected_fives, num_fives);
+  ASSERT_EQ_U(expected_odd,   num_odd);
+}
+
+TEST_F(CountTest, CountIfSubrange)
+{
+  const size_t num_elem_total = dash::size() * 100 + 3;
+  dash::Array<int> array(num_elem_total);
+
+  dash::generate_with_index(array.begin(), array.end(),
+                            [](size_t gidx) { return gidx % 13; });
+  array.barrier();
+
+  auto num_odd = dash::count_if(array.begin() + 2, array.end() - 3,
+                                [](int value) { return value % 2 != 0; });
+
+  long expected_odd = 0;
+  for (size_t i = 2; i < num_elem_total - 3; ++i) {
+    expected_odd += (i % 13) % 2;
+  }
+  ASSERT_EQ_U(expected_odd, num_odd);
+}
+
+TEST_F(CountTest, HistogramLocalOutput)
+{
+  const size_t num_elem_total = dash::size() * 1000 + 11;
+  const size_t nbins          = 17;
+  dash::Array<int> array(num_elem_total);
+
+  // includes keys outside of the bin range which must be ignored
+  dash::generate_with_index(array.begin(), array.end(),
+                            [](size_t gidx) { return (gidx % 23) - 3; });
+  array.barrier();
+
+  std::vector<long> histo(nbins, -1);
+  auto histo_end = dash::histogram(
+                     array.begin(), array.end(), nbins, histo.begin());
+  ASSERT_TRUE_U(histo.end() == histo_end);
+
+  std::vector<long> expected(nbins, 0);
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    int key = (i % 23) - 3;
+    if (key >= 0 && key < static_cast<int>(nbins)) {
+      ++expected[key];
+    }
+  }
+  for (size_t b = 0; b < nbins; ++b) {
+    EXPECT_EQ_U(expected[b], histo[b]);
+  }
+}
+
+TEST_F(CountTest, HistogramGlobalOutput)
+{
+  const size_t num_elem_total = dash::size() * 1000 + 11;
+  const size_t nbins          = dash::size() * 10 + 3;
+  dash::Array<double> array(num_elem_total, dash::BLOCKCYCLIC(13));
+
+  dash::generate_with_index(array.begin(), array.end(),
+                            [](size_t gidx) { return 0.5 * (gidx % 97); });
+  array.barrier();
+
+  auto bin_of = [](double value) { return static_cast<int>(value * 3); };
+
+  std::vector<long> expected(nbins, 0);
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    size_t bin = bin_of(0.5 * (i % 97));
+    if (bin < nbins) {
+      ++expected[bin];
+    }
+  }
+
+  // bins distributed in blocks
+  dash::Array<long> histo_blocked(nbins);
+  dash::histogram(array.begin(), array.end(), nbins,
+                  histo_blocked.begin(), bin_of);
+  for (size_t b = 0; b < nbins; ++b) {
+    EXPECT_EQ_U(expected[b], static_cast<long>(histo_blocked[b]));
+  }
+
+  // bins distributed round-robin, histogram into a subrange
+  dash::Array<long> histo_cyclic(nbins + 4, dash::CYCLIC);
+  dash::fill(histo_cyclic.begin(), histo_cyclic.end(), -1l);
+  histo_cyclic.barrier();
+  auto histo_end = dash::histogram(array.begin(), array.end(), nbins,
+                                   histo_cyclic.begin() + 2, bin_of);
+  ASSERT_TRUE_U(histo_cyclic.end() - 2 == histo_end);
+  for (size_t b = 0; b < nbins; ++b) {
+    EXPECT_EQ_U(expected[b], static_cast<long>(histo_cyclic[b + 2]));
+  }
+  EXPECT_EQ_U(-1l, static_cast<long>(histo_cyclic[0]));
+  EXPECT_EQ_U(-1l, static_cast<long>(histo_cyclic[nbins + 3]));
+}
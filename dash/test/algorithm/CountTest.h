@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__COUNT_TEST_H_
+#define DASH__TEST__COUNT_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::count and dash::histogram
+ */
+class CountTest : public dash::test::TestBase {
+protected:
+
+  CountTest()  {
+    LOG_MESSAGE(">>> Test suite: CountTest");
+  }
+
+  ~CountTest() override
+  {
+    LOG_MESSAGE("<<< Closing test suite: CountTest");
+  }
+};
+
+#endif // DASH__TEST__COUNT_TEST_H_
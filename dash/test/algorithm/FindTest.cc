@@ -4,6 +4,9 @@
 #include <dash/Array.h>
 #include <dash/Team.h>
 #include <dash/algorithm/Find.h>
+#include <dash/algorithm/AllOf.h>
+#include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/None_of.h>
 
 #include <limits>
 
@@ -323,3 +326,75 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+
+TEST_F(FindTest, FirstOfManyMatches)
+{
+  auto const num_units = dash::Team::All().size();
+  // Several chunks per unit:
+  size_t const nlocal = 3 * DASH__FIND__CHUNK_ELEM + 17;
+
+  dash::Array<Element_t> array(num_units * nlocal, dash::BLOCKCYCLIC(1000));
+
+  // Matches in every chunk of every unit:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (l % 997 == 996) ? 1 : 0;
+  }
+  array.barrier();
+
+  auto const & pattern = array.pattern();
+  index_t expected     = array.size();
+  for (dash::team_unit_t u{0}; u < static_cast<int>(num_units); ++u) {
+    if (pattern.local_size(u) > 996) {
+      expected = std::min<index_t>(
+                   expected, pattern.global_index(u, {{ 996 }}));
+    }
+  }
+
+  auto found = dash::find(array.begin(), array.end(), 1);
+  EXPECT_EQ_U(expected, found.pos());
+
+  // Search subrange starting after the first match:
+  auto found_sub = dash::find_if(array.begin() + expected + 1, array.end(),
+                                 [](Element_t v) { return v == 1; });
+  ASSERT_NE_U(array.end(), found_sub);
+  EXPECT_GT_U(found_sub.pos(), expected);
+  EXPECT_EQ_U(1, static_cast<Element_t>(*found_sub));
+  for (index_t i = expected + 1; i < found_sub.pos(); i += 97) {
+    EXPECT_EQ_U(0, static_cast<Element_t>(array[i]));
+  }
+
+  array.barrier();
+}
+
+TEST_F(FindTest, AnyAllNoneOf)
+{
+  auto const num_units = dash::Team::All().size();
+
+  dash::Array<Element_t> array(num_units * 2 * DASH__FIND__CHUNK_ELEM);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = 1;
+  }
+  array.barrier();
+
+  auto positive = [](Element_t v) { return v > 0; };
+  auto negative = [](Element_t v) { return v < 0; };
+
+  EXPECT_TRUE_U(dash::all_of(array.begin(), array.end(), positive));
+  EXPECT_TRUE_U(dash::any_of(array.begin(), array.end(), positive));
+  EXPECT_FALSE_U(dash::any_of(array.begin(), array.end(), negative));
+  EXPECT_TRUE_U(dash::none_of(array.begin(), array.end(), negative));
+  array.barrier();
+
+  if (dash::myid() == num_units - 1) {
+    array.local[array.lsize() - 1] = -1;
+  }
+  array.barrier();
+
+  EXPECT_FALSE_U(dash::all_of(array.begin(), array.end(), positive));
+  EXPECT_TRUE_U(dash::any_of(array.begin(), array.end(), negative));
+  EXPECT_FALSE_U(dash::none_of(array.begin(), array.end(), negative));
+  EXPECT_EQ_U(array.size() - 1,
+              dash::find_if_not(array.begin(), array.end(), positive).pos());
+
+  array.barrier();
+}
@@ -166,3 +166,76 @@ TEST_F(ForEachTest, Lambdas)
                  });
 }
 
+
+TEST_F(ForEachTest, Subrange)
+{
+  dash::Array<int> array(dash::size() * 10 + 3);
+  dash::fill(array.begin(), array.end(), 0);
+
+  auto const first = array.begin() + 5;
+  auto const last  = array.end() - 2;
+  dash::for_each(first, last, [](int & el) { el += 1; });
+
+  dash::for_each_with_index(
+                 array.begin(), array.end(),
+                 [&](const int & el, index_t gindex) {
+                   EXPECT_EQ_U(
+                     (gindex >= first.pos() && gindex < last.pos()) ? 1 : 0,
+                     el);
+                 });
+}
+
+TEST_F(ForEachTest, ParallelPolicy)
+{
+  dash::Array<long> array(dash::size() * 3 * DASH__FOR_EACH__CHUNK_ELEM + 7);
+  dash::fill(array.begin(), array.end(), 1L);
+
+  dash::for_each(dash::execution::par, array.begin(), array.end(),
+                 [](long & el) {
+                   el *= 2;
+                 });
+  dash::for_each_with_index(
+                 dash::execution::par, array.begin(), array.end(),
+                 [](long & el, index_t gindex) {
+                   el += gindex;
+                 });
+  dash::for_each_with_index(
+                 dash::execution::seq, array.begin(), array.end(),
+                 [](const long & el, index_t gindex) {
+                   EXPECT_EQ_U(2 + gindex, el);
+                 });
+}
+
+TEST_F(ForEachTest, ParallelLocalPolicy)
+{
+  dash::Array<long> array(dash::size() * 3 * DASH__FOR_EACH__CHUNK_ELEM);
+  dash::fill(array.begin(), array.end(), 0L);
+
+  auto fut = dash::for_each_with_index(
+               dash::execution::par_local, array.begin(), array.end(),
+               [](long & el, index_t gindex) {
+                 el = gindex;
+               });
+  // Only local elements are modified, no synchronization required to read
+  // them after completion:
+  fut.wait();
+  EXPECT_TRUE_U(fut.test());
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(array.pattern().global(l), array.local[l]);
+  }
+
+  auto fut_incr = dash::for_each(
+                    dash::execution::par_local, array.begin(), array.end(),
+                    [](long & el) {
+                      el += 1;
+                    });
+  while (!fut_incr.test()) { }
+  array.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < array.size(); i += 97) {
+      EXPECT_EQ_U(static_cast<long>(i + 1), static_cast<long>(array[i]));
+    }
+  }
+  array.barrier();
+}
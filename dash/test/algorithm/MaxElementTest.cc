@@ -2,6 +2,7 @@
 #include "MaxElementTest.h"
 
 #include <dash/Array.h>
+#include <dash/algorithm/Generate.h>
 #include <dash/algorithm/MinMax.h>
 
 TEST_F(MaxElementTest, TestFindArrayDefault)
@@ -110,3 +111,19 @@ TEST_F(MaxElementTest, TestFindArrayUnderfilled)
               static_cast<int>(found_max));
   EXPECT_EQ(max_value, found_max);
 }
+
+TEST_F(MaxElementTest, TestFindFirstOccurrence)
+{
+  Array_t array(_num_elem, dash::BLOCKCYCLIC(3));
+  dash::generate_with_index(
+    array.begin(), array.end(),
+    [](index_t gidx) {
+      return static_cast<Element_t>(gidx % 11);
+    });
+  array.barrier();
+
+  // Maximum is repeated on several units, the first occurrence wins:
+  auto found_git = dash::max_element(array.begin(), array.end());
+  EXPECT_EQ_U(10, found_git.gpos());
+  EXPECT_EQ_U(10, static_cast<Element_t>(*found_git));
+}
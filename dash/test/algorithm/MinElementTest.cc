@@ -271,3 +271,64 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, TestFindFirstOccurrence)
+{
+  // Minimum at the first element and repeated on every unit, the first
+  // occurrence has global index 0:
+  Array_t array(_num_elem, dash::BLOCKCYCLIC(7));
+  dash::generate_with_index(
+    array.begin(), array.end(),
+    [](index_t gidx) {
+      return static_cast<Element_t>((gidx % 5 == 0) ? -3 : gidx);
+    });
+  array.barrier();
+
+  auto found_default = dash::min_element(array.begin(), array.end());
+  EXPECT_EQ_U(0, found_default.gpos());
+  EXPECT_EQ_U(-3, static_cast<Element_t>(*found_default));
+
+  // Custom compare function requires a user-defined reduction:
+  auto found_custom = dash::min_element(
+                        array.begin() + 1, array.end(),
+                        [](const Element_t & a, const Element_t & b) {
+                          return (a % 7) < (b % 7);
+                        });
+  // -3 % 7 == -3 is the smallest remainder, first occurrence after the
+  // first element is at index 5:
+  EXPECT_EQ_U(5, found_custom.gpos());
+}
+
+TEST_F(MinElementTest, TestMinMaxElement)
+{
+  Array_t array(_num_elem, dash::BLOCKCYCLIC(5));
+  dash::generate_with_index(
+    array.begin(), array.end(),
+    [](index_t gidx) {
+      return static_cast<Element_t>(gidx % 17);
+    });
+  array.barrier();
+
+  // First minimum and last maximum like std::minmax_element:
+  auto minmax = dash::minmax_element(array.begin() + 3, array.end());
+  EXPECT_EQ_U(17, minmax.first.gpos());
+  EXPECT_EQ_U(
+    static_cast<index_t>(((_num_elem - 1 - 16) / 17) * 17 + 16),
+    minmax.second.gpos());
+
+  // Custom compare function, reversed order:
+  auto maxmin = dash::minmax_element(
+                  array.begin(), array.end(),
+                  [](const Element_t & a, const Element_t & b) {
+                    return a > b;
+                  });
+  EXPECT_EQ_U(16, maxmin.first.gpos());
+  EXPECT_EQ_U(
+    static_cast<index_t>(((_num_elem - 1) / 17) * 17),
+    maxmin.second.gpos());
+
+  // Empty range:
+  auto empty = dash::minmax_element(array.end(), array.end());
+  EXPECT_EQ_U(array.end(), empty.first);
+  EXPECT_EQ_U(array.end(), empty.second);
+}
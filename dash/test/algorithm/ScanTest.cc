@@ -0,0 +1,163 @@
+
+#include "ScanTest.h"
+
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Scan.h>
+
+#include <dash/Array.h>
+
+#include <numeric>
+#include <vector>
+
+
+TEST_F(ScanTest, InclusiveSum)
+{
+  // Uneven number of elements, the last unit holds less elements
+  const size_t num_elem_total = dash::size() * 100 + 3;
+  dash::Array<int> array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_out(num_elem_total, dash::BLOCKED);
+
+  dash::generate_with_index(array_in.begin(), array_in.end(),
+                            [](size_t gidx) { return gidx % 7; });
+  array_in.barrier();
+
+  auto out_last = dash::inclusive_scan(
+                    array_in.begin(), array_in.end(), array_out.begin());
+  ASSERT_EQ_U(array_out.end(), out_last);
+  array_out.barrier();
+
+  if (dash::myid() == 0) {
+    int sum = 0;
+    for (size_t i = 0; i < num_elem_total; ++i) {
+      sum += i % 7;
+      ASSERT_EQ_U(sum, static_cast<int>(array_out[i]));
+    }
+  }
+  array_out.barrier();
+
+  // in-place scan
+  dash::inclusive_scan(array_in.begin(), array_in.end(), array_in.begin());
+  array_in.barrier();
+
+  for (size_t l = 0; l < array_in.lsize(); ++l) {
+    ASSERT_EQ_U(array_out.local[l], array_in.local[l]);
+  }
+}
+
+TEST_F(ScanTest, ExclusiveSumPartialRange)
+{
+  const size_t num_elem_local = 50;
+  const size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<long> array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<long> array_out(num_elem_total, dash::BLOCKED);
+
+  dash::generate_with_index(array_in.begin(), array_in.end(),
+                            [](size_t gidx) { return gidx; });
+  array_in.barrier();
+
+  // First and last unit contribute half of their elements, the output
+  // range is not aligned with the input range
+  auto in_first = array_in.begin() + num_elem_local / 2;
+  auto in_last  = array_in.end() - num_elem_local / 2;
+
+  dash::exclusive_scan(in_first, in_last, array_out.begin(), 10L);
+  array_out.barrier();
+
+  if (dash::myid() == 0) {
+    long sum = 10;
+    auto n   = dash::distance(in_first, in_last);
+    for (decltype(n) i = 0; i < n; ++i) {
+      ASSERT_EQ_U(sum, static_cast<long>(array_out[i]));
+      sum += num_elem_local / 2 + i;
+    }
+  }
+  array_out.barrier();
+}
+
+/**
+ * Affine function x -> m * x + c, composition is associative but not
+ * commutative.
+ */
+struct Affine {
+  long m;
+  long c;
+};
+
+TEST_F(ScanTest, NonCommutativeOperation)
+{
+  const size_t num_elem_total = dash::size() * 20;
+  const long   mod            = 1000003;
+  dash::Array<Affine> array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<Affine> array_out(num_elem_total, dash::BLOCKED);
+
+  auto const gen = [](size_t gidx) {
+    return Affine{ static_cast<long>(gidx % 5 + 1),
+                   static_cast<long>(gidx % 3) };
+  };
+  // apply lhs, then rhs
+  auto const compose = [mod](const Affine & lhs, const Affine & rhs) {
+    return Affine{ (lhs.m * rhs.m) % mod, (lhs.c * rhs.m + rhs.c) % mod };
+  };
+
+  dash::generate_with_index(array_in.begin(), array_in.end(), gen);
+  array_in.barrier();
+
+  dash::inclusive_scan(
+    array_in.begin(), array_in.end(), array_out.begin(), compose);
+  array_out.barrier();
+
+  if (dash::myid() == 0) {
+    Affine expected = gen(0);
+    for (size_t i = 0; i < num_elem_total; ++i) {
+      if (i > 0) {
+        expected = compose(expected, gen(i));
+      }
+      Affine actual = array_out[i];
+      ASSERT_EQ_U(expected.m, actual.m);
+      ASSERT_EQ_U(expected.c, actual.c);
+    }
+  }
+  array_out.barrier();
+}
+
+TEST_F(ScanTest, TransformScanDifferentPattern)
+{
+  const size_t num_elem_total = dash::size() * 123;
+  dash::Array<int>    array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<double> array_out(num_elem_total, dash::BLOCKCYCLIC(7));
+
+  dash::generate_with_index(array_in.begin(), array_in.end(),
+                            [](size_t gidx) { return gidx % 11; });
+  array_in.barrier();
+
+  auto const square = [](const int & v) { return 0.5 * v * v; };
+
+  dash::transform_inclusive_scan(
+    array_in.begin(), array_in.end(), array_out.begin(),
+    dash::plus<double>(), square);
+  array_out.barrier();
+
+  std::vector<double> expected(num_elem_total);
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    expected[i] = square(i % 11) + (i > 0 ? expected[i - 1] : 0.0);
+  }
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < num_elem_total; ++i) {
+      ASSERT_EQ_U(expected[i], static_cast<double>(array_out[i]));
+    }
+  }
+  array_out.barrier();
+
+  dash::transform_exclusive_scan(
+    array_in.begin(), array_in.end(), array_out.begin(), 1.0,
+    dash::plus<double>(), square);
+  array_out.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < num_elem_total; ++i) {
+      ASSERT_EQ_U(1.0 + (i > 0 ? expected[i - 1] : 0.0),
+                  static_cast<double>(array_out[i]));
+    }
+  }
+  array_out.barrier();
+}
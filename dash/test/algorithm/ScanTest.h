@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__SCAN_TEST_H_
+#define DASH__TEST__SCAN_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for dash::inclusive_scan and dash::exclusive_scan
+ */
+class ScanTest : public dash::test::TestBase {
+protected:
+
+  ScanTest()  {
+    LOG_MESSAGE(">>> Test suite: ScanTest");
+  }
+
+  ~ScanTest() override
+  {
+    LOG_MESSAGE("<<< Closing test suite: ScanTest");
+  }
+};
+
+#endif // DASH__TEST__SCAN_TEST_H_
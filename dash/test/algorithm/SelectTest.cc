@@ -0,0 +1,213 @@
+#include "SelectTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Select.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+template <class ArrayT>
+static std::vector<typename ArrayT::value_type> copy_range(
+    typename ArrayT::iterator first, typename ArrayT::iterator last)
+{
+  std::vector<typename ArrayT::value_type> values;
+  values.reserve(last - first);
+  for (auto it = first; it != last; ++it) {
+    values.push_back(static_cast<typename ArrayT::value_type>(*it));
+  }
+  return values;
+}
+
+template <class ArrayT>
+static std::vector<typename ArrayT::value_type> sorted_copy(ArrayT& array)
+{
+  auto values = copy_range<ArrayT>(array.begin(), array.end());
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+TEST_F(SelectTest, NthElement)
+{
+  using Element_t = int32_t;
+
+  // Many duplicates, blocks of different size
+  dash::Array<Element_t> array(
+      num_local_elem * dash::size() + 7, dash::BLOCKCYCLIC(13));
+  dash::generate_with_index(array.begin(), array.end(), [](size_t i) {
+    return static_cast<Element_t>((i * 7919) % 1001) - 500;
+  });
+  array.barrier();
+
+  auto const sorted = sorted_copy(array);
+  array.barrier();
+
+  for (size_t nth : {size_t{0}, array.size() / 4, array.size() / 2,
+                     array.size() - 1}) {
+    auto const value = dash::nth_element(
+        array.begin(), array.begin() + nth, array.end());
+    EXPECT_EQ_U(sorted[nth], value);
+  }
+
+  // Subrange
+  auto const first = array.begin() + 5;
+  auto const last  = array.end() - 3;
+  auto sub = copy_range<dash::Array<Element_t>>(first, last);
+  std::sort(sub.begin(), sub.end());
+  EXPECT_EQ_U(
+      sub[sub.size() / 3],
+      dash::nth_element(first, first + sub.size() / 3, last));
+
+  array.barrier();
+}
+
+TEST_F(SelectTest, NthElementFloatingPoint)
+{
+  using Element_t = double;
+
+  dash::Array<Element_t> array(num_local_elem * dash::size());
+  dash::generate_with_index(array.begin(), array.end(), [](size_t i) {
+    return (static_cast<double>((i * 104729) % 997) - 498.5) * 1.0e-3;
+  });
+  array.barrier();
+
+  auto const sorted = sorted_copy(array);
+  array.barrier();
+
+  auto const nth = array.size() / 10;
+  // 10-th percentile
+  EXPECT_EQ_U(
+      sorted[nth],
+      dash::nth_element(array.begin(), array.begin() + nth, array.end()));
+  // Order by absolute value
+  std::vector<Element_t> abs_sorted(sorted);
+  std::sort(
+      abs_sorted.begin(), abs_sorted.end(), [](double a, double b) {
+        return std::abs(a) < std::abs(b);
+      });
+  auto const abs_nth = dash::nth_element(
+      array.begin(), array.begin() + nth, array.end(),
+      [](double v) { return std::abs(v); });
+  EXPECT_EQ_U(std::abs(abs_sorted[nth]), std::abs(abs_nth));
+
+  array.barrier();
+}
+
+TEST_F(SelectTest, PartialSort)
+{
+  using Element_t = int64_t;
+
+  dash::Array<Element_t> array(
+      num_local_elem * dash::size(), dash::BLOCKCYCLIC(17));
+  dash::generate_with_index(array.begin(), array.end(), [](size_t i) {
+    return static_cast<Element_t>((i * 7919) % 503) - 200;
+  });
+  array.barrier();
+
+  auto const sorted = sorted_copy(array);
+  array.barrier();
+
+  auto const k = array.size() / 3 + 1;
+  dash::partial_sort(array.begin(), array.begin() + k, array.end());
+
+  // The range is a permutation of the input with the k smallest elements
+  // sorted at the front
+  auto const result = copy_range<dash::Array<Element_t>>(
+      array.begin(), array.end());
+  for (size_t i = 0; i < k; ++i) {
+    ASSERT_EQ_U(sorted[i], result[i]);
+  }
+  std::vector<Element_t> result_sorted(result);
+  std::sort(result_sorted.begin(), result_sorted.end());
+  EXPECT_TRUE_U(result_sorted == sorted);
+
+  array.barrier();
+}
+
+TEST_F(SelectTest, TopK)
+{
+  using Element_t = int32_t;
+
+  dash::Array<Element_t> array(num_local_elem * dash::size());
+  dash::generate_with_index(array.begin(), array.end(), [](size_t i) {
+    return static_cast<Element_t>((i * 7919) % 101);
+  });
+  array.barrier();
+
+  auto sorted = sorted_copy(array);
+  std::reverse(sorted.begin(), sorted.end());
+  array.barrier();
+
+  for (size_t k : {size_t{0}, size_t{1}, size_t{10}, size_t{25},
+                   array.size() + 1}) {
+    std::vector<Element_t> top(k);
+    auto const top_end = dash::top_k(
+        array.begin(), array.end(), k, top.begin());
+    auto const ntop = std::min(k, array.size());
+    ASSERT_EQ_U(ntop, static_cast<size_t>(top_end - top.begin()));
+    for (size_t i = 0; i < ntop; ++i) {
+      EXPECT_EQ_U(sorted[i], top[i]);
+    }
+  }
+
+  // Smallest elements by negated key
+  std::vector<Element_t> bottom(5);
+  dash::top_k(
+      array.begin(), array.end(), bottom.size(), bottom.begin(),
+      [](Element_t v) { return -v; });
+  for (size_t i = 0; i < bottom.size(); ++i) {
+    EXPECT_EQ_U(sorted[sorted.size() - 1 - i], bottom[i]);
+  }
+
+  array.barrier();
+}
+
+template <typename Element_t>
+static void perform_small_integer_test(size_t nelem)
+{
+  dash::Array<Element_t> array(nelem, dash::BLOCKCYCLIC(11));
+
+  // Keys spanning the full range of the type, including both signs
+  dash::generate_with_index(array.begin(), array.end(), [](size_t i) {
+    return static_cast<Element_t>(i * 0x9E3779B97F4A7C15ull >> 48);
+  });
+  array.barrier();
+
+  auto const sorted = sorted_copy(array);
+  array.barrier();
+
+  for (size_t nth : {size_t{0}, array.size() / 3, array.size() - 1}) {
+    EXPECT_EQ_U(
+        sorted[nth],
+        dash::nth_element(array.begin(), array.begin() + nth, array.end()));
+  }
+
+  std::vector<Element_t> top(7);
+  dash::top_k(array.begin(), array.end(), top.size(), top.begin());
+  for (size_t i = 0; i < top.size(); ++i) {
+    EXPECT_EQ_U(sorted[sorted.size() - 1 - i], top[i]);
+  }
+  array.barrier();
+
+  auto const k = array.size() / 2;
+  dash::partial_sort(array.begin(), array.begin() + k, array.end());
+  auto const result = copy_range<dash::Array<Element_t>>(
+      array.begin(), array.begin() + k);
+  for (size_t i = 0; i < k; ++i) {
+    ASSERT_EQ_U(sorted[i], result[i]);
+  }
+
+  array.barrier();
+}
+
+TEST_F(SelectTest, SmallIntegers)
+{
+  auto const nelem = num_local_elem * dash::size();
+
+  perform_small_integer_test<int8_t>(nelem);
+  perform_small_integer_test<uint8_t>(nelem);
+  perform_small_integer_test<int16_t>(nelem);
+  perform_small_integer_test<uint16_t>(nelem);
+}
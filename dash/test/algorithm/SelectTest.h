@@ -0,0 +1,15 @@
+#ifndef DASH__TEST__SELECT_TEST_H_
+#define DASH__TEST__SELECT_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::nth_element, dash::partial_sort and
+ * dash::top_k.
+ */
+class SelectTest : public dash::test::TestBase {
+protected:
+  size_t const num_local_elem = 1000;
+};
+
+#endif  // DASH__TEST__SELECT_TEST_H_
@@ -430,5 +430,210 @@ TEST_F(SortTest, ExtremValues)
   perform_test(arr.begin(), arr.end());
 }
 
+template <typename Element_t>
+static void perform_small_extreme_test(size_t nelem)
+{
+  dash::Array<Element_t> array(nelem);
+
+  // smallest and largest keys of the type between keys of both signs
+  dash::generate_with_index(array.begin(), array.end(), [](size_t gidx) {
+    switch (gidx % 4) {
+      case 0:  return std::numeric_limits<Element_t>::max();
+      case 1:  return std::numeric_limits<Element_t>::lowest();
+      default: return static_cast<Element_t>(
+                        gidx * 0x9E3779B97F4A7C15ull >> 48);
+    }
+  });
+  array.barrier();
+
+  std::vector<Element_t> expected(nelem);
+  dash::copy(array.begin(), array.end(), expected.data());
+  std::sort(expected.begin(), expected.end());
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < nelem; ++i) {
+      auto const val = static_cast<Element_t>(array[i]);
+      ASSERT_EQ_U(expected[i], val);
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, SmallIntegersExtremeValues)
+{
+  auto const nelem = num_local_elem * dash::size();
+
+  perform_small_extreme_test<int8_t>(nelem);
+  perform_small_extreme_test<uint16_t>(nelem);
+}
+
+TEST_F(SortTest, ThreadedLocalPhases)
+{
+  std::mt19937                       generator(dash::myid());
+  std::uniform_int_distribution<int> distribution(-1000, 1000);
+
+  auto const comp = [](int a, int b) { return a < b; };
+
+  for (int nthreads = 1; nthreads <= 5; ++nthreads) {
+    for (size_t nelem : {0, 1, 3, 1000, 12345}) {
+      std::vector<int> values(nelem);
+      std::generate(values.begin(), values.end(), [&]() {
+        return distribution(generator);
+      });
+      std::vector<int> expected(values);
+      std::sort(expected.begin(), expected.end());
+
+      dash::detail::psort__local_sort(
+          values.data(), values.data() + nelem, comp, nthreads);
+
+      ASSERT_TRUE_U(values == expected);
+    }
+  }
+
+  // merge sequences of differing length, including empty sequences
+  std::vector<size_t> seq_sizes{10, 0, 257, 3, 0, 1000, 42};
+  std::vector<size_t> seq_offsets{0};
+  std::vector<int>    values;
+  for (auto const size : seq_sizes) {
+    std::vector<int> seq(size);
+    std::generate(
+        seq.begin(), seq.end(), [&]() { return distribution(generator); });
+    std::sort(seq.begin(), seq.end());
+    values.insert(values.end(), seq.begin(), seq.end());
+    seq_offsets.push_back(values.size());
+  }
+  std::vector<int> expected(values);
+  std::sort(expected.begin(), expected.end());
+
+  for (int nthreads = 1; nthreads <= 8; ++nthreads) {
+    auto merged = values;
+    dash::detail::psort__merge_sequences(
+        merged.data(), seq_offsets, comp, nthreads);
+    ASSERT_TRUE_U(merged == expected);
+  }
+
+  // large enough to use threads in the local phases if available
+  dash::Array<int> array(
+      dash::size() * 2 * DASH__ALGORITHM__MIN_ELEM_PER_THREAD);
+  rand_range(array.begin(), array.end());
+  array.barrier();
+
+  perform_test(array.begin(), array.end());
+}
+
+template <typename GlobIter>
+static void perform_radix_test(GlobIter begin, GlobIter end)
+{
+  using Element_t = typename GlobIter::value_type;
+
+  std::vector<Element_t> expected(dash::distance(begin, end));
+  dash::copy(begin, end, expected.data());
+  std::sort(expected.begin(), expected.end());
+
+  begin.pattern().team().barrier();
+
+  dash::radix_sort(begin, end);
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < expected.size(); ++i) {
+      auto const val = static_cast<Element_t>(*(begin + i));
+      ASSERT_EQ_U(expected[i], val);
+    }
+  }
+
+  begin.pattern().team().barrier();
+}
+
+TEST_F(SortTest, RadixSortIntegers)
+{
+  dash::Array<int64_t> array(num_local_elem * dash::size());
+
+  rand_range(array.begin(), array.end());
+  array.barrier();
+
+  perform_radix_test(array.begin(), array.end());
+
+  // partial range, keys spanning the full range of the type
+  auto begin = array.begin() + array.lsize() / 2;
+  auto end   = array.end() - array.lsize() / 2;
+
+  dash::generate_with_index(begin, end, [](size_t gidx) {
+    return static_cast<int64_t>(gidx * 0x9E3779B97F4A7C15ull);
+  });
+  array.barrier();
+
+  perform_radix_test(begin, end);
+}
+
+template <typename Element_t>
+static void perform_radix_small_test(size_t nelem)
+{
+  dash::Array<Element_t> array(nelem);
+
+  // keys spanning the full range of the type, including both signs
+  dash::generate_with_index(array.begin(), array.end(), [](size_t gidx) {
+    return static_cast<Element_t>(gidx * 0x9E3779B97F4A7C15ull >> 48);
+  });
+  array.barrier();
+
+  perform_radix_test(array.begin(), array.end());
+}
+
+TEST_F(SortTest, RadixSortSmallIntegers)
+{
+  auto const nelem = num_local_elem * dash::size();
+
+  perform_radix_small_test<int8_t>(nelem);
+  perform_radix_small_test<uint8_t>(nelem);
+  perform_radix_small_test<int16_t>(nelem);
+  perform_radix_small_test<uint16_t>(nelem);
+}
+
+TEST_F(SortTest, RadixSortDoubles)
+{
+  dash::Array<double> array(num_local_elem * dash::size());
+
+  rand_range(array.begin(), array.end());
+  if (dash::myid() == 0) {
+    array[0] = -0.0;
+    array[1] = std::numeric_limits<double>::lowest();
+    array[2] = std::numeric_limits<double>::max();
+  }
+  array.barrier();
+
+  perform_radix_test(array.begin(), array.end());
+}
+
+TEST_F(SortTest, RadixSortStable)
+{
+  dash::Array<Point> array(num_local_elem * dash::size());
+
+  // x holds few distinct keys, y the original position
+  dash::generate_with_index(array.begin(), array.end(), [](size_t gidx) {
+    return Point{static_cast<int32_t>((gidx * 7919) % 13) - 6,
+                 static_cast<int32_t>(gidx)};
+  });
+  array.barrier();
+
+  dash::radix_sort(
+      array.begin(), array.end(), [](const Point& p) { return p.x; });
+
+  if (dash::myid() == 0) {
+    for (auto it = array.begin() + 1; it < array.end(); ++it) {
+      auto const a = static_cast<const Point>(*(it - 1));
+      auto const b = static_cast<const Point>(*it);
+
+      ASSERT_LE_U(a.x, b.x);
+      if (a.x == b.x) {
+        ASSERT_LT_U(a.y, b.y);
+      }
+    }
+  }
+  array.barrier();
+}
+
 // TODO: add additional unit tests with various pattern types and containers
 //
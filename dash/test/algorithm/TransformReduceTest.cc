@@ -0,0 +1,142 @@
+#include "TransformReduceTest.h"
+
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/TransformReduce.h>
+
+#include <dash/Array.h>
+
+#include <algorithm>
+#include <cmath>
+
+
+TEST_F(TransformReduceTest, SumOfSquares)
+{
+  const size_t num_elem_total = dash::size() * 100 + 3;
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(7));
+
+  dash::generate_with_index(array.begin(), array.end(),
+                            [](size_t gidx) { return gidx % 13; });
+  array.barrier();
+
+  auto result = dash::transform_reduce(
+                  array.begin(), array.end(), 5,
+                  dash::plus<int>(),
+                  [](int value) { return value * value; });
+
+  int expected = 5;
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    expected += (i % 13) * (i % 13);
+  }
+  ASSERT_EQ_U(expected, result);
+}
+
+TEST_F(TransformReduceTest, InnerProduct)
+{
+  const size_t num_elem_total = dash::size() * 100 + 3;
+  dash::Array<double> array_a(num_elem_total);
+  dash::Array<double> array_b(num_elem_total);
+
+  dash::generate_with_index(array_a.begin(), array_a.end(),
+                            [](size_t gidx) { return gidx % 5; });
+  dash::generate_with_index(array_b.begin(), array_b.end(),
+                            [](size_t gidx) { return 0.5 * (gidx % 3); });
+  array_a.barrier();
+  array_b.barrier();
+
+  // subrange that does not start at a block boundary
+  auto result = dash::inner_product(
+                  array_a.begin() + 3, array_a.end() - 2,
+                  array_b.begin() + 3, 1.0);
+
+  double expected = 1.0;
+  for (size_t i = 3; i < num_elem_total - 2; ++i) {
+    expected += (i % 5) * 0.5 * (i % 3);
+  }
+  ASSERT_EQ_U(expected, result);
+
+  // generalized inner product: maximum of absolute differences
+  auto max_diff = dash::inner_product(
+                    array_a.begin(), array_a.end(), array_b.begin(), 0.0,
+                    [](double a, double b) { return std::max(a, b); },
+                    [](double a, double b) { return std::abs(a - b); });
+  double expected_max = 0.0;
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    expected_max = std::max(expected_max,
+                            std::abs((i % 5) - 0.5 * (i % 3)));
+  }
+  ASSERT_EQ_U(expected_max, max_diff);
+}
+
+TEST_F(TransformReduceTest, EmptyLocalRanges)
+{
+  // Fewer elements than units, some units do not hold any element
+  const size_t num_elem_total = 2;
+  dash::Array<long> array(num_elem_total);
+  dash::generate_with_index(array.begin(), array.end(),
+                            [](size_t gidx) { return gidx + 3; });
+  array.barrier();
+
+  auto sum = dash::transform_reduce(
+               array.begin(), array.end(), 1L,
+               dash::plus<long>(),
+               [](long value) { return 2 * value; });
+  ASSERT_EQ_U(1 + 2 * 3 + 2 * 4, sum);
+
+  auto prod = dash::transform_reduce(
+                array.begin(), array.end(), 1L,
+                dash::multiply<long>(),
+                [](long value) { return value; });
+  ASSERT_EQ_U(3 * 4, prod);
+
+  // empty range yields init
+  auto none = dash::transform_reduce(
+                array.end(), array.end(), 42L,
+                dash::plus<long>(),
+                [](long value) { return value; });
+  ASSERT_EQ_U(42, none);
+}
+
+TEST_F(TransformReduceTest, Async)
+{
+  const size_t num_elem_total = dash::size() * 50;
+  dash::Array<int> array_a(num_elem_total);
+  dash::Array<int> array_b(num_elem_total);
+
+  dash::generate_with_index(array_a.begin(), array_a.end(),
+                            [](size_t gidx) { return gidx % 4; });
+  dash::generate_with_index(array_b.begin(), array_b.end(),
+                            [](size_t) { return 2; });
+  array_a.barrier();
+  array_b.barrier();
+
+  auto fut_dot  = dash::inner_product_async(
+                    array_a.begin(), array_a.end(), array_b.begin(), 0);
+  auto fut_max  = dash::transform_reduce_async(
+                    array_a.begin(), array_a.end(), 0,
+                    [](int a, int b) { return std::max(a, b); },
+                    [](int value) { return value + 1; });
+
+  while (!fut_dot.test()) { }
+
+  int expected = 0;
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    expected += 2 * (i % 4);
+  }
+  ASSERT_EQ_U(expected, fut_dot.get());
+  ASSERT_EQ_U(4, fut_max.get());
+}
+
+TEST_F(TransformReduceTest, MisalignedRanges)
+{
+  const size_t num_elem_total = dash::size() * 10;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKCYCLIC(3));
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+
+  EXPECT_THROW(
+    dash::inner_product(array_a.begin(), array_a.end(), array_b.begin(), 0),
+    dash::exception::NotImplemented);
+}
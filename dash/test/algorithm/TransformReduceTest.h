@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__TRANSFORM_REDUCE_TEST_H_
+#define DASH__TEST__TRANSFORM_REDUCE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for dash::transform_reduce and dash::inner_product
+ */
+class TransformReduceTest : public dash::test::TestBase {
+protected:
+
+  TransformReduceTest()  {
+    LOG_MESSAGE(">>> Test suite: TransformReduceTest");
+  }
+
+  ~TransformReduceTest() override
+  {
+    LOG_MESSAGE("<<< Closing test suite: TransformReduceTest");
+  }
+};
+
+#endif // DASH__TEST__TRANSFORM_REDUCE_TEST_H_
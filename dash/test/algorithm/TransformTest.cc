@@ -1,6 +1,7 @@
 
 #include "TransformTest.h"
 
+#include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/Transform.h>
 
@@ -8,6 +9,7 @@
 #include <dash/Matrix.h>
 
 #include <array>
+#include <functional>
 
 
 TEST_F(TransformTest, ArrayLocalPlusLocal)
@@ -221,3 +223,71 @@ TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
   EXPECT_EQ_U(first_l_block_a_begin,
               first_l_block_a_offsets);
 }
+
+TEST_F(TransformTest, ArrayOutOfPlaceAligned)
+{
+  // C = op(A, B) with identical distribution in all ranges, does not
+  // require communication
+  const size_t num_elem_total = dash::size() * 100 + 7;
+  dash::Array<int>    array_a(num_elem_total, dash::BLOCKCYCLIC(9));
+  dash::Array<int>    array_b(num_elem_total, dash::BLOCKCYCLIC(9));
+  dash::Array<double> array_c(num_elem_total, dash::BLOCKCYCLIC(9));
+
+  dash::generate_with_index(array_a.begin(), array_a.end(),
+                            [](size_t gidx) { return gidx; });
+  dash::generate_with_index(array_b.begin(), array_b.end(),
+                            [](size_t gidx) { return gidx % 5 + 1; });
+  array_a.barrier();
+
+  auto out_last = dash::transform(
+                    array_a.begin(), array_a.end(),
+                    array_b.begin(),
+                    array_c.begin(),
+                    [](int a, int b) { return static_cast<double>(a) / b; });
+  EXPECT_EQ_U(array_c.end(), out_last);
+  array_c.barrier();
+
+  auto & pattern = array_c.pattern();
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    auto g = pattern.global(l);
+    EXPECT_EQ_U(static_cast<double>(g) / (g % 5 + 1), array_c.local[l]);
+  }
+}
+
+TEST_F(TransformTest, ArrayOutOfPlaceDifferentPatterns)
+{
+  // C = A - B with different distributions and start offsets, requires
+  // fetching remote input elements
+  const size_t num_elem_total = dash::size() * 20000 + 13;
+  dash::Array<long> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<long> array_b(num_elem_total, dash::BLOCKCYCLIC(3));
+  dash::Array<long> array_c(num_elem_total, dash::BLOCKCYCLIC(1000));
+
+  dash::generate_with_index(array_a.begin(), array_a.end(),
+                            [](size_t gidx) { return 3 * gidx; });
+  dash::generate_with_index(array_b.begin(), array_b.end(),
+                            [](size_t gidx) { return gidx % 7; });
+  dash::fill(array_c.begin(), array_c.end(), -1L);
+  array_a.barrier();
+
+  // c[k + 1] = a[k + 2] - b[k]
+  const size_t num_transform = num_elem_total - 3;
+  auto out_last = dash::transform(
+                    array_a.begin() + 2, array_a.begin() + 2 + num_transform,
+                    array_b.begin(),
+                    array_c.begin() + 1,
+                    std::minus<long>());
+  EXPECT_EQ_U(array_c.begin() + 1 + num_transform, out_last);
+  array_c.barrier();
+
+  auto & pattern = array_c.pattern();
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    auto g = pattern.global(l);
+    long expected = -1;
+    if (g >= 1 && static_cast<size_t>(g) < 1 + num_transform) {
+      auto k   = g - 1;
+      expected = 3 * (k + 2) - (k % 7);
+    }
+    EXPECT_EQ_U(expected, array_c.local[l]);
+  }
+}
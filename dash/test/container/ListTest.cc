@@ -3,6 +3,11 @@
 
 #include <dash/List.h>
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+
 
 TEST_F(ListTest, Initialization)
 {
@@ -59,17 +64,15 @@ TEST_F(ListTest, Initialization)
   EXPECT_EQ_U(gcap_loc,  list.capacity());
 
   // Validate local values before commit:
-  for (auto li = 0; li < list.local.size(); ++li) {
+  auto li = 0;
+  for (auto lit = list.local.begin(); lit != list.local.end(); ++lit, ++li) {
     DASH_LOG_DEBUG("ListTest.Initialization",
                    "validate list.local[", li, "]");
-    auto    l_node_unattached = *(list.local.begin() + li);
-    DASH_LOG_DEBUG_VAR("ListTest.Initialization", l_node_unattached.value);
-    DASH_LOG_DEBUG_VAR("ListTest.Initialization", l_node_unattached.lprev);
-    DASH_LOG_DEBUG_VAR("ListTest.Initialization", l_node_unattached.lnext);
     value_t expect = 1000 * (myid + 1) + li;
-    value_t actual = l_node_unattached.value;
+    value_t actual = *lit;
     EXPECT_EQ_U(expect, actual);
   }
+  EXPECT_EQ_U(nlocal, li);
 
   DASH_LOG_DEBUG("ListTest.Initialization", "list.barrier()");
   list.barrier();
@@ -83,16 +86,253 @@ TEST_F(ListTest, Initialization)
   EXPECT_EQ_U(lcap_new,  list.lcapacity());
 
   // Validate local values after commit:
-  for (auto li = 0; li < list.local.size(); ++li) {
+  li = 0;
+  for (auto lit = list.local.begin(); lit != list.local.end(); ++lit, ++li) {
     DASH_LOG_DEBUG("ListTest.Initialization",
                    "validate list.local[", li, "]");
-    auto    l_node_attached = *(list.local.begin() + li);
-    DASH_LOG_DEBUG_VAR("ListTest.Initialization", l_node_attached.value);
-    DASH_LOG_DEBUG_VAR("ListTest.Initialization", l_node_attached.lprev);
-    DASH_LOG_DEBUG_VAR("ListTest.Initialization", l_node_attached.lnext);
     value_t expect = 1000 * (myid + 1) + li;
-    value_t actual = l_node_attached.value;
+    value_t actual = *lit;
+    EXPECT_EQ_U(expect, actual);
+  }
+  EXPECT_EQ_U(nlocal, li);
+
+  // Validate global order of values:
+  li = 0;
+  for (auto git = list.begin(); git != list.end(); ++git, ++li) {
+    value_t expect = 1000 * (li / nlocal + 1) + li % nlocal;
+    value_t actual = *git;
     EXPECT_EQ_U(expect, actual);
   }
+  EXPECT_EQ_U(nglobal, li);
+}
+
+TEST_F(ListTest, LocalInsertEraseSplice)
+{
+  typedef int value_t;
+
+  auto myid      = dash::myid();
+  auto lbuf_size = 4;
+
+  dash::List<value_t> list(0, lbuf_size);
+  auto lcap_init = list.lcapacity();
+
+  auto local_values = [&]() {
+    return std::vector<value_t>(list.local.begin(), list.local.end());
+  };
+
+  for (value_t v = 0; v < 8; ++v) {
+    list.local.push_back(v);
+  }
+  list.local.push_front(-1);
+  EXPECT_EQ_U(9, list.lsize());
+  EXPECT_EQ_U(-1, list.local.front());
+  EXPECT_EQ_U(7,  list.local.back());
+
+  // Insert before element 2:
+  auto it_2   = std::next(list.local.begin(), 3);
+  auto it_ins = list.local.insert(it_2, 100);
+  EXPECT_EQ_U(100, *it_ins);
+  EXPECT_EQ_U(2,   *it_2);
+  EXPECT_EQ_U((std::vector<value_t> { -1, 0, 1, 100, 2, 3, 4, 5, 6, 7 }),
+              local_values());
+
+  // Move range [4, 6) to the front, iterators remain valid:
+  auto it_4 = std::next(list.local.begin(), 6);
+  auto it_6 = std::next(it_4, 2);
+  list.local.splice(list.local.begin(), it_4, it_6);
+  EXPECT_EQ_U(4, *it_4);
+  EXPECT_EQ_U((std::vector<value_t> { 4, 5, -1, 0, 1, 100, 2, 3, 6, 7 }),
+              local_values());
+  // Move single element to the end:
+  list.local.splice(list.local.end(), it_ins);
+  EXPECT_EQ_U((std::vector<value_t> { 4, 5, -1, 0, 1, 2, 3, 6, 7, 100 }),
+              local_values());
+  // Moving an element or range before itself has no effect:
+  list.local.splice(it_ins, it_ins);
+  list.local.splice(it_4, it_4, it_6);
+  EXPECT_EQ_U((std::vector<value_t> { 4, 5, -1, 0, 1, 2, 3, 6, 7, 100 }),
+              local_values());
+  EXPECT_EQ_U(7, *std::prev(it_ins));
+  EXPECT_TRUE_U(std::next(it_ins) == list.local.end());
+
+  // Erase elements and reuse their nodes:
+  auto lcap = list.lcapacity();
+  auto it_next = list.local.erase(std::next(list.local.begin(), 2),
+                                  std::next(list.local.begin(), 5));
+  EXPECT_EQ_U(2, *it_next);
+  list.local.pop_front();
+  list.local.pop_back();
+  EXPECT_EQ_U((std::vector<value_t> { 5, 2, 3, 6, 7 }), local_values());
+  EXPECT_EQ_U(5, list.lsize());
+  for (value_t v = 0; v < 5; ++v) {
+    list.local.emplace(list.local.end(), 10 + v);
+  }
+  EXPECT_EQ_U(10,   list.lsize());
+  EXPECT_EQ_U(lcap, list.lcapacity());
+
+  // Bulk insert grows the node pool at most once:
+  std::vector<value_t> values(3 * lbuf_size, myid);
+  list.local.insert(list.local.begin(), values.begin(), values.end());
+  EXPECT_EQ_U(10 + values.size(), list.lsize());
+  EXPECT_GE_U(lcap + values.size(), list.lcapacity());
+
+  list.barrier();
+  EXPECT_EQ_U(dash::size() * (10 + values.size()), list.size());
+
+  list.local.clear();
+  EXPECT_TRUE_U(list.local.empty());
+  EXPECT_TRUE_U(list.local.begin() == list.local.end());
+  EXPECT_LE_U(lcap_init, list.lcapacity());
+  list.barrier();
+  EXPECT_TRUE_U(list.empty());
+  EXPECT_TRUE_U(list.begin() == list.end());
+}
+
+TEST_F(ListTest, LocalConcurrentUpdates)
+{
+  typedef int value_t;
+
+  constexpr int nthreads = 4;
+  constexpr int npush    = 20000;
+
+  // Small local buffer so the node pool grows while threads insert:
+  dash::List<value_t> list(0, 8);
+
+  // Threads insert at both ends and remove elements concurrently:
+  std::vector<std::vector<value_t>> popped(nthreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nthreads; ++t) {
+    threads.emplace_back([&list, &popped, t]() {
+      for (int i = 0; i < npush; ++i) {
+        value_t v = t * npush + i;
+        switch (i % 3) {
+          case 0:  list.local.push_back(v);                  break;
+          case 1:  list.local.push_front(v);                 break;
+          default: list.local.insert(list.local.end(), v);   break;
+        }
+        value_t p;
+        bool removed = false;
+        if (i % 4 == 1) {
+          removed = list.local.try_pop_front(p);
+        } else if (i % 4 == 3) {
+          removed = list.local.try_pop_back(p);
+        }
+        if (removed) {
+          popped[t].push_back(p);
+        }
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  std::vector<value_t> values(list.local.begin(), list.local.end());
+  EXPECT_EQ_U(values.size(), list.local.size());
+  // Backward links are consistent with forward links:
+  std::vector<value_t> values_rev(
+    std::reverse_iterator<decltype(list.local.end())>(list.local.end()),
+    std::reverse_iterator<decltype(list.local.begin())>(list.local.begin()));
+  std::reverse(values_rev.begin(), values_rev.end());
+  EXPECT_TRUE_U(values == values_rev);
+
+  // Every inserted element is either in the list or has been removed once:
+  for (auto & p : popped) {
+    values.insert(values.end(), p.begin(), p.end());
+  }
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ_U(nthreads * npush, values.size());
+  for (int i = 0; i < nthreads * npush; ++i) {
+    ASSERT_EQ_U(i, values[i]);
+  }
+
+  // Threads drain the list concurrently:
+  auto lsize = list.local.size();
+  std::vector<size_t> npopped(nthreads, 0);
+  threads.clear();
+  for (int t = 0; t < nthreads; ++t) {
+    threads.emplace_back([&list, &npopped, t]() {
+      value_t p;
+      while (list.local.try_pop_front(p)) {
+        ++npopped[t];
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  size_t npopped_total = 0;
+  for (auto n : npopped) {
+    npopped_total += n;
+  }
+  EXPECT_EQ_U(lsize, npopped_total);
+  EXPECT_TRUE_U(list.local.empty());
+  EXPECT_TRUE_U(list.local.begin() == list.local.end());
+
+  list.barrier();
+  EXPECT_EQ_U(0, list.size());
+}
+
+TEST_F(ListTest, GlobalAccessAndRebalance)
+{
+  typedef int value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+  auto unit   = static_cast<size_t>(myid.id);
+
+  dash::List<value_t> list(0, 4);
+
+  // Unit u adds (u + 1) * 3 elements:
+  std::vector<value_t> expected;
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t li = 0; li < (u + 1) * 3; ++li) {
+      expected.push_back(1000 * u + li);
+    }
+  }
+  for (size_t li = 0; li < (unit + 1) * 3; ++li) {
+    list.local.push_back(1000 * myid + li);
+  }
+  list.barrier();
+  EXPECT_EQ_U(expected.size(), list.size());
+
+  // Global push and pop operations are applied in barrier:
+  if (myid == 0) {
+    list.push_front(-1);
+    list.push_front(-2);
+    list.push_back(-3);
+    list.pop_back();
+  }
+  if (unit == nunits - 1) {
+    list.pop_front();
+  }
+  list.barrier();
+  // Pushed -2 and -3 have been removed again:
+  expected.insert(expected.begin(), -1);
+  EXPECT_EQ_U(expected.size(), list.size());
+  EXPECT_EQ_U(expected.front(), static_cast<value_t>(list.front()));
+  EXPECT_EQ_U(expected.back(),  static_cast<value_t>(list.back()));
+
+  auto validate_global = [&]() {
+    size_t gi = 0;
+    for (auto git = list.begin(); git != list.end(); ++git, ++gi) {
+      EXPECT_EQ_U(expected[gi], static_cast<value_t>(*git));
+    }
+    EXPECT_EQ_U(expected.size(), gi);
+    auto git = list.end();
+    for (size_t n = expected.size(); n > 0; --n) {
+      --git;
+      EXPECT_EQ_U(expected[n - 1], static_cast<value_t>(*git));
+    }
+  };
+  validate_global();
+  list.barrier();
+
+  list.rebalance();
+  EXPECT_EQ_U(expected.size(), list.size());
+  size_t lsize_exp = expected.size() / nunits +
+                     (unit < expected.size() % nunits ? 1 : 0);
+  EXPECT_EQ_U(lsize_exp, list.lsize());
+  validate_global();
 }
 
@@ -7,6 +7,62 @@
 
 #include <vector>
 #include <algorithm>
+#include <ostream>
+
+namespace {
+
+// Key type without a specialization of std::hash:
+struct point_key {
+  int x;
+  int y;
+};
+
+struct point_key_hash {
+  std::size_t operator()(const point_key & key) const {
+    return std::hash<int>()(key.x) * 31 + std::hash<int>()(key.y);
+  }
+};
+
+struct point_key_equal {
+  bool operator()(const point_key & a, const point_key & b) const {
+    return a.x == b.x && a.y == b.y;
+  }
+};
+
+std::ostream & operator<<(std::ostream & os, const point_key & key) {
+  return os << "(" << key.x << "," << key.y << ")";
+}
+
+template <class Hash>
+void check_custom_key_hash()
+{
+  typedef dash::UnorderedMap<point_key, int, Hash, point_key_equal> map_t;
+  typedef typename map_t::value_type                                map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int local_elements = 20;
+
+  map_t map;
+  for (int li = 0; li < local_elements; ++li) {
+    EXPECT_TRUE_U(map.insert(map_value(point_key { myid, li }, li)).second);
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  for (int u = 0; u < nunits; ++u) {
+    for (int li = 0; li < local_elements; ++li) {
+      auto found = map.find(point_key { u, li });
+      ASSERT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(li, found_value.second);
+    }
+  }
+  EXPECT_EQ_U(0, map.count(point_key { nunits, 0 }));
+  map.barrier();
+}
+
+} // namespace
 
 TEST_F(UnorderedMapTest, Initialization)
 {
@@ -543,3 +599,357 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, GlobalHash)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashGlobal<key_t>                       hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  int       nunits         = dash::size();
+  int       myid           = dash::myid().id;
+  int       local_elements = 100;
+  // Key inserted by every unit:
+  key_t     shared_key     = -1;
+  hash_t    hash(dash::Team::All());
+
+  map_t map;
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t     key    = (myid * local_elements) + li;
+    mapped_t  mapped = 0.5 * key;
+    auto insertion   = map.insert(map_value(key, mapped));
+    EXPECT_TRUE_U(insertion.second);
+    // Elements are accessible at the inserting unit before commit:
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(mapped, found_value.second);
+    EXPECT_FALSE_U(map.insert(map_value(key, mapped)).second);
+  }
+  map.insert(map_value(shared_key, 1.0 * myid));
+
+  // Commit moves elements to their owning units:
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements + 1, map.size());
+  size_type lsize_exp = (hash(shared_key) == myid) ? 1 : 0;
+  for (key_t key = 0; key < nunits * local_elements; ++key) {
+    if (hash(key) == myid) {
+      ++lsize_exp;
+    }
+  }
+  EXPECT_EQ_U(lsize_exp, map.lsize());
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, hash(value.first));
+  }
+
+  for (key_t key = 0; key < nunits * local_elements; ++key) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    EXPECT_EQ_U(hash(key), found.lpos().unit);
+    map_value found_value = *found;
+    EXPECT_EQ_U(key,       found_value.first);
+    EXPECT_EQ_U(0.5 * key, found_value.second);
+  }
+  EXPECT_EQ_U(1, map.count(shared_key));
+  EXPECT_EQ_U(0, map.count(nunits * local_elements));
+}
+
+TEST_F(UnorderedMapTest, CustomKeyHash)
+{
+  check_custom_key_hash<dash::HashLocal<point_key, point_key_hash>>();
+  check_custom_key_hash<dash::HashGlobal<point_key, point_key_hash>>();
+}
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashGlobal<key_t>                       hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int shared_keys    = 50;
+  int local_elements = 200;
+
+  map_t map;
+
+  // Keys inserted by all units, twice per unit, and keys inserted by a
+  // single unit:
+  std::vector<std::pair<key_t, mapped_t>> values;
+  for (int rep = 0; rep < 2; ++rep) {
+    for (key_t key = 0; key < shared_keys; ++key) {
+      values.push_back(std::make_pair(key, 1.0));
+    }
+  }
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = shared_keys + (myid * local_elements) + li;
+    values.push_back(std::make_pair(key, 0.5 * key));
+  }
+  map.insert_bulk(values.begin(), values.end(), dash::plus<mapped_t>());
+
+  EXPECT_EQ_U(shared_keys + nunits * local_elements, map.size());
+  for (key_t key = 0; key < shared_keys; ++key) {
+    map_value value = *map.find(key);
+    EXPECT_EQ_U(2.0 * nunits, value.second);
+  }
+  for (key_t key = shared_keys;
+       key < shared_keys + nunits * local_elements; ++key) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+
+  // Values of the unit inserting last are kept:
+  std::vector<map_value> overwrite;
+  for (key_t key = 0; key < shared_keys; ++key) {
+    overwrite.push_back(map_value(key, 1.0 * myid));
+  }
+  map.insert_bulk(overwrite.begin(), overwrite.end(),
+                  dash::overwrite_mapped<mapped_t>());
+  // Existing values are kept:
+  std::vector<map_value> keep;
+  for (key_t key = 0; key < shared_keys; ++key) {
+    keep.push_back(map_value(key, -1.0));
+  }
+  map.insert_bulk(keep.begin(), keep.end());
+
+  EXPECT_EQ_U(shared_keys + nunits * local_elements, map.size());
+  for (key_t key = 0; key < shared_keys; ++key) {
+    map_value value = *map.find(key);
+    EXPECT_EQ_U(1.0 * (nunits - 1), value.second);
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsertLocalHash)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits      = dash::size();
+  int myid        = dash::myid().id;
+  int shared_keys = 50;
+  int held_keys   = 20;
+
+  map_t map;
+
+  // Keys already held by a unit before the bulk insertion:
+  for (key_t key = 0; key < held_keys; ++key) {
+    if (key % nunits == myid) {
+      map.insert(map_value(key, 10.0));
+    }
+  }
+  map.barrier();
+
+  // Keys inserted by all units, twice per unit:
+  std::vector<map_value> values;
+  for (int rep = 0; rep < 2; ++rep) {
+    for (key_t key = 0; key < shared_keys; ++key) {
+      values.push_back(map_value(key, 1.0));
+    }
+  }
+  map.insert_bulk(values.begin(), values.end(), dash::plus<mapped_t>());
+
+  EXPECT_EQ_U(shared_keys, map.size());
+  for (key_t key = 0; key < shared_keys; ++key) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value    = *found;
+    mapped_t  expected = 2.0 * nunits + (key < held_keys ? 10.0 : 0.0);
+    EXPECT_EQ_U(expected, value.second);
+  }
+  // Elements of held keys remain at their unit:
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    if (value.first < held_keys) {
+      EXPECT_EQ_U(myid, value.first % nunits);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, AsyncAccess)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashGlobal<key_t>                       hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int local_elements = 100;
+  int nkeys          = nunits * local_elements;
+
+  map_t map;
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (myid * local_elements) + li;
+    map.insert(map_value(key, 0.5 * key));
+  }
+  map.barrier();
+
+  // Start all lookups before completing any of them:
+  std::vector<dash::Future<map_iterator>> found;
+  std::vector<dash::Future<mapped_t>>     mapped;
+  for (key_t key = 0; key < 2 * nkeys; ++key) {
+    found.push_back(map.find_async(key));
+  }
+  for (key_t key = 0; key < nkeys; ++key) {
+    mapped.push_back(map.at_async(key));
+  }
+  auto missing = map.at_async(2 * nkeys);
+  map.flush();
+
+  for (key_t key = 0; key < 2 * nkeys; ++key) {
+    map_iterator it = found[key].get();
+    if (key < nkeys) {
+      ASSERT_NE_U(map.end(), it);
+      map_value value = *it;
+      EXPECT_EQ_U(key, value.first);
+      EXPECT_EQ_U(0.5 * key, value.second);
+    } else {
+      EXPECT_EQ_U(map.end(), it);
+    }
+  }
+  for (key_t key = 0; key < nkeys; ++key) {
+    EXPECT_EQ_U(0.5 * key, mapped[key].get());
+  }
+  EXPECT_THROW(missing.get(), dash::exception::InvalidArgument);
+
+  // Futures complete without flush:
+  auto single = map.find_async((myid + 1) % nkeys);
+  while (!single.test()) { }
+  EXPECT_NE_U(map.end(), single.get());
+  EXPECT_EQ_U(0.5 * (nkeys - 1), map.at_async(nkeys - 1).get());
+
+  map.barrier();
+
+  // Every unit inserts existing and new keys, new keys are inserted by a
+  // single unit:
+  std::vector<dash::Future<std::pair<map_iterator, bool>>> inserted;
+  for (key_t key = nkeys - 10; key < nkeys + 10; ++key) {
+    inserted.push_back(map.insert_async(map_value(key, -1.0)));
+  }
+  map.flush();
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE_U(inserted[i].get().second);
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys + 10, map.size());
+  for (key_t key = nkeys - 10; key < nkeys + 10; ++key) {
+    map_value value = *map.find(key);
+    EXPECT_EQ_U((key < nkeys) ? 0.5 * key : -1.0, value.second);
+  }
+
+  // Lookups in all units if keys are not mapped to owners:
+  dash::UnorderedMap<key_t, mapped_t> lmap;
+  lmap.insert(map_value(myid, 1.0 * myid));
+  lmap.barrier();
+  auto lmapped = lmap.at_async(nunits - 1);
+  auto lfound  = lmap.find_async(nunits);
+  lmap.flush();
+  EXPECT_EQ_U(1.0 * (nunits - 1), lmapped.get());
+  EXPECT_EQ_U(lmap.end(), lfound.get());
+}
+
+TEST_F(UnorderedMapTest, EraseAndCompact)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashGlobal<key_t>                       hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int local_elements = 300;
+  int nkeys          = nunits * local_elements;
+
+  map_t map;
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (myid * local_elements) + li;
+    map.insert(map_value(key, 0.5 * key));
+  }
+  map.barrier();
+
+  // Unit 0 erases keys at all units, every unit erases local elements:
+  if (myid == 0) {
+    for (key_t key = 0; key < nkeys; key += 3) {
+      EXPECT_EQ_U(1, map.erase(key));
+    }
+    EXPECT_EQ_U(0, map.erase(nkeys));
+  }
+  std::vector<key_t> lkeys;
+  for (auto it = map.local.begin(); it != map.local.end(); ++it) {
+    map_value value = *it;
+    lkeys.push_back(value.first);
+  }
+  for (auto key : lkeys) {
+    if (key % 3 == 1) {
+      EXPECT_EQ_U(1, map.local.erase(key));
+    }
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys / 3, map.size());
+  for (key_t key = 0; key < nkeys; ++key) {
+    auto found = map.find(key);
+    if (key % 3 == 2) {
+      ASSERT_NE_U(map.end(), found);
+      map_value value = *found;
+      EXPECT_EQ_U(0.5 * key, value.second);
+    } else {
+      EXPECT_EQ_U(map.end(), found);
+    }
+  }
+  size_t nvisited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    map_value value = *it;
+    EXPECT_EQ_U(2, value.first % 3);
+    ++nvisited;
+  }
+  EXPECT_EQ_U(map.size(), nvisited);
+
+  map.compact();
+  EXPECT_EQ_U(map.lsize(), map.lcapacity());
+  EXPECT_EQ_U(nkeys / 3, map.size());
+  for (key_t key = 2; key < nkeys; key += 3) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+
+  // Erased keys can be inserted again:
+  map.barrier();
+  map.local.erase(map.local.begin(), map.local.end());
+  EXPECT_EQ_U(0, map.lsize());
+  map.barrier();
+  EXPECT_EQ_U(0, map.size());
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (myid * local_elements) + li;
+    map.insert(map_value(key, -1.0 * key));
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  for (key_t key = 0; key < nkeys; ++key) {
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value value = *found;
+    EXPECT_EQ_U(-1.0 * key, value.second);
+  }
+}
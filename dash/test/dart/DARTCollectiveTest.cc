@@ -3,6 +3,9 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <algorithm>
+#include <vector>
+
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
   // we need an even amount of participating units
@@ -104,6 +107,44 @@ TEST_F(DARTCollectiveTest, MinMaxInt64t) {
 
 }
 
+TEST_F(DARTCollectiveTest, MinMaxLoc) {
+
+  using elem_t = double;
+  using pair_t = DART_OP_MINLOC_PAIR(elem_t);
+
+  // units contribute alternating values, the last unit contributes no
+  // value to test that pairs with negative index are ignored
+  auto   nvalid  = std::max<size_t>(dash::size() - 1, 1);
+  bool   valid   = static_cast<size_t>(dash::myid()) < nvalid;
+  pair_t l_pair;
+  l_pair.value = valid ? static_cast<elem_t>(dash::myid() % 2) : -100.0;
+  l_pair.index = valid ? dash::myid() * 10 : -1;
+
+  pair_t g_min, g_max;
+  dart_allreduce(&l_pair, &g_min, 1, dash::dart_datatype<elem_t>::value,
+                 DART_OP_MINLOC, dash::Team::All().dart_id());
+  dart_allreduce(&l_pair, &g_max, 1, dash::dart_datatype<elem_t>::value,
+                 DART_OP_MAXLOC, dash::Team::All().dart_id());
+
+  std::array<pair_t, 2> minmax_in{{l_pair, l_pair}};
+  std::array<pair_t, 2> minmax_out;
+  dart_allreduce(&minmax_in, &minmax_out, 2,
+                 dash::dart_datatype<elem_t>::value,
+                 DART_OP_MINMAXLOC, dash::Team::All().dart_id());
+
+  // ties are resolved to the first occurrence, except for the maximum
+  // of MINMAXLOC which is the last occurrence like in std::minmax_element
+  int64_t last_max = (nvalid > 1) ? ((nvalid - 2) | 1) * 10 : 0;
+  ASSERT_EQ_U(0.0, g_min.value);
+  ASSERT_EQ_U(0,   g_min.index);
+  ASSERT_EQ_U((nvalid > 1) ? 1.0 : 0.0, g_max.value);
+  ASSERT_EQ_U((nvalid > 1) ? 10  : 0,   g_max.index);
+  ASSERT_EQ_U(0.0, minmax_out[DART_OP_MINMAX_MIN].value);
+  ASSERT_EQ_U(0,   minmax_out[DART_OP_MINMAX_MIN].index);
+  ASSERT_EQ_U(g_max.value, minmax_out[DART_OP_MINMAX_MAX].value);
+  ASSERT_EQ_U(last_max,    minmax_out[DART_OP_MINMAX_MAX].index);
+}
+
 template<typename T>
 static void reduce_max_fn(
   const void   *invec_,
@@ -211,3 +252,209 @@ TEST_F(DARTCollectiveTest, MaxElementAt) {
   dart_op_destroy(&new_op);
 
 }
+
+TEST_F(DARTCollectiveTest, AllreduceBcastAllgatherSizes) {
+  // small messages use the hierarchical path, large ones the flat one
+  const dart_team_t team = dash::Team::All().dart_id();
+  for (size_t nelem : { size_t(1), size_t(100), size_t(64 * 1024) }) {
+    LOG_MESSAGE("nelem: %zu", nelem);
+    std::vector<int> send(nelem), recv(nelem);
+    for (size_t i = 0; i < nelem; ++i) {
+      send[i] = dash::myid() + i;
+    }
+    ASSERT_EQ_U(DART_OK,
+      dart_allreduce(
+        send.data(), recv.data(), nelem, DART_TYPE_INT, DART_OP_SUM, team));
+    int sum_ids = (dash::size() * (dash::size() - 1)) / 2;
+    for (size_t i = 0; i < nelem; ++i) {
+      ASSERT_EQ_U(sum_ids + dash::size() * i, recv[i]);
+    }
+
+    // broadcast from the last unit
+    dart_team_unit_t root = { static_cast<dart_unit_t>(dash::size() - 1) };
+    std::vector<int> bcast(nelem, dash::myid());
+    ASSERT_EQ_U(DART_OK,
+      dart_bcast(bcast.data(), nelem, DART_TYPE_INT, root, team));
+    for (size_t i = 0; i < nelem; ++i) {
+      ASSERT_EQ_U(root.id, bcast[i]);
+    }
+
+    std::vector<int> gathered(nelem * dash::size());
+    ASSERT_EQ_U(DART_OK,
+      dart_allgather(
+        send.data(), gathered.data(), nelem, DART_TYPE_INT, team));
+    for (size_t u = 0; u < dash::size(); ++u) {
+      for (size_t i = 0; i < nelem; ++i) {
+        ASSERT_EQ_U(u + i, gathered[u * nelem + i]);
+      }
+    }
+
+    // in-place allgather
+    std::fill(gathered.begin(), gathered.end(), -1);
+    std::copy(send.begin(), send.end(),
+              gathered.begin() + dash::myid() * nelem);
+    ASSERT_EQ_U(DART_OK,
+      dart_allgather(
+        gathered.data(), gathered.data(), nelem, DART_TYPE_INT, team));
+    for (size_t u = 0; u < dash::size(); ++u) {
+      ASSERT_EQ_U(u, gathered[u * nelem]);
+    }
+  }
+}
+
+template<typename T>
+static void keep_first_fn(
+  const void   *invec_,
+        void   *inoutvec_,
+        size_t  len,
+        void   *)
+{
+  // non-commutative: keeps the value of the lower unit
+  const auto *invec    = static_cast<const T *>(invec_);
+  auto *      inoutvec = static_cast<T *>(inoutvec_);
+  std::copy(invec, invec + len, inoutvec);
+}
+
+TEST_F(DARTCollectiveTest, Exscan) {
+  const dart_team_t team = dash::Team::All().dart_id();
+
+  std::vector<int> send(3), recv(3, -1);
+  for (size_t i = 0; i < send.size(); ++i) {
+    send[i] = dash::myid() + i;
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_exscan(
+      send.data(), recv.data(), send.size(), DART_TYPE_INT, DART_OP_SUM,
+      team));
+  if (dash::myid() > 0) {
+    int sum_ids = (dash::myid() * (dash::myid() - 1)) / 2;
+    for (size_t i = 0; i < recv.size(); ++i) {
+      ASSERT_EQ_U(sum_ids + dash::myid() * i, recv[i]);
+    }
+  }
+
+  dart_operation_t new_op;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_op_create(
+      &keep_first_fn<int>, nullptr, false, DART_TYPE_INT, false, &new_op));
+  int value = 100 + dash::myid();
+  int first = -1;
+  ASSERT_EQ_U(DART_OK,
+    dart_exscan(&value, &first, 1, DART_TYPE_INT, new_op, team));
+  if (dash::myid() > 0) {
+    ASSERT_EQ_U(100, first);
+  }
+  dart_op_destroy(&new_op);
+}
+
+TEST_F(DARTCollectiveTest, ReduceScatter) {
+  const dart_team_t team   = dash::Team::All().dart_id();
+  const size_t      nunits = dash::size();
+
+  // unit u receives u + 1 elements
+  std::vector<size_t> nrecv(nunits);
+  size_t nelem = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    nrecv[u] = u + 1;
+    nelem   += nrecv[u];
+  }
+  std::vector<long> send(nelem);
+  for (size_t i = 0; i < nelem; ++i) {
+    send[i] = i * (dash::myid() + 1);
+  }
+  std::vector<long> recv(nrecv[dash::myid()], -1);
+  ASSERT_EQ_U(DART_OK,
+    dart_reduce_scatter(
+      send.data(), recv.data(), nrecv.data(), DART_TYPE_LONG, DART_OP_SUM,
+      team));
+
+  size_t const offset    = (dash::myid() * (dash::myid() + 1)) / 2;
+  long const   sum_units = (nunits * (nunits + 1)) / 2;
+  for (size_t i = 0; i < recv.size(); ++i) {
+    ASSERT_EQ_U(static_cast<long>(offset + i) * sum_units, recv[i]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  const dart_team_t team   = dash::Team::All().dart_id();
+  const size_t      nunits = dash::size();
+  const size_t      myid   = dash::myid();
+
+  // unit i sends j + 1 elements with value 100 * i + j to unit j
+  std::vector<size_t> nsend(nunits), sdispls(nunits);
+  std::vector<size_t> nrecv(nunits), rdispls(nunits);
+  std::vector<int>    send;
+  for (size_t u = 0; u < nunits; ++u) {
+    nsend[u]   = u + 1;
+    sdispls[u] = send.size();
+    send.insert(send.end(), nsend[u], 100 * myid + u);
+    nrecv[u]   = myid + 1;
+    rdispls[u] = u * nrecv[u];
+  }
+  std::vector<int> recv(nunits * (myid + 1), -1);
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoallv(
+      send.data(), nsend.data(), sdispls.data(),
+      recv.data(), nrecv.data(), rdispls.data(),
+      DART_TYPE_INT, team));
+
+  for (size_t i = 0; i < recv.size(); ++i) {
+    ASSERT_EQ_U(static_cast<int>(100 * (i / (myid + 1)) + myid), recv[i]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, NonBlocking) {
+  const dart_team_t team  = dash::Team::All().dart_id();
+  const size_t      nelem = 10;
+
+  // issue all operations before completing any of them
+  dart_handle_t handles[5];
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(team, &handles[0]));
+
+  dart_team_unit_t root = { 0 };
+  std::vector<int> bcast(nelem, dash::myid() + 1);
+  ASSERT_EQ_U(DART_OK,
+    dart_ibcast(bcast.data(), nelem, DART_TYPE_INT, root, team,
+                &handles[1]));
+
+  std::vector<int> send(nelem, dash::myid());
+  std::vector<int> reduced(nelem);
+  ASSERT_EQ_U(DART_OK,
+    dart_iallreduce(send.data(), reduced.data(), nelem, DART_TYPE_INT,
+                    DART_OP_SUM, team, &handles[2]));
+
+  std::vector<int> gathered(nelem * dash::size());
+  ASSERT_EQ_U(DART_OK,
+    dart_iallgather(send.data(), gathered.data(), nelem, DART_TYPE_INT,
+                    team, &handles[3]));
+
+  // unit u sends its ID plus the ID of the receiver to each unit
+  std::vector<int> a2a_send(dash::size()), a2a_recv(dash::size());
+  for (size_t u = 0; u < dash::size(); ++u) {
+    a2a_send[u] = dash::myid() * dash::size() + u;
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_ialltoall(a2a_send.data(), a2a_recv.data(), 1, DART_TYPE_INT,
+                   team, &handles[4]));
+
+  // single handles complete through wait and test
+  ASSERT_EQ_U(DART_OK, dart_wait_local(&handles[0]));
+  ASSERT_EQ_U(DART_HANDLE_NULL, handles[0]);
+  int32_t flag = 0;
+  while (!flag) {
+    ASSERT_EQ_U(DART_OK, dart_test(&handles[1], &flag));
+  }
+  ASSERT_EQ_U(DART_HANDLE_NULL, handles[1]);
+  ASSERT_EQ_U(DART_OK, dart_waitall(&handles[2], 3));
+
+  const int sum_ids = (dash::size() * (dash::size() - 1)) / 2;
+  for (size_t i = 0; i < nelem; ++i) {
+    ASSERT_EQ_U(1, bcast[i]);
+    ASSERT_EQ_U(sum_ids, reduced[i]);
+  }
+  for (size_t u = 0; u < dash::size(); ++u) {
+    ASSERT_EQ_U(u, gathered[u * nelem]);
+    ASSERT_EQ_U(u * dash::size() + dash::myid(), a2a_recv[u]);
+  }
+}
@@ -3,6 +3,8 @@
 #include <dash/Shared.h>
 #include <dash/dart/if/dart.h>
 
+#include <vector>
+
 
 TEST_F(DARTLockTest, LockUnlockDoNothing) {
   using value_t = int;
@@ -234,3 +236,109 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, ManyLocks) {
+  // more locks than fit into a single block of the lock pool
+  constexpr int num_locks = 100;
+  std::vector<dart_lock_t> locks(num_locks);
+
+  for (auto & lock : locks) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_init(DART_TEAM_ALL, &lock));
+  }
+
+  dash::Shared<int> shared;
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+  dash::barrier();
+
+  // locks are spread over the units, acquire each of them once
+  for (int i = 0; i < num_locks; ++i) {
+    auto & lock = locks[(i + dash::myid()) % num_locks];
+    ASSERT_EQ_U(DART_OK, dart_lock_acquire(lock));
+    ASSERT_EQ_U(DART_OK, dart_lock_release(lock));
+  }
+  ASSERT_EQ_U(DART_OK, dart_lock_acquire(locks[num_locks - 1]));
+  shared.set(shared.get() + 1);
+  ASSERT_EQ_U(DART_OK, dart_lock_release(locks[num_locks - 1]));
+  dash::barrier();
+
+  ASSERT_EQ_U(dash::size(), static_cast<int>(shared.get()));
+
+  for (auto & lock : locks) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_destroy(&lock));
+  }
+}
+
+TEST_F(DARTLockTest, SharedLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+
+    // no writer may interfere while the lock is held in shared mode
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire_shared(lock));
+    value_t before = shared.get();
+    value_t after  = shared.get();
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release_shared(lock));
+    ASSERT_EQ_U(before, after);
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(), static_cast<value_t>(shared.get()));
+
+  // all units hold the lock in shared mode, exclusive acquisition fails
+  int32_t acquired;
+  ASSERT_EQ_U(DART_OK, dart_lock_try_acquire_shared(lock, &acquired));
+  ASSERT_EQ_U(1, acquired);
+  dash::barrier();
+  ASSERT_EQ_U(DART_OK, dart_lock_try_acquire(lock, &acquired));
+  ASSERT_EQ_U(0, acquired);
+  dash::barrier();
+  ASSERT_EQ_U(DART_OK, dart_lock_release_shared(lock));
+  dash::barrier();
+
+  // unit 0 holds the lock exclusively, shared acquisition fails
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(DART_OK, dart_lock_acquire(lock));
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(DART_OK, dart_lock_try_acquire_shared(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(DART_OK, dart_lock_release(lock));
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
@@ -4,6 +4,8 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/Array.h>
 
+#include <vector>
+
 TEST_F(DARTMemAllocTest, SmallLocalAlloc)
 {
   typedef int value_t;
@@ -46,6 +48,31 @@ TEST_F(DARTMemAllocTest, SmallLocalAlloc)
     dart_memfree(gptr1));
 }
 
+TEST_F(DARTMemAllocTest, ZeroSizeLocalAlloc)
+{
+  dart_gptr_t gptr1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc(0, DART_TYPE_INT, &gptr1));
+  ASSERT_NE_U(
+    DART_GPTR_NULL,
+    gptr1);
+
+  // empty allocations do not share their offset
+  dart_gptr_t gptr2;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc(0, DART_TYPE_INT, &gptr2));
+  ASSERT_NE(gptr1, gptr2);
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memfree(gptr2));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memfree(gptr1));
+}
+
 TEST_F(DARTMemAllocTest, LocalAlloc)
 {
   typedef int value_t;
@@ -107,6 +134,124 @@ TEST_F(DARTMemAllocTest, LocalAlloc)
 }
 
 
+TEST_F(DARTMemAllocTest, LocalAllocStats)
+{
+  const size_t num_allocs = 100;
+
+  dart_mempool_stats_t stats_before;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_before));
+  ASSERT_GT_U(stats_before.pool_size, 0u);
+
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(2, DART_TYPE_INT, &gptr));
+  }
+
+  dart_mempool_stats_t stats;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_before.pool_size, stats.pool_size);
+  EXPECT_EQ_U(stats_before.num_allocs + num_allocs, stats.num_allocs);
+  EXPECT_EQ_U(stats_before.bytes_allocated + num_allocs * 2 * sizeof(int),
+              stats.bytes_allocated);
+  EXPECT_LE_U(stats.largest_free_block,
+              stats.pool_size - stats.bytes_allocated - stats.bytes_cached);
+
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memfree(gptr));
+  }
+
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_before.num_frees + num_allocs, stats.num_frees);
+  EXPECT_EQ_U(stats_before.bytes_allocated, stats.bytes_allocated);
+  EXPECT_GE_U(stats.fragmentation, 0.0);
+  EXPECT_LT_U(stats.fragmentation, 1.0);
+
+  // released blocks are re-used
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc(2, DART_TYPE_INT, &gptr));
+  dart_mempool_stats_t stats_after;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_after));
+  EXPECT_GE_U(stats_after.num_cache_hits, stats.num_cache_hits);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memfree(gptr));
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocGrow)
+{
+  typedef int value_t;
+  // 20 allocations of 1 MiB exceed the pre-allocated local pool
+  const size_t num_allocs = 20;
+  const size_t block_size = (1024 * 1024) / sizeof(value_t);
+
+  dart_mempool_stats_t stats_before;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_before));
+
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(block_size, DART_TYPE_INT, &gptrs[i]));
+    ASSERT_NE_U(DART_GPTR_NULL, gptrs[i]);
+    value_t *baseptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[i], (void**)&baseptr));
+    baseptr[0]              = dash::myid().id * 1000 + i;
+    baseptr[block_size - 1] = dash::myid().id * 1000 + i;
+  }
+
+  dart_mempool_stats_t stats;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  ASSERT_GT_U(stats.pool_size, stats_before.pool_size);
+
+  // the allocations in the grown pool are globally accessible
+  dash::Array<dart_gptr_t> arr(dash::size());
+  arr.local[0] = gptrs.back();
+  arr.barrier();
+
+  size_t  neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t gptr    = arr[neighbor_id];
+  value_t neighbor_val;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+      &neighbor_val, gptr, 1, DART_TYPE_INT, DART_TYPE_INT));
+  EXPECT_EQ_U(neighbor_id * 1000 + num_allocs - 1, neighbor_val);
+
+  value_t value = dash::myid().id;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_blocking(gptr, &value, 1, DART_TYPE_INT, DART_TYPE_INT));
+
+  arr.barrier();
+
+  value_t *baseptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_getaddr(gptrs.back(), (void**)&baseptr));
+  size_t prev_id = (dash::myid().id + dash::size() - 1) % dash::size();
+  EXPECT_EQ_U(prev_id, baseptr[0]);
+
+  arr.barrier();
+
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memfree(gptr));
+  }
+
+  // memory added on demand has been returned
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_before.pool_size, stats.pool_size);
+}
+
 TEST_F(DARTMemAllocTest, SegmentReuseTest)
 {
   const size_t block_size = 10;
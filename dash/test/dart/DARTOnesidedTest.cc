@@ -3,6 +3,10 @@
 
 #include <dash/Array.h>
 #include <dash/Onesided.h>
+#include <dash/algorithm/Fill.h>
+
+#include <vector>
+#include <cstdlib>
 
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
@@ -147,6 +151,151 @@ TEST_F(DARTOnesidedTest, GetHandleAllRemote)
   ASSERT_EQ_U(num_elem_copy, l);
 }
 
+TEST_F(DARTOnesidedTest, HandleGroup)
+{
+  typedef int value_t;
+  const size_t block_size = 1000;
+  const size_t num_rounds = 3;
+  size_t num_elem_total   = dash::size() * block_size;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dash::dart_storage<value_t> ds(block_size);
+  std::vector<value_t> local_copy(num_elem_total);
+
+  dart_handle_group_t group;
+  ASSERT_EQ_U(DART_OK, dart_handle_group_create(&group));
+
+  for (size_t round = 0; round < num_rounds; ++round) {
+    for (size_t l = 0; l < block_size; ++l) {
+      array.local[l] = ((dash::myid() + 1) * 1000) + l + round;
+    }
+    array.barrier();
+
+    // get all blocks, reusing the group in every round
+    for (size_t u = 0; u < dash::size(); ++u) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_get_group(
+          local_copy.data() + (u * block_size),
+          (array.begin() + (u * block_size)).dart_gptr(),
+          ds.nelem, ds.dtype, ds.dtype,
+          group));
+    }
+    size_t num_pending;
+    ASSERT_EQ_U(DART_OK, dart_handle_group_size(group, &num_pending));
+    LOG_MESSAGE("Pending requests in round %zu: %zu", round, num_pending);
+    ASSERT_LT_U(num_pending, 2 * dash::size());
+    ASSERT_EQ_U(DART_OK, dart_handle_group_wait_local(group));
+    ASSERT_EQ_U(DART_OK, dart_handle_group_size(group, &num_pending));
+    ASSERT_EQ_U(0, num_pending);
+
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      auto unit = array.pattern().unit_at(g);
+      value_t expected = ((unit + 1) * 1000) + (g % block_size) + round;
+      ASSERT_EQ_U(expected, local_copy[g]);
+    }
+    array.barrier();
+  }
+
+  // write the local block to the right neighbor, one transfer is added
+  // from a handle
+  size_t right = (dash::myid() + 1) % dash::size();
+  std::vector<value_t> values(block_size, dash::myid());
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_group(
+      (array.begin() + (right * block_size)).dart_gptr(),
+      values.data(), ds.nelem / 2, ds.dtype, ds.dtype,
+      group));
+  dart_handle_t handle;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_handle(
+      (array.begin() + (right * block_size + block_size / 2)).dart_gptr(),
+      values.data() + block_size / 2, block_size - block_size / 2,
+      ds.dtype, ds.dtype,
+      &handle));
+  ASSERT_EQ_U(DART_OK, dart_handle_group_add(group, &handle));
+  ASSERT_EQ_U(DART_HANDLE_NULL, handle);
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ_U(DART_OK, dart_handle_group_test(group, &finished));
+  }
+  array.barrier();
+
+  value_t left = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < block_size; ++l) {
+    ASSERT_EQ_U(left, array.local[l]);
+  }
+
+  ASSERT_EQ_U(DART_OK, dart_handle_group_destroy(&group));
+  ASSERT_EQ_U(DART_HANDLE_GROUP_NULL, group);
+}
+
+TEST_F(DARTOnesidedCoalesceTest, CoalescedPutGet)
+{
+  constexpr size_t num_elem_per_unit = 100;
+
+  dart_config_t * config;
+  dart_config(&config);
+  ASSERT_EQ_U(64, config->coalesce_threshold);
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = -1;
+  }
+  dash::barrier();
+
+  dart_unit_t myid     = dash::myid();
+  dart_unit_t neighbor = (myid + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  // single-element puts in descending order, the source is re-used
+  // immediately
+  for (size_t i = num_elem_per_unit; i-- > 0; ) {
+    int value = neighbor * 1000 + i;
+    dart_gptr_t g = gptr;
+    dart_gptr_incaddr(&g, i * sizeof(int));
+    dart_put(g, &value, 1, DART_TYPE_INT, DART_TYPE_INT);
+  }
+  dart_flush(gptr);
+  // overlapping puts in separate flush epochs, the last one has to win
+  for (int i = 0; i < 3; ++i) {
+    int values[2] = { neighbor * 1000 + i, neighbor * 1000 + i + 1 };
+    dart_put(gptr, values, 2, DART_TYPE_INT, DART_TYPE_INT);
+    dart_flush(gptr);
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(myid * 1000 + 2, local_ptr[0]);
+  ASSERT_EQ_U(myid * 1000 + 3, local_ptr[1]);
+  for (size_t i = 2; i < num_elem_per_unit; ++i) {
+    ASSERT_EQ_U(myid * 1000 + i, local_ptr[i]);
+  }
+
+  // single-element gets in ascending order
+  std::vector<int> buf(num_elem_per_unit, 0);
+  for (size_t i = 2; i < num_elem_per_unit; ++i) {
+    dart_gptr_t g = gptr;
+    dart_gptr_incaddr(&g, i * sizeof(int));
+    dart_get(&buf[i], g, 1, DART_TYPE_INT, DART_TYPE_INT);
+  }
+  dart_flush_local(gptr);
+  for (size_t i = 2; i < num_elem_per_unit; ++i) {
+    ASSERT_EQ_U(neighbor * 1000 + i, buf[i]);
+  }
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
+
 
 TEST_F(DARTOnesidedTest, StridedGetSimple) {
   constexpr size_t num_elem_per_unit = 120;
@@ -280,6 +429,68 @@ TEST_F(DARTOnesidedTest, StridedPutSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedGetRepeated) {
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t stride            = 3;
+  constexpr size_t num_repeat        = 10;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+
+  dash::barrier();
+  auto *buf = new int[num_elem_per_unit];
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  dart_datatype_t new_type;
+  dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+
+  // re-use the same strided type with varying number of elements
+  for (int rep = 0; rep < num_repeat; ++rep) {
+    size_t num_elem = (num_elem_per_unit / stride) - (rep % 4);
+    LOG_MESSAGE("Testing GET with stride %zu and %zu elements",
+                stride, num_elem);
+    memset(buf, 0, sizeof(int)*num_elem_per_unit);
+    dart_get_blocking(buf, gptr, num_elem, new_type, DART_TYPE_INT);
+    for (int i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U(i*stride, buf[i]);
+    }
+    for (int i = num_elem; i < num_elem_per_unit; ++i) {
+      ASSERT_EQ_U(0, buf[i]);
+    }
+  }
+
+  dart_type_destroy(&new_type);
+
+  // a new type may reuse the address of the destroyed one and must not
+  // see its cached MPI types
+  dart_type_create_strided(DART_TYPE_INT, stride + 1, 1, &new_type);
+  memset(buf, 0, sizeof(int)*num_elem_per_unit);
+  dart_get_blocking(buf, gptr, num_elem_per_unit / (stride + 1),
+                    new_type, DART_TYPE_INT);
+  for (int i = 0; i < num_elem_per_unit / (stride + 1); ++i) {
+    ASSERT_EQ_U(i*(stride + 1), buf[i]);
+  }
+  dart_type_destroy(&new_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+
+  delete[] buf;
+}
+
+
 TEST_F(DARTOnesidedTest, BlockedStridedToStrided) {
 
   constexpr size_t num_elem_per_unit = 120;
@@ -596,3 +807,75 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, FetchAndOpBulk)
+{
+  typedef int64_t value_t;
+  const size_t block_size = 4;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // every unit increments all elements once, in reverse order and the
+  // first element of every block a second time
+  std::vector<dart_gptr_t> gptrs;
+  std::vector<value_t>     values;
+  for (size_t i = array.size(); i > 0; --i) {
+    gptrs.push_back((array.begin() + (i - 1)).dart_gptr());
+    values.push_back(i - 1);
+  }
+  for (size_t u = 0; u < dash::size(); ++u) {
+    gptrs.push_back((array.begin() + u * block_size).dart_gptr());
+    values.push_back(1);
+  }
+  std::vector<value_t> results(gptrs.size());
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_fetch_and_op_bulk(
+      gptrs.data(), values.data(), results.data(), gptrs.size(),
+      DART_TYPE_LONGLONG, DART_OP_SUM));
+  // the second increment sees the first one
+  for (size_t u = 0; u < dash::size(); ++u) {
+    ASSERT_GE_U(results[array.size() + u], u * block_size);
+  }
+  array.barrier();
+
+  for (size_t i = 0; i < array.size(); ++i) {
+    value_t expected = i * dash::size();
+    if (i % block_size == 0) {
+      expected += dash::size();
+    }
+    ASSERT_EQ_U(expected, static_cast<value_t>(array[i]));
+  }
+  array.barrier();
+
+  // accumulate without fetching the previous values
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_fetch_and_op_bulk(
+      gptrs.data(), values.data(), NULL, array.size(),
+      DART_TYPE_LONGLONG, DART_OP_SUM));
+  array.barrier();
+  ASSERT_EQ_U(
+    2 * (array.size() - 1) * dash::size(),
+    static_cast<value_t>(array[array.size() - 1]));
+  array.barrier();
+
+  // only one unit succeeds to swap in its ID at every element
+  std::vector<value_t> compares(array.size()), swaps(array.size());
+  gptrs.resize(array.size());
+  for (size_t i = 0; i < array.size(); ++i) {
+    compares[i] = array[array.size() - 1 - i];
+    swaps[i]    = -1 - dash::myid();
+  }
+  array.barrier();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_compare_and_swap_bulk(
+      gptrs.data(), swaps.data(), compares.data(), results.data(),
+      array.size(), DART_TYPE_LONGLONG));
+  array.barrier();
+  for (size_t i = 0; i < array.size(); ++i) {
+    ASSERT_LT_U(static_cast<value_t>(array[i]), 0);
+  }
+}
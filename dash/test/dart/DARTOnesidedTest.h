@@ -3,6 +3,9 @@
 
 #include "../TestBase.h"
 
+#include <cstdlib>
+#include <string>
+
 
 /**
  * Test fixture for onesided operations provided by DART.
@@ -10,4 +13,24 @@
 class DARTOnesidedTest : public dash::test::TestBase {
 };
 
+/**
+ * Test fixture for onesided operations with aggregation of transfers up
+ * to 64 bytes enabled in DART.
+ */
+class DARTOnesidedCoalesceTest : public DARTOnesidedTest {
+protected:
+  virtual void SetUp() {
+    // the threshold is read in dart_init
+    const char * env = getenv("DART_COALESCE_THRESHOLD");
+    std::string  env_prev(env != nullptr ? env : "");
+    setenv("DART_COALESCE_THRESHOLD", "64", 1);
+    DARTOnesidedTest::SetUp();
+    if (env != nullptr) {
+      setenv("DART_COALESCE_THRESHOLD", env_prev.c_str(), 1);
+    } else {
+      unsetenv("DART_COALESCE_THRESHOLD");
+    }
+  }
+};
+
 #endif // DASH__TEST__DART_ONESIDED_TEST_H_
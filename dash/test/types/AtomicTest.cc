@@ -401,6 +401,65 @@ TEST_F(AtomicTest, AtomicInContainer){
   }
 }
 
+TEST_F(AtomicTest, BulkOperations){
+  using value_t = long;
+  using atom_t  = dash::Atomic<value_t>;
+  using array_t = dash::Array<atom_t>;
+
+  const size_t nbins = 3 * dash::size();
+  array_t hist(nbins);
+  dash::fill(hist.begin(), hist.end(), 0);
+  dash::barrier();
+
+  // histogram: every unit increments bin i (i + 1) times
+  std::vector<int> bins;
+  for (size_t i = 0; i < nbins; ++i) {
+    for (size_t n = 0; n <= i; ++n) {
+      bins.push_back(i);
+    }
+  }
+  dash::atomic::add(hist.begin(), bins.data(), bins.size(), 1);
+  dash::barrier();
+
+  for (size_t i = 0; i < nbins; ++i) {
+    ASSERT_EQ_U(static_cast<value_t>((i + 1) * dash::size()),
+                dash::atomic::load(hist[i]));
+  }
+  dash::barrier();
+
+  // fetch_add returns the previous values, which all units see distinctly
+  std::vector<size_t>  idx(nbins);
+  std::vector<value_t> ones(nbins, 1), prev(nbins);
+  std::iota(idx.begin(), idx.end(), 0);
+  dash::atomic::fetch_add(
+    hist.begin(), idx.data(), idx.size(), ones.data(), prev.data());
+  for (size_t i = 0; i < nbins; ++i) {
+    ASSERT_GE_U(prev[i], static_cast<value_t>((i + 1) * dash::size()));
+    ASSERT_LT_U(prev[i], static_cast<value_t>((i + 2) * dash::size()));
+  }
+  dash::barrier();
+
+  // exactly one unit succeeds to claim each bin
+  std::vector<value_t> expected(nbins), desired(nbins, -1);
+  for (size_t i = 0; i < nbins; ++i) {
+    expected[i] = (i + 2) * dash::size();
+  }
+  auto num_exchanged = dash::atomic::compare_exchange(
+                         hist.begin(), idx.data(), idx.size(),
+                         expected.data(), desired.data());
+  auto total = dash::Team::All().size();
+  std::vector<size_t> all_exchanged(total);
+  dart_allgather(&num_exchanged, all_exchanged.data(), 1,
+                 dash::dart_datatype<size_t>::value,
+                 dash::Team::All().dart_id());
+  ASSERT_EQ_U(nbins, std::accumulate(all_exchanged.begin(),
+                                     all_exchanged.end(), size_t(0)));
+  dash::barrier();
+  for (size_t i = 0; i < nbins; ++i) {
+    ASSERT_EQ_U(-1, dash::atomic::load(hist[i]));
+  }
+}
+
 TEST_F(AtomicTest, AtomicInterface){
   using value_t = int;
   using atom_t  = dash::Atomic<value_t>;
@@ -514,6 +573,34 @@ TEST_F(AtomicTest, MutexInterface){
   }
 }
 
+TEST_F(AtomicTest, SharedMutexInterface){
+  dash::SharedMutex mx;
+
+  dash::Shared<int> shared(dash::team_unit_t{0});
+
+  if(dash::myid() == 0){
+    shared.set(0);
+  }
+  dash::barrier();
+
+  {
+    std::lock_guard<dash::SharedMutex> lg(mx);
+    int tmp = shared.get();
+    shared.set(tmp + 1);
+  }
+
+  dash::barrier();
+
+  mx.lock_shared();
+  EXPECT_EQ_U(static_cast<int>(dash::size()), static_cast<int>(shared.get()));
+  mx.unlock_shared();
+
+  dash::barrier();
+
+  ASSERT_TRUE_U(mx.try_lock_shared());
+  mx.unlock_shared();
+}
+
 dash::Mutex mx_delayed;
 
 TEST_F(AtomicTest, MutexInterfaceDelayed){
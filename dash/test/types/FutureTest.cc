@@ -4,6 +4,9 @@
 #include "FutureTest.h"
 
 #include <dash/Future.h>
+#include <dash/Collective.h>
+
+#include <vector>
 
 
 TEST_F(FutureTest, DefaultCtor)
@@ -97,3 +100,49 @@ TEST_F(FutureTest, VoidFunc)
   ASSERT_EQ_U(true, test_called);
   ASSERT_EQ_U(true, destructor_called);
 }
+
+TEST_F(FutureTest, CollectiveAsync)
+{
+  auto & team = dash::Team::All();
+  std::vector<int> values(4, _dash_id);
+  std::vector<int> sums(values.size());
+  std::vector<int> ids(_dash_size);
+  int              root_val = (_dash_id == 0) ? 42 : 0;
+
+  auto fut_barrier = dash::barrier_async(team);
+  auto fut_bcast   = dash::broadcast_async(&root_val, 1,
+                                           dash::team_unit_t{0}, team);
+  auto fut_reduce  = dash::allreduce_async(values.data(), sums.data(),
+                                           values.size(),
+                                           dash::plus<int>(), team);
+  auto fut_gather  = dash::allgather_async(values.data(), ids.data(), 1,
+                                           team);
+
+  while (!fut_barrier.test()) { }
+  fut_bcast.wait();
+  fut_reduce.wait();
+  fut_gather.get();
+
+  ASSERT_EQ_U(42, root_val);
+  for (auto sum : sums) {
+    ASSERT_EQ_U((_dash_size * (_dash_size - 1)) / 2, sum);
+  }
+  for (size_t u = 0; u < _dash_size; ++u) {
+    ASSERT_EQ_U(u, ids[u]);
+  }
+
+  // a future destroyed without waiting completes the operation
+  std::vector<int> exchanged(_dash_size);
+  {
+    auto fut_a2a = dash::alltoall_async(ids.data(), exchanged.data(), 1,
+                                        team);
+  }
+  for (auto val : exchanged) {
+    ASSERT_EQ_U(_dash_id, val);
+  }
+
+  EXPECT_THROW(
+    dash::allreduce_async(values.data(), sums.data(), values.size(),
+                          [](int a, int b) { return a + b; }, team),
+    dash::exception::InvalidArgument);
+}